@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+"""Pack fonts, token logos and the boot logo into assets/assets.bin.
+
+The bundle is flashed to the "assets" data partition and memory-mapped
+by main/assets.c; LVGL font and image descriptors point straight into
+the mapping. Regenerate (needs Pillow) with
+
+    cmake --build build --target assets
+
+and flash only the bundle with
+
+    idf.py assets-flash
+
+Layout (little-endian, every blob 4-byte aligned):
+
+    header   magic "ASST", u16 version, u16 count, u32 size, u32 crc
+    entries  count x { char name[24], u8 type, u8 pad[3], u32 offset, u32 size }
+    blobs
+
+size is the whole bundle and crc covers everything after the header.
+A font blob is a 24-byte header followed by the glyph descriptors, in
+the in-memory layout of lv_font_fmt_txt_glyph_dsc_t, and the 4 bpp
+bitmaps. An image blob is a 12-byte header followed by the pixels.
+"""
+
+import os
+import re
+import struct
+import zlib
+from PIL import Image
+
+ASSET_MAGIC = 0x54535341    # "ASST"
+ASSET_VERSION = 1
+ASSET_NAME_LEN = 24
+ASSET_FONT = 1
+ASSET_IMAGE = 2
+
+# LVGL 9 constants
+LV_COLOR_FORMAT_RGB565 = 0x12
+LV_COLOR_FORMAT_RGB565A8 = 0x14
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.normpath(os.path.join(SCRIPT_DIR, '..'))
+FONT_DIR = os.path.join(SCRIPT_DIR, 'fonts')
+LOGO_DIR = os.path.join(REPO_DIR, 'docs', 'images', 'crypto_logos')
+BOOT_PNG = os.path.join(REPO_DIR, 'docs', 'images', 'layout_lean_version.png')
+OUTPUT = os.path.join(SCRIPT_DIR, 'assets.bin')
+
+# lv_font_conv output (--bpp 4 --no-compress, one range, no kerning)
+FONTS = ['font_mono_10', 'font_mono_12', 'font_mono_14',
+         'font_mono_18', 'font_mono_20', 'font_mono_24']
+
+# Sizes the UI draws a logo at (LOGO_MAIN_PX, LOGO_SIDE_PX in main/assets.h)
+LOGO_SIZES = [32, 18]
+
+# Registry ID (main/token_config.c) -> PNG
+LOGOS = [
+    ('bitcoin',   'bitcoin.png'),
+    ('ethereum',  'ethereum.png'),
+    ('paxg',      'paxg.png'),
+    ('chainbase', 'chainbase.png'),
+    ('sui',       'sui.png'),
+    ('doge',      'doge.png'),
+    ('solana',    'solana.png'),
+    ('tron',      'tron.png'),
+    ('usdc',      'usdc.png'),
+    ('usdt',      'usdt.png'),
+]
+
+BOOT_W, BOOT_H = 320, 172
+
+
+def align4(data):
+    return data + b'\0' * (-len(data) % 4)
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+# ── Fonts ─────────────────────────────────────────────────────────
+def c_field(src, name):
+    m = re.search(r'\.' + name + r'\s*=\s*(-?\d+)', src)
+    if not m:
+        raise ValueError(f'missing .{name}')
+    return int(m.group(1))
+
+
+def pack_font(name):
+    with open(os.path.join(FONT_DIR, name + '.c')) as f:
+        src = f.read()
+
+    body = re.search(r'glyph_bitmap\[\]\s*=\s*\{(.*?)\};', src, re.S).group(1)
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+    bitmap = bytes(int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', body))
+
+    glyphs = bytearray()
+    for m in re.finditer(r'\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), '
+                         r'\.box_h = (\d+), \.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}', src):
+        idx, adv, bw, bh, ox, oy = map(int, m.groups())
+        # uint32_t bitmap_index : 20, adv_w : 12; uint8_t box_w, box_h; int8_t ofs_x, ofs_y
+        glyphs += struct.pack('<IBBbb', idx | (adv << 20), bw, bh, ox, oy)
+    count = len(glyphs) // 8
+
+    if c_field(src, 'cmap_num') != 1 or c_field(src, 'bpp') != 4 or 'kern_dsc = NULL' not in src:
+        raise ValueError(f'{name}: expected one cmap, 4 bpp and no kerning')
+
+    hdr_size = 24
+    bitmap_ofs = hdr_size + len(glyphs)
+    hdr = struct.pack('<hhbBBBIHHII',
+                      c_field(src, 'line_height'), c_field(src, 'base_line'),
+                      c_field(src, 'underline_position'), c_field(src, 'underline_thickness'),
+                      4, 0,
+                      c_field(src, 'range_start'), c_field(src, 'range_length'),
+                      c_field(src, 'glyph_id_start'), count, bitmap_ofs)
+    assert len(hdr) == hdr_size
+    return hdr + bytes(glyphs) + bitmap
+
+
+# ── Images ────────────────────────────────────────────────────────
+def image_blob(cf, w, h, stride, data):
+    return struct.pack('<BBHHHI', cf, 0, w, h, stride, len(data)) + bytes(data)
+
+
+def pack_logo(png, sz):
+    """RGB565 plane (little-endian) followed by the A8 plane."""
+    img = Image.open(os.path.join(LOGO_DIR, png)).convert('RGBA').resize((sz, sz), Image.LANCZOS)
+    color = bytearray()
+    alpha = bytearray()
+    for y in range(sz):
+        for x in range(sz):
+            r, g, b, a = img.getpixel((x, y))
+            color += struct.pack('<H', rgb565(r, g, b))
+            alpha.append(a)
+    return image_blob(LV_COLOR_FORMAT_RGB565A8, sz, sz, sz * 2, color + alpha)
+
+
+def pack_boot_logo():
+    img = Image.open(BOOT_PNG).convert('RGB').resize((BOOT_W, BOOT_H), Image.LANCZOS)
+    pixels = bytearray()
+    for y in range(BOOT_H):
+        for x in range(BOOT_W):
+            pixels += struct.pack('<H', rgb565(*img.getpixel((x, y))))
+    return image_blob(LV_COLOR_FORMAT_RGB565, BOOT_W, BOOT_H, BOOT_W * 2, pixels)
+
+
+# ── Bundle ────────────────────────────────────────────────────────
+def main():
+    entries = [(name, ASSET_FONT, pack_font(name)) for name in FONTS]
+    for token, png in LOGOS:
+        for sz in LOGO_SIZES:
+            entries.append((f'logo_{token}_{sz}', ASSET_IMAGE, pack_logo(png, sz)))
+    entries.append(('boot_logo', ASSET_IMAGE, pack_boot_logo()))
+
+    table = bytearray()
+    blobs = bytearray()
+    offset = 16 + 36 * len(entries)
+    for name, kind, blob in entries:
+        assert len(name) < ASSET_NAME_LEN
+        table += struct.pack('<24sB3xII', name.encode(), kind, offset + len(blobs), len(blob))
+        blobs += align4(blob)
+
+    payload = bytes(table + blobs)
+    header = struct.pack('<IHHII', ASSET_MAGIC, ASSET_VERSION, len(entries),
+                         16 + len(payload), zlib.crc32(payload))
+    with open(OUTPUT, 'wb') as f:
+        f.write(header + payload)
+
+    print(f'Generated {OUTPUT} ({16 + len(payload)} bytes, {len(entries)} entries)')
+    for name, kind, blob in entries:
+        print(f'  {name:<24} {"font" if kind == ASSET_FONT else "image":<5} {len(blob):>7} bytes')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,288 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "assets.h"
+
+#include "esp_partition.h"
+#include "esp_crc.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "assets";
+
+// ── Bundle format (see assets/pack_assets.py) ──────────────────────
+#define ASSET_PART_SUBTYPE  0x42
+#define ASSET_MAGIC         0x54535341   // "ASST"
+#define ASSET_VERSION       1
+#define ASSET_NAME_LEN      24
+
+enum { ASSET_FONT = 1, ASSET_IMAGE = 2 };
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;           // entries that follow
+    uint32_t size;            // whole bundle, header included
+    uint32_t crc;             // over everything after the header
+} asset_hdr_t;
+
+typedef struct {
+    char     name[ASSET_NAME_LEN];
+    uint8_t  type;
+    uint8_t  reserved[3];
+    uint32_t offset;          // from the start of the bundle, 4-byte aligned
+    uint32_t size;
+} asset_entry_t;
+
+typedef struct {
+    int16_t  line_height;
+    int16_t  base_line;
+    int8_t   underline_position;
+    uint8_t  underline_thickness;
+    uint8_t  bpp;
+    uint8_t  reserved;
+    uint32_t range_start;     // one contiguous range, glyph IDs in order
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint32_t glyph_count;     // glyph descriptors follow this header
+    uint32_t bitmap_offset;   // from the start of the blob
+} asset_font_t;
+
+typedef struct {
+    uint8_t  cf;              // lv_color_format_t
+    uint8_t  reserved;
+    uint16_t w;
+    uint16_t h;
+    uint16_t stride;
+    uint32_t data_size;       // pixels follow this header
+} asset_image_t;
+
+_Static_assert(sizeof(asset_hdr_t) == 16 && sizeof(asset_entry_t) == 36 &&
+               sizeof(asset_font_t) == 24 && sizeof(asset_image_t) == 12,
+               "asset structs must match pack_assets.py");
+// Glyph descriptors are used in place: the packer writes this layout
+#if LV_FONT_FMT_TXT_LARGE
+#error "pack_assets.py writes the small glyph descriptor layout"
+#endif
+_Static_assert(sizeof(lv_font_fmt_txt_glyph_dsc_t) == 8, "unexpected glyph descriptor size");
+
+// ── Fonts ──────────────────────────────────────────────────────────
+lv_font_t font_mono_10;
+lv_font_t font_mono_12;
+lv_font_t font_mono_14;
+lv_font_t font_mono_18;
+lv_font_t font_mono_20;
+lv_font_t font_mono_24;
+
+typedef struct {
+    const char    *name;
+    lv_font_t     *font;
+    const lv_font_t *fallback;
+    lv_font_fmt_txt_dsc_t  dsc;
+    lv_font_fmt_txt_cmap_t cmap;
+} font_slot_t;
+
+static font_slot_t s_fonts[] = {
+    { "font_mono_10", &font_mono_10, &lv_font_montserrat_10 },
+    { "font_mono_12", &font_mono_12, &lv_font_montserrat_14 },
+    { "font_mono_14", &font_mono_14, &lv_font_montserrat_14 },
+    { "font_mono_18", &font_mono_18, &lv_font_montserrat_18 },
+    { "font_mono_20", &font_mono_20, &lv_font_montserrat_20 },
+    { "font_mono_24", &font_mono_24, &lv_font_montserrat_24 },
+};
+#define FONT_COUNT  (sizeof(s_fonts) / sizeof(s_fonts[0]))
+
+// ── Mapped bundle ──────────────────────────────────────────────────
+static const uint8_t       *s_base;        // NULL = no bundle
+static const asset_entry_t *s_entries;
+static int                  s_count;
+static lv_image_dsc_t      *s_images;      // one per entry, used for images
+static crypto_logo_t       *s_logos;       // filled by assets_logo()
+static const char         **s_logo_ids;
+static int                  s_logo_count;
+
+static const asset_entry_t *find_entry(const char *name, uint8_t type)
+{
+    for (int i = 0; i < s_count; i++) {
+        if (s_entries[i].type == type &&
+            strncmp(s_entries[i].name, name, ASSET_NAME_LEN) == 0) {
+            return &s_entries[i];
+        }
+    }
+    return NULL;
+}
+
+static bool load_font(font_slot_t *f, const asset_entry_t *e)
+{
+    const uint8_t *blob = s_base + e->offset;
+    const asset_font_t *h = (const asset_font_t *)blob;
+    if (e->size < sizeof(*h) || h->bpp != 4 ||
+        sizeof(*h) + h->glyph_count * sizeof(lv_font_fmt_txt_glyph_dsc_t) > h->bitmap_offset ||
+        h->bitmap_offset > e->size) {
+        return false;
+    }
+
+    f->cmap = (lv_font_fmt_txt_cmap_t) {
+        .range_start = h->range_start,
+        .range_length = h->range_length,
+        .glyph_id_start = h->glyph_id_start,
+        .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY,
+    };
+    f->dsc = (lv_font_fmt_txt_dsc_t) {
+        .glyph_bitmap = blob + h->bitmap_offset,
+        .glyph_dsc = (const lv_font_fmt_txt_glyph_dsc_t *)(blob + sizeof(*h)),
+        .cmaps = &f->cmap,
+        .cmap_num = 1,
+        .bpp = h->bpp,
+    };
+    *f->font = (lv_font_t) {
+        .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+        .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+        .line_height = h->line_height,
+        .base_line = h->base_line,
+        .subpx = LV_FONT_SUBPX_NONE,
+        .underline_position = h->underline_position,
+        .underline_thickness = h->underline_thickness,
+        .dsc = &f->dsc,
+    };
+    return true;
+}
+
+static void load_image(lv_image_dsc_t *img, const asset_entry_t *e)
+{
+    const asset_image_t *h = (const asset_image_t *)(s_base + e->offset);
+    if (e->size < sizeof(*h) || h->data_size > e->size - sizeof(*h)) return;
+
+    *img = (lv_image_dsc_t) {
+        .header = {
+            .magic = LV_IMAGE_HEADER_MAGIC,
+            .cf = h->cf,
+            .w = h->w,
+            .h = h->h,
+            .stride = h->stride,
+        },
+        .data_size = h->data_size,
+        .data = (const uint8_t *)(h + 1),
+    };
+}
+
+/* Map the bundle and check it; leaves s_base NULL on failure. */
+static bool map_bundle(void)
+{
+    const esp_partition_t *part =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ASSET_PART_SUBTYPE, "assets");
+    if (!part) {
+        ESP_LOGW(TAG, "No assets partition");
+        return false;
+    }
+
+    asset_hdr_t h;
+    if (esp_partition_read(part, 0, &h, sizeof(h)) != ESP_OK ||
+        h.magic != ASSET_MAGIC || h.version != ASSET_VERSION ||
+        h.size > part->size || h.size < sizeof(h) + h.count * sizeof(asset_entry_t)) {
+        ESP_LOGW(TAG, "No asset bundle in partition (flash it with idf.py assets-flash)");
+        return false;
+    }
+
+    // Mapped through the flash cache for the lifetime of the app
+    const void *map;
+    esp_partition_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(part, 0, h.size, ESP_PARTITION_MMAP_DATA, &map, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "mmap failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    const uint8_t *base = map;
+    if (esp_crc32_le(0, base + sizeof(h), h.size - sizeof(h)) != h.crc) {
+        ESP_LOGW(TAG, "Asset bundle: bad CRC");
+        esp_partition_munmap(handle);
+        return false;
+    }
+
+    const asset_entry_t *entries = (const asset_entry_t *)(base + sizeof(h));
+    for (int i = 0; i < h.count; i++) {
+        if (entries[i].offset % 4 || entries[i].offset > h.size ||
+            entries[i].size > h.size - entries[i].offset) {
+            ESP_LOGW(TAG, "Asset bundle: entry %d out of bounds", i);
+            esp_partition_munmap(handle);
+            return false;
+        }
+    }
+
+    s_base = base;
+    s_entries = entries;
+    s_count = h.count;
+    return true;
+}
+
+bool assets_init(void)
+{
+    int64_t t0 = esp_timer_get_time();
+    bool ok = map_bundle();
+
+    if (ok) {
+        s_images = calloc(s_count, sizeof(*s_images));
+        s_logos = calloc(s_count, sizeof(*s_logos));
+        s_logo_ids = calloc(s_count, sizeof(*s_logo_ids));
+        ok = s_images && s_logos && s_logo_ids;
+    }
+    for (int i = 0; ok && i < s_count; i++) {
+        if (s_entries[i].type == ASSET_IMAGE) load_image(&s_images[i], &s_entries[i]);
+    }
+
+    int fonts = 0;
+    for (size_t i = 0; i < FONT_COUNT; i++) {
+        font_slot_t *f = &s_fonts[i];
+        const asset_entry_t *e = ok ? find_entry(f->name, ASSET_FONT) : NULL;
+        if (e && load_font(f, e)) {
+            fonts++;
+        } else {
+            *f->font = *f->fallback;
+            if (ok) ESP_LOGW(TAG, "%s missing, using Montserrat", f->name);
+        }
+    }
+
+    if (ok) {
+        ESP_LOGI(TAG, "Mapped %d assets (%d fonts) in %lld us", s_count, fonts,
+                 esp_timer_get_time() - t0);
+    } else {
+        s_count = 0;
+    }
+    return ok;
+}
+
+const lv_image_dsc_t *assets_image(const char *name)
+{
+    const asset_entry_t *e = find_entry(name, ASSET_IMAGE);
+    if (!e) return NULL;
+    lv_image_dsc_t *img = &s_images[e - s_entries];
+    return img->data ? img : NULL;
+}
+
+const crypto_logo_t *assets_logo(const char *id)
+{
+    static const crypto_logo_t none;
+    for (int i = 0; i < s_logo_count; i++) {
+        if (strcmp(s_logo_ids[i], id) == 0) return &s_logos[i];
+    }
+
+    char name[ASSET_NAME_LEN];
+    crypto_logo_t logo;
+    snprintf(name, sizeof(name), "logo_%s_%d", id, LOGO_MAIN_PX);
+    logo.main = assets_image(name);
+    snprintf(name, sizeof(name), "logo_%s_%d", id, LOGO_SIDE_PX);
+    logo.side = assets_image(name);
+
+    // At most one slot per image entry: a token without images gets none
+    if (!logo.main && !logo.side) return &none;
+    s_logos[s_logo_count] = logo;
+    s_logo_ids[s_logo_count] = id;
+    return &s_logos[s_logo_count++];
+}
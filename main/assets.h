@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "lvgl.h"
+
+#include <stdbool.h>
+
+/*
+ * Fonts, token logos and the boot logo live in their own "assets" data
+ * partition (assets/assets.bin, packed by assets/pack_assets.py), not
+ * in the app. The partition is memory-mapped once and the LVGL
+ * descriptors point straight into the mapping, so no asset is copied
+ * to RAM and assets can be reflashed without the firmware.
+ */
+
+// Every logo is packed pre-scaled to each size the UI uses (RGB565A8)
+#define LOGO_MAIN_PX  32    // main card header
+#define LOGO_SIDE_PX  18    // side cards
+
+typedef struct {
+    const lv_image_dsc_t *main;     // NULL if the bundle has none
+    const lv_image_dsc_t *side;
+} crypto_logo_t;
+
+// Valid after assets_init(); Montserrat stand-ins without a bundle
+extern lv_font_t font_mono_10;
+extern lv_font_t font_mono_12;
+extern lv_font_t font_mono_14;
+extern lv_font_t font_mono_18;
+extern lv_font_t font_mono_20;
+extern lv_font_t font_mono_24;
+
+/**
+ * Map the asset partition and set up the fonts. Returns false (and
+ * falls back to built-in fonts, without images) if the partition is
+ * missing or its bundle is invalid. Call once, before any UI.
+ */
+bool assets_init(void);
+
+/** Image asset by name, or NULL. */
+const lv_image_dsc_t *assets_image(const char *name);
+
+/** Logos of a registry token ID; never NULL, its images may be. */
+const crypto_logo_t *assets_logo(const char *id);
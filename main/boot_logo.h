@@ -1,4 +0,0 @@
-#pragma once
-#include "lvgl.h"
-
-extern const lv_image_dsc_t boot_logo_dsc;
@@ -87,9 +87,9 @@ static void btn_task(void *arg)
                     // Info: HomeKit double press
                     homekit_send_switch_double_press();
                 } else {
-                    // Crypto view: switch coin
+                    // Crypto view: next chart timeframe
                     if (lvgl_port_lock(100)) {
-                        switch_focus();
+                        cycle_timeframe();
                         lvgl_port_unlock();
                     }
                 }
@@ -1,528 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2025-2026 Bruce
- * SPDX-License-Identifier: CC-BY-NC-4.0
- */
-
-// Auto-generated crypto token logos for LVGL 9
-#include "lvgl.h"
-
-// bitcoin.png -> 36x36 ARGB8888
-static const uint8_t img_bitcoin_logo_data[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x97, 0xff, 0x2f, 0x1a, 0x99, 0xfc, 0x73, 0x1a, 0x98, 0xfa, 0xae, 0x1a, 0x95, 0xf9, 0xda, 0x1a, 0x94, 0xf8, 0xf4, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x94, 0xf8, 0xf4, 0x1a, 0x95, 0xf9, 0xda, 0x1a, 0x97, 0xf9, 0xaf, 0x1a, 0x99, 0xfc, 0x73, 0x1b, 0x9d, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x05, 0x1b, 0x9b, 0xff, 0x5c, 0x1a, 0x97, 0xfc, 0xbe, 0x1a, 0x96, 0xf9, 0xf6, 0x1c, 0x9b, 0xff, 0xff, 0x1b, 0x9a, 0xff, 0xff, 0x1b, 0x96, 0xfd, 0xff, 0x1a, 0x94, 0xf8, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x94, 0xf8, 0xff, 0x1b, 0x96, 0xfd, 0xff, 0x1b, 0x9a, 0xff, 0xff, 0x1c, 0x9b, 0xff, 0xff, 0x1a, 0x97, 0xf9, 0xf6, 0x1a, 0x99, 0xfc, 0xbe, 0x1b, 0x9b, 0xff, 0x5c, 0x00, 0x99, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x97, 0xfb, 0x4f, 0x1a, 0x99, 0xfd, 0xd0, 0x1c, 0x9d, 0xff, 0xff, 0x1b, 0x9a, 0xff, 0xff, 0x1a, 0x94, 0xf8, 0xff, 0x1a, 0x92, 0xf5, 0xfd, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x92, 0xf5, 0xfd, 0x1a, 0x94, 0xf8, 0xff, 0x1b, 0x9a, 0xff, 0xff, 0x1c, 0x9d, 0xff, 0xff, 0x1a, 0x99, 0xfd, 0xd0, 0x19, 0x97, 0xfb, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x19, 0x99, 0xff, 0x0a, 0x1a, 0x99, 0xfd, 0x99, 0x1c, 0x9b, 0xff, 0xff, 0x1b, 0x98, 0xff, 0xff, 0x1a, 0x92, 0xf5, 0xfc, 0x1a, 0x92, 0xf6, 0xfc, 0x1a, 0x93, 0xf7, 0xfe, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xfe, 0x1a, 0x92, 0xf6, 0xfc, 0x1a, 0x92, 0xf5, 0xfc, 0x1b, 0x98, 0xff, 0xff, 0x1c, 0x9b, 0xff, 0xff, 0x1a, 0x99, 0xfd, 0x99, 0x19, 0x99, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x93, 0xf5, 0x1a, 0x1b, 0x99, 0xfb, 0xc6, 0x1c, 0x9e, 0xff, 0xff, 0x1a, 0x92, 0xf6, 0xfc, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x92, 0xf6, 0xfc, 0x1c, 0x9e, 0xff, 0xff, 0x1b, 0x99, 0xfb, 0xc6, 0x1d, 0x93, 0xf5, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x8e, 0xf4, 0x19, 0x1a, 0x98, 0xfb, 0xd5, 0x1c, 0x9c, 0xff, 0xff, 0x1a, 0x92, 0xf6, 0xfa, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x15, 0x91, 0xf7, 0xff, 0x15, 0x91, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfa, 0x1c, 0x9c, 0xff, 0xff, 0x1a, 0x98, 0xfb, 0xd5, 0x1e, 0x8e, 0xf4, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x02, 0x19, 0x99, 0xff, 0x0a, 0x1a, 0x97, 0xf9, 0xc8, 0x1c, 0x9c, 0xff, 0xff, 0x1a, 0x92, 0xf5, 0xfb, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x17, 0x91, 0xf7, 0xff, 0x31, 0x9d, 0xf8, 0xff, 0x2f, 0x9d, 0xf8, 0xff, 0x19, 0x92, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x0f, 0x8e, 0xf7, 0xff, 0x15, 0x91, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf5, 0xfb, 0x1c, 0x9c, 0xff, 0xff, 0x1a, 0x97, 0xf9, 0xc8, 0x19, 0x99, 0xff, 0x0a, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x94, 0xf8, 0x9b, 0x1c, 0x9f, 0xff, 0xff, 0x1a, 0x92, 0xf6, 0xfa, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1d, 0x95, 0xf7, 0xff, 0x21, 0x96, 0xf7, 0xff, 0x0d, 0x8d, 0xf7, 0xff, 0xa8, 0xd6, 0xfc, 0xff, 0xf3, 0xf9, 0xff, 0xff, 0x5d, 0xb2, 0xf9, 0xff, 0x14, 0x90, 0xf7, 0xff, 0x55, 0xaf, 0xf9, 0xff, 0x2d, 0x9c, 0xf8, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfa, 0x1c, 0x9f, 0xff, 0xff, 0x1a, 0x95, 0xf8, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x95, 0xfb, 0x4b, 0x1c, 0x9b, 0xff, 0xff, 0x1a, 0x93, 0xf7, 0xfb, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x19, 0x93, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x0b, 0x8c, 0xf6, 0xff, 0x0a, 0x8c, 0xf6, 0xff, 0x15, 0x90, 0xf7, 0xff, 0xdc, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0xa6, 0xf8, 0xff, 0x3a, 0xa2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xe8, 0xfd, 0xff, 0x18, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xfb, 0x1c, 0x9c, 0xff, 0xff, 0x1b, 0x95, 0xfb, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03,
-    0x00, 0xff, 0xff, 0x01, 0x24, 0x91, 0xff, 0x07, 0x1a, 0x93, 0xf9, 0xd6, 0x1b, 0x98, 0xfd, 0xfe, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x0d, 0x8d, 0xf7, 0xff, 0x5c, 0xb2, 0xf9, 0xff, 0xd4, 0xeb, 0xfd, 0xff, 0x9e, 0xd1, 0xfc, 0xff, 0x62, 0xb5, 0xf9, 0xff, 0x59, 0xb1, 0xf9, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xe0, 0xf0, 0xfe, 0xff, 0x00, 0x85, 0xf6, 0xff, 0x71, 0xbc, 0xfa, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xac, 0xd8, 0xfc, 0xff, 0x0e, 0x8e, 0xf7, 0xff, 0x1d, 0x95, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf6, 0xfd, 0x1b, 0x98, 0xfd, 0xfe, 0x1a, 0x93, 0xf9, 0xd6, 0x24, 0x91, 0xff, 0x07, 0x00, 0xff, 0xff, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x94, 0xf9, 0x5b, 0x1c, 0x9d, 0xff, 0xff, 0x1a, 0x92, 0xf5, 0xfc, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x0a, 0x8b, 0xf6, 0xff, 0x97, 0xce, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xf2, 0xfe, 0xff, 0x71, 0xbb, 0xfa, 0xff, 0xc0, 0xe1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xb4, 0xfa, 0xff, 0x01, 0x87, 0xf6, 0xff, 0x20, 0x96, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf5, 0xfc, 0x1c, 0x9d, 0xff, 0xff, 0x19, 0x94, 0xf9, 0x5b, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x01, 0x1a, 0x95, 0xf8, 0xc1, 0x1b, 0x9a, 0xff, 0xfe, 0x1a, 0x92, 0xf6, 0xfc, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x18, 0x92, 0xf7, 0xff, 0x33, 0x9f, 0xf8, 0xff, 0x60, 0xb4, 0xf9, 0xff, 0xcf, 0xe9, 0xfd, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xab, 0xd7, 0xfc, 0xff, 0x3f, 0xa4, 0xf8, 0xff, 0x0d, 0x8d, 0xf7, 0xff, 0x19, 0x93, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfc, 0x1b, 0x9a, 0xff, 0xfe, 0x1a, 0x95, 0xf8, 0xc1, 0x00, 0xff, 0xff, 0x01,
-    0x1b, 0x95, 0xf9, 0x2e, 0x1a, 0x94, 0xf8, 0xf9, 0x1a, 0x94, 0xf9, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x18, 0x92, 0xf7, 0xff, 0x00, 0x84, 0xf5, 0xff, 0x70, 0xbb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xca, 0xe6, 0xfd, 0xff, 0xe2, 0xf1, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0x99, 0xcf, 0xfb, 0xff, 0x18, 0x92, 0xf7, 0xff, 0x19, 0x92, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x94, 0xf9, 0xff, 0x1a, 0x95, 0xf9, 0xf8, 0x1b, 0x95, 0xf9, 0x2e,
-    0x1a, 0x96, 0xfa, 0x75, 0x1b, 0x9b, 0xff, 0xff, 0x1a, 0x92, 0xf5, 0xfd, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1f, 0x95, 0xf7, 0xff, 0x0f, 0x8e, 0xf6, 0xff, 0xa3, 0xd4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xf5, 0xfe, 0xff, 0x20, 0x96, 0xf7, 0xff, 0x21, 0x96, 0xf7, 0xff, 0x5c, 0xb2, 0xf9, 0xff, 0xd0, 0xe9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xd1, 0xfb, 0xff, 0x0e, 0x8d, 0xf6, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf5, 0xfd, 0x1b, 0x9b, 0xff, 0xff, 0x1a, 0x96, 0xfa, 0x75,
-    0x19, 0x94, 0xf9, 0xb1, 0x1b, 0x9a, 0xff, 0xff, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x19, 0x93, 0xf7, 0xff, 0xd8, 0xec, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe1, 0xfd, 0xff, 0x12, 0x90, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x0a, 0x8c, 0xf6, 0xff, 0x21, 0x96, 0xf7, 0xff, 0xdb, 0xee, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xf7, 0xfb, 0xff, 0xff, 0x30, 0x9e, 0xf8, 0xff, 0x15, 0x91, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf6, 0xfd, 0x1b, 0x9a, 0xff, 0xff, 0x1a, 0x95, 0xfa, 0xb0,
-    0x1a, 0x95, 0xf9, 0xdb, 0x1b, 0x96, 0xfd, 0xff, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x13, 0x8f, 0xf7, 0xff, 0x39, 0xa2, 0xf8, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xc0, 0xfa, 0xff, 0x01, 0x87, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x04, 0x88, 0xf7, 0xff, 0xb8, 0xde, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0x3d, 0xa4, 0xf8, 0xff, 0x12, 0x8f, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfe, 0x1b, 0x96, 0xfd, 0xff, 0x1a, 0x95, 0xf9, 0xdb,
-    0x1a, 0x95, 0xf9, 0xf3, 0x1a, 0x94, 0xf9, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1d, 0x95, 0xf7, 0xff, 0x0b, 0x8c, 0xf6, 0xff, 0x6b, 0xb9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0x8d, 0xc9, 0xfb, 0xff, 0x35, 0xa0, 0xf8, 0xff, 0x26, 0x99, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x5f, 0xb4, 0xf9, 0xff, 0xf5, 0xfa, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xf2, 0xfe, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x19, 0x92, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x94, 0xf9, 0xff, 0x1a, 0x95, 0xf9, 0xf3,
-    0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x0b, 0x8c, 0xf6, 0xff, 0xa3, 0xd3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xf2, 0xfe, 0xff, 0xe2, 0xf1, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0xbd, 0xfa, 0xff, 0x0d, 0x8d, 0xf6, 0xff, 0x1d, 0x95, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfe,
-    0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x19, 0x93, 0xf7, 0xff, 0xd7, 0xec, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xda, 0xed, 0xfe, 0xff, 0xa9, 0xd6, 0xfc, 0xff, 0xe4, 0xf2, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xf0, 0xf8, 0xfe, 0xff, 0x59, 0xb1, 0xf9, 0xff, 0x0c, 0x8c, 0xf6, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfe,
-    0x1a, 0x95, 0xf9, 0xf3, 0x1a, 0x94, 0xf9, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1f, 0x95, 0xf7, 0xff, 0x16, 0x91, 0xf7, 0xff, 0x3a, 0xa2, 0xf8, 0xff, 0xfa, 0xfd, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0xfa, 0xff, 0x00, 0x85, 0xf6, 0xff, 0x23, 0x97, 0xf7, 0xff, 0x52, 0xad, 0xf9, 0xff, 0xbe, 0xe0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xb3, 0xdb, 0xfc, 0xff, 0x1f, 0x95, 0xf7, 0xff, 0x19, 0x92, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x94, 0xf9, 0xff, 0x1a, 0x95, 0xf9, 0xf3,
-    0x1a, 0x95, 0xf9, 0xdb, 0x1b, 0x96, 0xfd, 0xff, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x19, 0x93, 0xf7, 0xff, 0x0e, 0x8e, 0xf6, 0xff, 0x00, 0x85, 0xf6, 0xff, 0x65, 0xb7, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0xad, 0xf9, 0xff, 0x12, 0x8f, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x0e, 0x8d, 0xf6, 0xff, 0x0d, 0x8d, 0xf6, 0xff, 0xae, 0xd9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xc7, 0xfb, 0xff, 0x0a, 0x8c, 0xf6, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfe, 0x1b, 0x96, 0xfd, 0xff, 0x1a, 0x95, 0xf9, 0xdb,
-    0x19, 0x94, 0xf9, 0xb1, 0x1b, 0x9a, 0xff, 0xff, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x18, 0x92, 0xf7, 0xff, 0x20, 0x96, 0xf7, 0xff, 0x83, 0xc4, 0xfb, 0xff, 0x52, 0xad, 0xf9, 0xff, 0xbd, 0xe0, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xf4, 0xfe, 0xff, 0x21, 0x97, 0xf7, 0xff, 0x19, 0x92, 0xf7, 0xff, 0x1f, 0x95, 0xf7, 0xff, 0x25, 0x98, 0xf7, 0xff, 0x0c, 0x8c, 0xf7, 0xff, 0x56, 0xaf, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfc, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xb9, 0xde, 0xfc, 0xff, 0x0e, 0x8d, 0xf6, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xfc, 0x1b, 0x9a, 0xff, 0xff, 0x19, 0x94, 0xf9, 0xb1,
-    0x1a, 0x96, 0xfa, 0x75, 0x1b, 0x9b, 0xff, 0xff, 0x1a, 0x92, 0xf5, 0xfd, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1d, 0x95, 0xf7, 0xff, 0x0c, 0x8c, 0xf7, 0xff, 0x70, 0xbc, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xe7, 0xfd, 0xff, 0x22, 0x97, 0xf7, 0xff, 0x13, 0x90, 0xf7, 0xff, 0x0b, 0x8c, 0xf6, 0xff, 0x0b, 0x8c, 0xf6, 0xff, 0x0a, 0x8b, 0xf6, 0xff, 0xa1, 0xd3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xa7, 0xd5, 0xfc, 0xff, 0x0b, 0x8c, 0xf6, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf5, 0xfd, 0x1b, 0x9b, 0xff, 0xff, 0x1a, 0x96, 0xfa, 0x75,
-    0x1b, 0x95, 0xf9, 0x2e, 0x1a, 0x94, 0xf8, 0xf9, 0x1a, 0x94, 0xf9, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x11, 0x8e, 0xf7, 0xff, 0x8a, 0xc8, 0xfb, 0xff, 0xe2, 0xf1, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xeb, 0xf5, 0xfe, 0xff, 0xc4, 0xe3, 0xfd, 0xff, 0xa3, 0xd3, 0xfc, 0xff, 0x98, 0xcf, 0xfc, 0xff, 0xc7, 0xe4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0xb6, 0xfa, 0xff, 0x0c, 0x8d, 0xf6, 0xff, 0x1d, 0x95, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x94, 0xf9, 0xff, 0x1a, 0x94, 0xf8, 0xf9, 0x1b, 0x95, 0xf9, 0x2e,
-    0x00, 0xff, 0xff, 0x01, 0x1a, 0x95, 0xf8, 0xc1, 0x1b, 0x9a, 0xff, 0xfe, 0x1a, 0x92, 0xf6, 0xfc, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x13, 0x90, 0xf7, 0xff, 0x22, 0x97, 0xf7, 0xff, 0x47, 0xa8, 0xf9, 0xff, 0x83, 0xc4, 0xfb, 0xff, 0xf4, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xe7, 0xfd, 0xff, 0x18, 0x92, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfc, 0x1b, 0x9a, 0xff, 0xfe, 0x1a, 0x95, 0xf8, 0xc1, 0x00, 0xff, 0xff, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x94, 0xf9, 0x5b, 0x1c, 0x9d, 0xff, 0xff, 0x1a, 0x92, 0xf5, 0xfc, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x08, 0x8a, 0xf7, 0xff, 0x2a, 0x9b, 0xf7, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xe6, 0xf3, 0xfe, 0xff, 0x4f, 0xac, 0xf9, 0xff, 0xb6, 0xdd, 0xfc, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xf2, 0xf9, 0xff, 0xff, 0xf7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfb, 0xff, 0xff, 0xb5, 0xdc, 0xfc, 0xff, 0x2b, 0x9b, 0xf7, 0xff, 0x14, 0x90, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf5, 0xfc, 0x1c, 0x9d, 0xff, 0xff, 0x19, 0x94, 0xf9, 0x5b, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x01, 0x24, 0x91, 0xff, 0x07, 0x1a, 0x94, 0xf9, 0xd6, 0x1b, 0x98, 0xfd, 0xfe, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x0d, 0x8d, 0xf6, 0xff, 0x74, 0xbd, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xdb, 0xfc, 0xff, 0x00, 0x80, 0xf5, 0xff, 0xa2, 0xd3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xc0, 0xfa, 0xff, 0x2e, 0x9c, 0xf8, 0xff, 0x52, 0xae, 0xf9, 0xff, 0x50, 0xac, 0xf9, 0xff, 0x37, 0xa1, 0xf8, 0xff, 0x11, 0x8e, 0xf7, 0xff, 0x15, 0x91, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf6, 0xfd, 0x1b, 0x98, 0xfd, 0xfe, 0x1a, 0x93, 0xf9, 0xd6, 0x24, 0x91, 0xff, 0x07, 0x00, 0xff, 0xff, 0x01,
-    0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x95, 0xfb, 0x4b, 0x1c, 0x9b, 0xff, 0xff, 0x1a, 0x93, 0xf7, 0xfb, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1d, 0x95, 0xf7, 0xff, 0x0c, 0x8d, 0xf6, 0xff, 0x8f, 0xca, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xc0, 0xfa, 0xff, 0x13, 0x8f, 0xf7, 0xff, 0xef, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xa3, 0xf8, 0xff, 0x09, 0x8b, 0xf7, 0xff, 0x11, 0x8f, 0xf7, 0xff, 0x0f, 0x8e, 0xf7, 0xff, 0x13, 0x90, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xfb, 0x1c, 0x9b, 0xff, 0xff, 0x1b, 0x95, 0xfb, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x94, 0xf8, 0x9b, 0x1c, 0x9f, 0xff, 0xff, 0x1a, 0x92, 0xf6, 0xfa, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x45, 0xa7, 0xf8, 0xff, 0x27, 0x99, 0xf7, 0xff, 0x2d, 0x9c, 0xf8, 0xff, 0xdd, 0xef, 0xfe, 0xff, 0xda, 0xee, 0xfe, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfa, 0x1c, 0x9f, 0xff, 0xff, 0x1a, 0x95, 0xf8, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x02, 0x19, 0x99, 0xff, 0x0a, 0x1a, 0x97, 0xf9, 0xc8, 0x1c, 0x9c, 0xff, 0xff, 0x1a, 0x92, 0xf5, 0xfb, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x19, 0x92, 0xf7, 0xff, 0x11, 0x8f, 0xf7, 0xff, 0x17, 0x92, 0xf7, 0xff, 0x19, 0x92, 0xf7, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x2f, 0x9d, 0xf8, 0xff, 0x19, 0x92, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf5, 0xfb, 0x1c, 0x9c, 0xff, 0xff, 0x1a, 0x97, 0xf9, 0xc8, 0x19, 0x99, 0xff, 0x0a, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x99, 0xf4, 0x19, 0x1a, 0x98, 0xfb, 0xd5, 0x1c, 0x9c, 0xff, 0xff, 0x1a, 0x92, 0xf6, 0xfa, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x19, 0x92, 0xf7, 0xff, 0x15, 0x91, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfa, 0x1c, 0x9c, 0xff, 0xff, 0x1a, 0x98, 0xfb, 0xd5, 0x1e, 0x99, 0xf4, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x93, 0xf5, 0x1a, 0x1b, 0x99, 0xfb, 0xc6, 0x1c, 0x9e, 0xff, 0xff, 0x1a, 0x92, 0xf6, 0xfc, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x92, 0xf6, 0xfc, 0x1c, 0x9e, 0xff, 0xff, 0x1b, 0x99, 0xfb, 0xc6, 0x1d, 0x93, 0xf5, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x19, 0x99, 0xff, 0x0a, 0x1a, 0x99, 0xfb, 0x99, 0x1c, 0x9b, 0xff, 0xff, 0x1b, 0x98, 0xff, 0xff, 0x1a, 0x92, 0xf5, 0xfc, 0x1a, 0x92, 0xf6, 0xfc, 0x1a, 0x93, 0xf7, 0xfe, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xfe, 0x1a, 0x92, 0xf6, 0xfc, 0x1a, 0x92, 0xf5, 0xfc, 0x1b, 0x98, 0xff, 0xff, 0x1c, 0x9b, 0xff, 0xff, 0x1a, 0x99, 0xfd, 0x99, 0x19, 0x99, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x97, 0xfb, 0x4f, 0x1a, 0x99, 0xfd, 0xd0, 0x1c, 0x9d, 0xff, 0xff, 0x1b, 0x9a, 0xff, 0xff, 0x1a, 0x94, 0xf8, 0xff, 0x1a, 0x92, 0xf5, 0xfd, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x93, 0xf6, 0xfd, 0x1a, 0x92, 0xf5, 0xfd, 0x1a, 0x94, 0xf8, 0xff, 0x1b, 0x9a, 0xff, 0xff, 0x1c, 0x9d, 0xff, 0xff, 0x1a, 0x99, 0xfd, 0xd0, 0x19, 0x97, 0xfb, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x05, 0x1b, 0x9b, 0xff, 0x5c, 0x1a, 0x98, 0xfd, 0xbd, 0x1a, 0x96, 0xf9, 0xf6, 0x1c, 0x9b, 0xff, 0xff, 0x1b, 0x9a, 0xff, 0xff, 0x1b, 0x96, 0xfd, 0xff, 0x1a, 0x94, 0xf8, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x93, 0xf7, 0xff, 0x1a, 0x94, 0xf9, 0xff, 0x1b, 0x96, 0xfd, 0xff, 0x1b, 0x9a, 0xff, 0xff, 0x1c, 0x9b, 0xff, 0xff, 0x1a, 0x97, 0xf9, 0xf6, 0x1a, 0x99, 0xfc, 0xbe, 0x1b, 0x9b, 0xff, 0x5c, 0x00, 0x99, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x9b, 0xff, 0x2e, 0x1a, 0x99, 0xfc, 0x73, 0x1a, 0x98, 0xfa, 0xae, 0x1b, 0x96, 0xfa, 0xd9, 0x1a, 0x94, 0xf8, 0xf4, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x92, 0xf6, 0xfe, 0x1a, 0x94, 0xf8, 0xf4, 0x1b, 0x96, 0xfa, 0xd9, 0x1a, 0x98, 0xfa, 0xae, 0x1a, 0x97, 0xfa, 0x74, 0x1b, 0x9d, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_image_dsc_t img_bitcoin_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_bitcoin_logo_data),
-    .data = img_bitcoin_logo_data,
-};
-
-// ethereum.png -> 36x36 ARGB8888
-static const uint8_t img_ethereum_logo_data[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x71, 0x73, 0x47, 0x47, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0xff, 0xff, 0xff, 0x01, 0xb7, 0xb7, 0xb7, 0x19, 0x7d, 0x7d, 0x7d, 0xf6, 0x35, 0x35, 0x35, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x93, 0x93, 0x93, 0xa3, 0x86, 0x86, 0x86, 0xff, 0x35, 0x35, 0x35, 0xff, 0x35, 0x35, 0x35, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x8b, 0x8b, 0x40, 0x95, 0x95, 0x95, 0xfe, 0x7d, 0x7d, 0x7d, 0xfc, 0x35, 0x35, 0x35, 0xfe, 0x35, 0x35, 0x35, 0xe2, 0x33, 0x33, 0x33, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x03, 0x99, 0x99, 0x99, 0x05, 0x8d, 0x8d, 0x8d, 0xce, 0x95, 0x95, 0x95, 0xff, 0x7d, 0x7d, 0x7d, 0xfc, 0x33, 0x33, 0x33, 0xfb, 0x37, 0x37, 0x37, 0xff, 0x35, 0x35, 0x35, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x8d, 0x8d, 0x6e, 0x95, 0x95, 0x95, 0xff, 0x8e, 0x8e, 0x8e, 0xfc, 0x7d, 0x7d, 0x7d, 0xff, 0x33, 0x33, 0x33, 0xfe, 0x34, 0x34, 0x34, 0xfc, 0x35, 0x35, 0x35, 0xf9, 0x33, 0x33, 0x33, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0xff, 0xff, 0xff, 0x01, 0x93, 0x93, 0x93, 0x1a, 0x8f, 0x8f, 0x8f, 0xed, 0x8e, 0x8e, 0x8e, 0xfd, 0x90, 0x90, 0x90, 0xfd, 0x7d, 0x7d, 0x7d, 0xff, 0x33, 0x33, 0x33, 0xff, 0x33, 0x33, 0x33, 0xfc, 0x37, 0x37, 0x37, 0xff, 0x33, 0x33, 0x33, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x8d, 0x8d, 0xa0, 0x95, 0x95, 0x95, 0xff, 0x8b, 0x8b, 0x8b, 0xfb, 0x8f, 0x8f, 0x8f, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x33, 0x33, 0x33, 0xfc, 0x37, 0x37, 0x37, 0xff, 0x34, 0x34, 0x34, 0x57, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92, 0x3d, 0x91, 0x91, 0x91, 0xfe, 0x8c, 0x8c, 0x8c, 0xfc, 0x8b, 0x8b, 0x8b, 0xfe, 0x8f, 0x8f, 0x8f, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xfd, 0x35, 0x35, 0x35, 0xfe, 0x34, 0x34, 0x34, 0xe1, 0x36, 0x36, 0x36, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0xaa, 0xaa, 0x03, 0x7f, 0x7f, 0x7f, 0x04, 0x8e, 0x8e, 0x8e, 0xcc, 0x92, 0x92, 0x92, 0xff, 0x8c, 0x8c, 0x8c, 0xfc, 0x8b, 0x8b, 0x8b, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x33, 0x33, 0x33, 0xfc, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0x89, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x8e, 0x8e, 0x6b, 0x96, 0x96, 0x96, 0xff, 0x8b, 0x8b, 0x8b, 0xfc, 0x8c, 0x8c, 0x8c, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xfe, 0x34, 0x34, 0x34, 0xfd, 0x35, 0x35, 0x35, 0xf8, 0x35, 0x35, 0x35, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0xff, 0xff, 0xff, 0x01, 0x94, 0x94, 0x94, 0x18, 0x8e, 0x8e, 0x8e, 0xec, 0x8f, 0x8f, 0x8f, 0xfd, 0x8c, 0x8c, 0x8c, 0xfd, 0x8c, 0x8c, 0x8c, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x33, 0x33, 0x33, 0xfc, 0x37, 0x37, 0x37, 0xff, 0x34, 0x34, 0x34, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x8c, 0x8c, 0x9e, 0x95, 0x95, 0x95, 0xff, 0x8c, 0x8c, 0x8c, 0xfb, 0x8c, 0x8c, 0x8c, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x92, 0x92, 0x92, 0xff, 0x82, 0x82, 0x82, 0xff, 0x35, 0x35, 0x35, 0xff, 0x34, 0x34, 0x34, 0xff, 0x33, 0x33, 0x33, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x33, 0x33, 0x33, 0xfc, 0x37, 0x37, 0x37, 0xff, 0x36, 0x36, 0x36, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92, 0x3b, 0x91, 0x91, 0x91, 0xfe, 0x8c, 0x8c, 0x8c, 0xfd, 0x8b, 0x8b, 0x8b, 0xfe, 0x8b, 0x8b, 0x8b, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0x91, 0x91, 0x91, 0xff, 0x85, 0x85, 0x85, 0xff, 0x57, 0x57, 0x57, 0xff, 0x25, 0x25, 0x25, 0xff, 0x33, 0x33, 0x33, 0xff, 0x37, 0x37, 0x37, 0xff, 0x35, 0x35, 0x35, 0xff, 0x33, 0x33, 0x33, 0xff, 0x33, 0x33, 0x33, 0xfd, 0x35, 0x35, 0x35, 0xfe, 0x34, 0x34, 0x34, 0xdf, 0x3a, 0x3a, 0x3a, 0x0d, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0xaa, 0xaa, 0xaa, 0x03, 0x8d, 0x8d, 0x8d, 0xca, 0x91, 0x91, 0x91, 0xff, 0x8b, 0x8b, 0x8b, 0xfc, 0x90, 0x90, 0x90, 0xff, 0x91, 0x91, 0x91, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x59, 0x59, 0x59, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x12, 0x12, 0x12, 0xff, 0x18, 0x18, 0x18, 0xff, 0x25, 0x25, 0x25, 0xff, 0x31, 0x31, 0x31, 0xff, 0x36, 0x36, 0x36, 0xff, 0x35, 0x35, 0x35, 0xff, 0x32, 0x32, 0x32, 0xfc, 0x37, 0x37, 0x37, 0xff, 0x35, 0x35, 0x35, 0x86, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x8a, 0x8a, 0x69, 0x96, 0x96, 0x96, 0xff, 0x90, 0x90, 0x90, 0xfc, 0x8f, 0x8f, 0x8f, 0xff, 0x78, 0x78, 0x78, 0xff, 0x53, 0x53, 0x53, 0xff, 0x38, 0x38, 0x38, 0xff, 0x33, 0x33, 0x33, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x34, 0x34, 0x34, 0xff, 0x14, 0x14, 0x14, 0xff, 0x13, 0x13, 0x13, 0xff, 0x11, 0x11, 0x11, 0xff, 0x16, 0x16, 0x16, 0xff, 0x22, 0x22, 0x22, 0xff, 0x2f, 0x2f, 0x2f, 0xff, 0x36, 0x36, 0x36, 0xfe, 0x36, 0x36, 0x36, 0xfd, 0x34, 0x34, 0x34, 0xf7, 0x31, 0x31, 0x31, 0x29, 0x00, 0x00, 0x00, 0x01, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0xa5, 0x14, 0x96, 0x96, 0x96, 0xea, 0x90, 0x90, 0x90, 0xfd, 0x71, 0x71, 0x71, 0xfe, 0x4c, 0x4c, 0x4c, 0xff, 0x35, 0x35, 0x35, 0xff, 0x34, 0x34, 0x34, 0xff, 0x39, 0x39, 0x39, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x12, 0x12, 0x12, 0xff, 0x14, 0x14, 0x14, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x2d, 0x2d, 0x2d, 0xfc, 0x38, 0x38, 0x38, 0xff, 0x36, 0x36, 0x36, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0xaa, 0xaa, 0xaa, 0x03, 0x83, 0x83, 0x83, 0xa9, 0x73, 0x73, 0x73, 0xff, 0x45, 0x45, 0x45, 0xfa, 0x35, 0x35, 0x35, 0xff, 0x35, 0x35, 0x35, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x39, 0x39, 0x39, 0xff, 0x39, 0x39, 0x39, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xff, 0x12, 0x12, 0x12, 0xff, 0x13, 0x13, 0x13, 0xff, 0x1c, 0x1c, 0x1c, 0xf9, 0x2e, 0x2e, 0x2e, 0xff, 0x31, 0x31, 0x31, 0x62, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x8d, 0x8d, 0x09, 0x49, 0x49, 0x49, 0xab, 0x36, 0x36, 0x36, 0xff, 0x38, 0x38, 0x38, 0xff, 0x39, 0x39, 0x39, 0xfb, 0x3a, 0x3a, 0x3a, 0xfe, 0x39, 0x39, 0x39, 0xff, 0x39, 0x39, 0x39, 0xff, 0x39, 0x39, 0x39, 0xff, 0x39, 0x39, 0x39, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xfd, 0x14, 0x14, 0x14, 0xfd, 0x13, 0x13, 0x13, 0xff, 0x14, 0x14, 0x14, 0xf7, 0x1e, 0x1e, 0x1e, 0x75, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x51, 0x3d, 0x3d, 0x3d, 0xd5, 0x3d, 0x3d, 0x3d, 0xff, 0x39, 0x39, 0x39, 0xff, 0x38, 0x38, 0x38, 0xfc, 0x39, 0x39, 0x39, 0xff, 0x39, 0x39, 0x39, 0xff, 0x39, 0x39, 0x39, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xfe, 0x14, 0x14, 0x14, 0xfc, 0x15, 0x15, 0x15, 0xff, 0x15, 0x15, 0x15, 0xff, 0x16, 0x16, 0x16, 0xb3, 0x12, 0x12, 0x12, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x08, 0x8b, 0x8b, 0x8b, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3e, 0x3e, 0x3e, 0x7e, 0x3b, 0x3b, 0x3b, 0xf2, 0x3d, 0x3d, 0x3d, 0xff, 0x38, 0x38, 0x38, 0xfd, 0x38, 0x38, 0x38, 0xfd, 0x39, 0x39, 0x39, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0x33, 0x33, 0x33, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xfc, 0x14, 0x14, 0x14, 0xff, 0x16, 0x16, 0x16, 0xff, 0x15, 0x15, 0x15, 0xd8, 0x18, 0x18, 0x18, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x39, 0x39, 0x39, 0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0xff, 0xff, 0xff, 0x01, 0x90, 0x90, 0x90, 0x61, 0x8f, 0x8f, 0x8f, 0xae, 0x93, 0x93, 0x93, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x24, 0x3d, 0x3d, 0x3d, 0xaa, 0x3c, 0x3c, 0x3c, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x38, 0x38, 0x38, 0xfc, 0x3a, 0x3a, 0x3a, 0xfe, 0x33, 0x33, 0x33, 0xff, 0x14, 0x14, 0x14, 0xff, 0x14, 0x14, 0x14, 0xfd, 0x14, 0x14, 0x14, 0xfd, 0x15, 0x15, 0x15, 0xff, 0x14, 0x14, 0x14, 0xf3, 0x15, 0x15, 0x15, 0x83, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x3e, 0x3e, 0x41, 0x3d, 0x3d, 0x3d, 0xbc, 0x3d, 0x3d, 0x3d, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x8f, 0x8f, 0xb2, 0x96, 0x96, 0x96, 0xf2, 0x8d, 0x8d, 0x8d, 0x70, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x4b, 0x3c, 0x3c, 0x3c, 0xd0, 0x3c, 0x3c, 0x3c, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0x32, 0x32, 0x32, 0xfb, 0x14, 0x14, 0x14, 0xfc, 0x15, 0x15, 0x15, 0xff, 0x15, 0x15, 0x15, 0xff, 0x15, 0x15, 0x15, 0xaf, 0x12, 0x12, 0x12, 0x29, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0x45, 0x16, 0x3d, 0x3d, 0x3d, 0x96, 0x40, 0x41, 0x41, 0xff, 0x3c, 0x3c, 0x3c, 0x69, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x7f, 0x7f, 0x7f, 0x02, 0x89, 0x89, 0x89, 0x0d, 0x8f, 0x8f, 0x8f, 0xe1, 0x9a, 0x9a, 0x9a, 0xff, 0x8f, 0x8f, 0x8f, 0xcb, 0x8f, 0x8f, 0x8f, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x3d, 0x3d, 0x79, 0x3d, 0x3d, 0x3d, 0xed, 0x36, 0x36, 0x36, 0xff, 0x15, 0x15, 0x15, 0xff, 0x15, 0x15, 0x15, 0xd5, 0x15, 0x15, 0x15, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x6d, 0x3b, 0x3c, 0x3c, 0xe6, 0x43, 0x44, 0x44, 0xff, 0x3b, 0x3c, 0x3c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x8f, 0x8f, 0x40, 0x91, 0x91, 0x91, 0xfb, 0x91, 0x91, 0x91, 0xff, 0x91, 0x91, 0x91, 0xff, 0x90, 0x90, 0x90, 0xa4, 0x99, 0x99, 0x99, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x41, 0x1f, 0x33, 0x33, 0x33, 0xa7, 0x17, 0x17, 0x17, 0x85, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x3d, 0x3d, 0x42, 0x3d, 0x3d, 0x3d, 0xc8, 0x3e, 0x3f, 0x3f, 0xff, 0x3e, 0x3f, 0x3f, 0xff, 0x3c, 0x3d, 0x3d, 0xdd, 0x3c, 0x3c, 0x3c, 0x11, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x8d, 0x8d, 0x87, 0x95, 0x95, 0x95, 0xff, 0x8a, 0x8a, 0x8a, 0xfa, 0x95, 0x95, 0x95, 0xff, 0x91, 0x91, 0x91, 0xed, 0x8f, 0x8f, 0x8f, 0x77, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x1b, 0x3c, 0x3c, 0x3c, 0xa0, 0x3d, 0x3e, 0x3e, 0xff, 0x3e, 0x3f, 0x3f, 0xff, 0x3a, 0x3b, 0x3b, 0xf8, 0x3d, 0x3e, 0x3e, 0xfd, 0x3c, 0x3c, 0x3c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xaa, 0xaa, 0xaa, 0x03, 0xaa, 0xaa, 0xaa, 0x06, 0x8d, 0x8d, 0x8d, 0xcb, 0x93, 0x93, 0x93, 0xff, 0x8b, 0x8b, 0x8b, 0xf9, 0x8e, 0x8e, 0x8e, 0xff, 0x96, 0x96, 0x96, 0xff, 0x8f, 0x8f, 0x8f, 0xd1, 0x8d, 0x8d, 0x8d, 0x4a, 0x38, 0x38, 0x38, 0x6c, 0x3d, 0x3e, 0x3e, 0xeb, 0x3f, 0x40, 0x40, 0xff, 0x3b, 0x3c, 0x3c, 0xfe, 0x3a, 0x3b, 0x3b, 0xf9, 0x3f, 0x40, 0x40, 0xff, 0x3b, 0x3c, 0x3c, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x94, 0x94, 0x94, 0x2b, 0x91, 0x91, 0x91, 0xf5, 0x8e, 0x8e, 0x8e, 0xfd, 0x8c, 0x8c, 0x8c, 0xfd, 0x8a, 0x8a, 0x8a, 0xfc, 0x95, 0x95, 0x95, 0xff, 0x84, 0x84, 0x84, 0xff, 0x3c, 0x3d, 0x3d, 0xff, 0x3c, 0x3d, 0x3d, 0xff, 0x3a, 0x3b, 0x3b, 0xfc, 0x3a, 0x3b, 0x3b, 0xfc, 0x3d, 0x3e, 0x3e, 0xff, 0x3c, 0x3d, 0x3d, 0xcc, 0x55, 0x55, 0x55, 0x06, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x8e, 0x8e, 0x6b, 0x96, 0x96, 0x96, 0xff, 0x8c, 0x8c, 0x8c, 0xfb, 0x8b, 0x8b, 0x8b, 0xff, 0x8f, 0x8f, 0x8f, 0xfd, 0x7e, 0x7e, 0x7e, 0xfe, 0x3a, 0x3a, 0x3a, 0xfd, 0x3b, 0x3c, 0x3c, 0xfe, 0x3b, 0x3c, 0x3c, 0xfe, 0x3b, 0x3c, 0x3c, 0xfc, 0x3d, 0x3e, 0x3e, 0xf6, 0x3e, 0x3e, 0x3e, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x8e, 0x8e, 0xb3, 0x94, 0x94, 0x94, 0xff, 0x8a, 0x8a, 0x8a, 0xfc, 0x8f, 0x8f, 0x8f, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x3a, 0x3b, 0x3b, 0xff, 0x3b, 0x3c, 0x3c, 0xff, 0x3a, 0x3b, 0x3b, 0xfb, 0x3f, 0x40, 0x40, 0xff, 0x3c, 0x3c, 0x3c, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x01, 0x8e, 0x8e, 0x8e, 0x19, 0x8f, 0x8f, 0x8f, 0xe8, 0x8e, 0x8e, 0x8e, 0xfe, 0x8f, 0x8f, 0x8f, 0xfd, 0x7f, 0x7f, 0x7f, 0xff, 0x3a, 0x3b, 0x3b, 0xff, 0x3a, 0x3b, 0x3b, 0xfc, 0x3e, 0x3f, 0x3f, 0xff, 0x3b, 0x3c, 0x3c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x8d, 0x8d, 0x51, 0x93, 0x93, 0x93, 0xff, 0x8f, 0x8f, 0x8f, 0xfb, 0x7e, 0x7f, 0x7f, 0xff, 0x3a, 0x3b, 0x3b, 0xfd, 0x3c, 0x3d, 0x3d, 0xfd, 0x3d, 0x3d, 0x3d, 0xea, 0x38, 0x42, 0x42, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x8c, 0x8c, 0x99, 0x99, 0x99, 0x99, 0xff, 0x7d, 0x7d, 0x7d, 0xfb, 0x3a, 0x3b, 0x3b, 0xfb, 0x3e, 0x3f, 0x3f, 0xff, 0x3d, 0x3d, 0x3d, 0x53, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x7f, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x0c, 0x93, 0x93, 0x93, 0xd8, 0x83, 0x83, 0x83, 0xfe, 0x3d, 0x3e, 0x3e, 0xff, 0x3a, 0x3c, 0x3c, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xa0, 0xa0, 0x36, 0x82, 0x82, 0x82, 0xff, 0x3b, 0x3c, 0x3c, 0xd7, 0x3a, 0x3a, 0x3a, 0x0d, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x71, 0x84, 0x49, 0x49, 0x49, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_image_dsc_t img_ethereum_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_ethereum_logo_data),
-    .data = img_ethereum_logo_data,
-};
-
-// paxg.png -> 36x36 ARGB8888
-static const uint8_t img_paxg_logo_data[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0c, 0x0d, 0xf1, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x03, 0x00, 0xbf, 0xff, 0x04, 0x00, 0xbf, 0xbf, 0x04, 0x00, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0xf3, 0xf9, 0x5a, 0x09, 0xee, 0xf3, 0xb4, 0x0a, 0xeb, 0xf1, 0xdd, 0x0a, 0xec, 0xf2, 0xe2, 0x0a, 0xed, 0xf3, 0xcc, 0x0b, 0xf2, 0xf9, 0x8a, 0x0d, 0xf1, 0xf8, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x27, 0x09, 0xf4, 0xf8, 0xc2, 0x0a, 0xfb, 0xff, 0xff, 0x0a, 0xf6, 0xfb, 0xff, 0x0a, 0xef, 0xf4, 0xff, 0x0a, 0xed, 0xf3, 0xff, 0x0b, 0xf0, 0xf6, 0xff, 0x0b, 0xf8, 0xfe, 0xff, 0x0a, 0xef, 0xf5, 0xf6, 0x09, 0xf1, 0xf7, 0x82, 0x00, 0xe2, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf2, 0xff, 0x14, 0x13, 0xf2, 0xf8, 0x4f, 0x12, 0xf2, 0xf6, 0x79, 0x10, 0xf2, 0xf6, 0x8f, 0x15, 0xdd, 0xeb, 0x90, 0x15, 0xd2, 0xe6, 0xe6, 0x12, 0xe2, 0xf3, 0xff, 0x10, 0xd8, 0xe6, 0xf9, 0x0e, 0xdd, 0xe9, 0xfa, 0x0c, 0xe2, 0xeb, 0xfc, 0x0a, 0xe5, 0xec, 0xfd, 0x09, 0xe8, 0xed, 0xfd, 0x09, 0xe8, 0xed, 0xfb, 0x0a, 0xe9, 0xee, 0xff, 0x0b, 0xf6, 0xfd, 0xff, 0x0a, 0xec, 0xf2, 0xd4, 0x0a, 0xf4, 0xf9, 0x5e, 0x13, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xbf, 0xbf, 0x04, 0x00, 0xff, 0xff, 0x04, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x03, 0x12, 0xf0, 0xf8, 0x7f, 0x12, 0xf0, 0xf8, 0xe9, 0x13, 0xf4, 0xfb, 0xff, 0x13, 0xfa, 0xff, 0xff, 0x15, 0xef, 0xfa, 0xff, 0x1d, 0xd1, 0xed, 0xff, 0x1e, 0xc3, 0xe0, 0xff, 0x1d, 0xbe, 0xdb, 0xfc, 0x1d, 0xbf, 0xdd, 0xff, 0x1d, 0xbf, 0xdd, 0xfe, 0x1c, 0xc2, 0xdd, 0xfe, 0x19, 0xc6, 0xdf, 0xfe, 0x16, 0xce, 0xe2, 0xfe, 0x11, 0xd8, 0xe7, 0xfe, 0x0c, 0xe2, 0xeb, 0xfe, 0x08, 0xe9, 0xed, 0xfc, 0x09, 0xf2, 0xf7, 0xff, 0x0b, 0xf5, 0xfb, 0xff, 0x0b, 0xeb, 0xf1, 0xe1, 0x0b, 0xeb, 0xf3, 0x9e, 0x0a, 0xf1, 0xf6, 0x5d, 0x0b, 0xf3, 0xf9, 0x2c, 0x00, 0xe9, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x01, 0x00, 0x00, 0x11, 0xea, 0xf2, 0xa2, 0x14, 0xff, 0xff, 0xff, 0x12, 0xea, 0xf1, 0xff, 0x11, 0xe8, 0xef, 0xfc, 0x13, 0xe2, 0xeb, 0xfb, 0x1b, 0xc3, 0xdd, 0xfb, 0x1c, 0xc0, 0xdc, 0xfc, 0x1c, 0xc2, 0xdd, 0xfe, 0x1c, 0xc2, 0xde, 0xff, 0x1b, 0xc3, 0xdf, 0xff, 0x1b, 0xc5, 0xe0, 0xff, 0x1b, 0xc3, 0xdf, 0xff, 0x1d, 0xc0, 0xdd, 0xfe, 0x1f, 0xbc, 0xda, 0xfe, 0x20, 0xb9, 0xd8, 0xfe, 0x1e, 0xbb, 0xd9, 0xfe, 0x19, 0xc7, 0xde, 0xfd, 0x10, 0xd9, 0xe5, 0xfc, 0x0a, 0xe6, 0xec, 0xfc, 0x08, 0xef, 0xf4, 0xff, 0x09, 0xf7, 0xfc, 0xff, 0x0b, 0xf5, 0xfb, 0xff, 0x0b, 0xe8, 0xef, 0xfd, 0x0a, 0xe9, 0xef, 0xe3, 0x0a, 0xec, 0xf3, 0xc0, 0x0a, 0xeb, 0xf1, 0x99, 0x0b, 0xee, 0xf5, 0x6e, 0x0a, 0xef, 0xf4, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x11, 0xed, 0xf6, 0x58, 0x13, 0xfa, 0xff, 0xff, 0x12, 0xe6, 0xee, 0xfa, 0x12, 0xe9, 0xef, 0xfd, 0x12, 0xe7, 0xee, 0xfe, 0x1a, 0xc7, 0xe0, 0xfe, 0x1d, 0xc0, 0xdd, 0xff, 0x1c, 0xc2, 0xde, 0xff, 0x1c, 0xc3, 0xdf, 0xff, 0x1b, 0xc4, 0xdf, 0xff, 0x1d, 0xbf, 0xdb, 0xfc, 0x20, 0xb6, 0xd6, 0xfa, 0x23, 0xae, 0xcf, 0xfc, 0x25, 0xa9, 0xcd, 0xfd, 0x26, 0xa7, 0xcb, 0xfd, 0x27, 0xa6, 0xcb, 0xfb, 0x27, 0xa4, 0xca, 0xfc, 0x28, 0xa4, 0xca, 0xfe, 0x27, 0xa5, 0xcb, 0xfe, 0x22, 0xb4, 0xd3, 0xfd, 0x1a, 0xcf, 0xe3, 0xfc, 0x10, 0xe1, 0xec, 0xfb, 0x09, 0xe6, 0xeb, 0xfc, 0x09, 0xe9, 0xee, 0xff, 0x0b, 0xec, 0xf3, 0xff, 0x0b, 0xf2, 0xf8, 0xff, 0x0b, 0xf6, 0xfd, 0xff, 0x0b, 0xf6, 0xfd, 0xff, 0x0a, 0xef, 0xf5, 0xfe, 0x09, 0xed, 0xf3, 0x9c, 0x00, 0xd4, 0xff, 0x06, 0x00, 0xff, 0xff, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x02, 0x11, 0xea, 0xf1, 0xc9, 0x13, 0xf2, 0xf9, 0xfe, 0x12, 0xe7, 0xee, 0xfc, 0x11, 0xea, 0xf0, 0xff, 0x18, 0xce, 0xe3, 0xfe, 0x1d, 0xbf, 0xdd, 0xff, 0x1c, 0xc3, 0xde, 0xff, 0x1b, 0xc4, 0xe0, 0xff, 0x1d, 0xbd, 0xda, 0xfd, 0x23, 0xaf, 0xd1, 0xfd, 0x28, 0xad, 0xd3, 0xff, 0x2b, 0xb0, 0xd9, 0xff, 0x2a, 0xaf, 0xd7, 0xff, 0x29, 0xac, 0xd3, 0xff, 0x29, 0xae, 0xd5, 0xff, 0x29, 0xb2, 0xd9, 0xff, 0x29, 0xb1, 0xd8, 0xff, 0x27, 0xa9, 0xce, 0xff, 0x26, 0xa6, 0xcb, 0xfc, 0x28, 0xa4, 0xca, 0xff, 0x28, 0xa5, 0xcb, 0xff, 0x25, 0xbc, 0xdb, 0xfe, 0x1e, 0xd2, 0xe8, 0xff, 0x11, 0xde, 0xea, 0xfe, 0x08, 0xe9, 0xed, 0xfd, 0x0a, 0xe7, 0xed, 0xfc, 0x0a, 0xe6, 0xec, 0xfb, 0x0a, 0xe6, 0xec, 0xfb, 0x0a, 0xe6, 0xec, 0xfc, 0x0b, 0xff, 0xff, 0xff, 0x09, 0xed, 0xf3, 0x81, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf2, 0xf8, 0x28, 0x12, 0xeb, 0xf2, 0xfb, 0x12, 0xe7, 0xef, 0xff, 0x11, 0xea, 0xf0, 0xff, 0x15, 0xda, 0xe8, 0xfe, 0x1d, 0xbf, 0xdc, 0xff, 0x1c, 0xc3, 0xdf, 0xff, 0x1b, 0xc3, 0xde, 0xff, 0x21, 0xb3, 0xd3, 0xfc, 0x29, 0xac, 0xd3, 0xff, 0x2a, 0xad, 0xd5, 0xff, 0x27, 0xa9, 0xcf, 0xd1, 0x27, 0xab, 0xd2, 0x89, 0x29, 0xac, 0xd3, 0x57, 0x27, 0xaf, 0xd3, 0x40, 0x28, 0xad, 0xd2, 0x45, 0x28, 0xab, 0xcf, 0x65, 0x27, 0xac, 0xd2, 0xa6, 0x28, 0xab, 0xd0, 0xf1, 0x29, 0xb1, 0xd8, 0xff, 0x26, 0xa7, 0xcb, 0xfd, 0x27, 0xa7, 0xcb, 0xff, 0x27, 0xa5, 0xca, 0xff, 0x25, 0xbb, 0xda, 0xfe, 0x23, 0xcc, 0xe6, 0xff, 0x19, 0xd5, 0xe7, 0xff, 0x0a, 0xe7, 0xed, 0xff, 0x09, 0xe8, 0xed, 0xff, 0x0a, 0xe7, 0xed, 0xff, 0x0a, 0xe6, 0xec, 0xfd, 0x0a, 0xed, 0xf3, 0xfc, 0x0a, 0xe9, 0xef, 0xe5, 0x0f, 0xef, 0xef, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x12, 0xef, 0xf4, 0x61, 0x13, 0xf7, 0xfe, 0xff, 0x12, 0xe7, 0xee, 0xfc, 0x12, 0xe5, 0xed, 0xff, 0x1b, 0xc4, 0xde, 0xfe, 0x1c, 0xc2, 0xdf, 0xff, 0x1d, 0xc0, 0xdd, 0xff, 0x24, 0xad, 0xcf, 0xfc, 0x2b, 0xaf, 0xd7, 0xff, 0x28, 0xac, 0xd2, 0xd2, 0x29, 0xb1, 0xd8, 0x4f, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xb1, 0xd8, 0x21, 0x28, 0xad, 0xd4, 0xa3, 0x29, 0xb0, 0xd7, 0xff, 0x27, 0xa7, 0xcc, 0xfd, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa6, 0xca, 0xff, 0x23, 0xc1, 0xde, 0xfe, 0x24, 0xcb, 0xe6, 0xff, 0x1e, 0xce, 0xe6, 0xff, 0x0d, 0xe3, 0xec, 0xff, 0x09, 0xe9, 0xed, 0xff, 0x0a, 0xe6, 0xed, 0xff, 0x0a, 0xe7, 0xed, 0xff, 0x0a, 0xe8, 0xee, 0xfc, 0x09, 0xe6, 0xeb, 0x35,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x12, 0xec, 0xf3, 0x95, 0x13, 0xf7, 0xff, 0xff, 0x11, 0xea, 0xf0, 0xfb, 0x18, 0xd2, 0xe5, 0xfe, 0x1d, 0xc0, 0xdd, 0xff, 0x1d, 0xc1, 0xdd, 0xff, 0x25, 0xab, 0xce, 0xfc, 0x2a, 0xaf, 0xd7, 0xff, 0x27, 0xae, 0xd4, 0x9b, 0x33, 0xb2, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0xbf, 0x04, 0x55, 0xaa, 0xff, 0x03, 0x00, 0xaa, 0xaa, 0x03, 0x00, 0xaa, 0xaa, 0x03, 0x3f, 0x7f, 0xbf, 0x04, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xaa, 0xd1, 0x7c, 0x29, 0xb0, 0xd7, 0xff, 0x26, 0xa7, 0xcc, 0xfc, 0x27, 0xa6, 0xcc, 0xff, 0x26, 0xab, 0xce, 0xfe, 0x22, 0xca, 0xe4, 0xfe, 0x23, 0xca, 0xe5, 0xff, 0x21, 0xcc, 0xe5, 0xff, 0x0e, 0xe2, 0xeb, 0xff, 0x09, 0xe8, 0xed, 0xff, 0x0a, 0xe6, 0xed, 0xff, 0x0a, 0xea, 0xf0, 0xff, 0x07, 0xe7, 0xef, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x12, 0xeb, 0xf1, 0xc3, 0x13, 0xf4, 0xfb, 0xff, 0x13, 0xe3, 0xec, 0xfc, 0x1c, 0xc3, 0xde, 0xfe, 0x1c, 0xc2, 0xde, 0xff, 0x25, 0xac, 0xcf, 0xfc, 0x2a, 0xb0, 0xd8, 0xff, 0x27, 0xac, 0xd2, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x3f, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x27, 0xa9, 0xcf, 0x9b, 0x29, 0xb1, 0xd9, 0xff, 0x26, 0xa6, 0xcc, 0xfc, 0x27, 0xa4, 0xca, 0xff, 0x24, 0xbb, 0xd9, 0xfe, 0x21, 0xce, 0xe7, 0xff, 0x23, 0xca, 0xe5, 0xff, 0x21, 0xcc, 0xe5, 0xff, 0x0d, 0xe3, 0xeb, 0xfe, 0x09, 0xe9, 0xee, 0xff, 0x0a, 0xe7, 0xee, 0xfa, 0x0b, 0xee, 0xf3, 0x2e,
-    0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xef, 0xff, 0x10, 0x12, 0xe9, 0xf0, 0xe9, 0x12, 0xef, 0xf5, 0xff, 0x17, 0xd3, 0xe5, 0xfd, 0x1c, 0xc1, 0xde, 0xff, 0x22, 0xb3, 0xd3, 0xfc, 0x2a, 0xad, 0xd5, 0xff, 0x27, 0xaa, 0xd1, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xff, 0x03, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x7f, 0x7f, 0x02, 0x2f, 0xaf, 0xcf, 0x10, 0x27, 0xaa, 0xd0, 0xe7, 0x28, 0xab, 0xd0, 0xfe, 0x27, 0xa5, 0xca, 0xfe, 0x26, 0xad, 0xd0, 0xfe, 0x22, 0xcb, 0xe5, 0xff, 0x22, 0xcb, 0xe5, 0xff, 0x23, 0xc9, 0xe5, 0xff, 0x1f, 0xce, 0xe5, 0xfd, 0x0b, 0xeb, 0xf2, 0xff, 0x0a, 0xea, 0xf0, 0xe4, 0x0f, 0xef, 0xef, 0x10,
-    0x00, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x12, 0xf1, 0xf5, 0x37, 0x13, 0xee, 0xf5, 0xfe, 0x12, 0xe6, 0xed, 0xfe, 0x1a, 0xc7, 0xe0, 0xfe, 0x1f, 0xbb, 0xd9, 0xfe, 0x28, 0xa7, 0xcc, 0xfe, 0x28, 0xac, 0xd2, 0xf4, 0x2a, 0xaa, 0xd4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x26, 0xa8, 0xcf, 0x85, 0x2a, 0xb3, 0xda, 0xff, 0x27, 0xa6, 0xcc, 0xfb, 0x27, 0xa7, 0xcc, 0xff, 0x22, 0xc5, 0xe0, 0xfe, 0x22, 0xcc, 0xe6, 0xff, 0x22, 0xcb, 0xe5, 0xff, 0x24, 0xc8, 0xe4, 0xfc, 0x1b, 0xe1, 0xf5, 0xff, 0x08, 0xec, 0xf0, 0xb0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x04, 0x00, 0xff, 0xff, 0x01, 0x12, 0xec, 0xf3, 0x6f, 0x13, 0xfa, 0xff, 0xff, 0x14, 0xdd, 0xea, 0xfa, 0x1c, 0xc2, 0xde, 0xff, 0x23, 0xaf, 0xd2, 0xfb, 0x2a, 0xb0, 0xd8, 0xff, 0x26, 0xa8, 0xce, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x25, 0xad, 0xd3, 0x2f, 0x27, 0xab, 0xd1, 0xfc, 0x27, 0xa7, 0xcc, 0xfe, 0x27, 0xa4, 0xca, 0xfe, 0x24, 0xbf, 0xdc, 0xfe, 0x22, 0xcd, 0xe7, 0xff, 0x22, 0xca, 0xe5, 0xff, 0x22, 0xcb, 0xe4, 0xfb, 0x24, 0xdb, 0xf6, 0xff, 0x17, 0xdd, 0xee, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x12, 0xeb, 0xf2, 0xb4, 0x12, 0xf7, 0xfd, 0xff, 0x17, 0xd3, 0xe5, 0xfb, 0x1f, 0xbb, 0xd9, 0xff, 0x26, 0xa7, 0xcb, 0xfd, 0x28, 0xae, 0xd5, 0xff, 0x29, 0xac, 0xd2, 0x44, 0x00, 0xff, 0xff, 0x01, 0x55, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x99, 0xcc, 0x05, 0x26, 0xa8, 0xce, 0xd8, 0x28, 0xad, 0xd3, 0xff, 0x27, 0xa4, 0xca, 0xfd, 0x24, 0xba, 0xd9, 0xfe, 0x22, 0xce, 0xe7, 0xff, 0x22, 0xca, 0xe5, 0xff, 0x22, 0xca, 0xe4, 0xfd, 0x21, 0xd4, 0xee, 0xff, 0x0c, 0xe6, 0xed, 0xd0, 0x00, 0xe5, 0xe5, 0x0a,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0xf4, 0xf4, 0x18, 0x11, 0xea, 0xf2, 0xf2, 0x12, 0xeb, 0xf1, 0xff, 0x19, 0xcc, 0xe2, 0xfd, 0x22, 0xb3, 0xd4, 0xfe, 0x28, 0xa8, 0xce, 0xff, 0x27, 0xa8, 0xce, 0xef, 0x2c, 0xa6, 0xd2, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x27, 0xaa, 0xd0, 0xae, 0x29, 0xb1, 0xd8, 0xff, 0x27, 0xa3, 0xc9, 0xfc, 0x24, 0xb8, 0xd7, 0xfe, 0x22, 0xce, 0xe7, 0xff, 0x22, 0xcb, 0xe5, 0xff, 0x24, 0xc9, 0xe4, 0xff, 0x17, 0xd5, 0xe6, 0xfd, 0x09, 0xf5, 0xf9, 0xff, 0x0b, 0xeb, 0xf1, 0x5c,
-    0x00, 0x00, 0x00, 0x00, 0x13, 0xee, 0xf5, 0x6b, 0x13, 0xfa, 0xff, 0xff, 0x12, 0xe4, 0xed, 0xfb, 0x1b, 0xc6, 0xdf, 0xfe, 0x24, 0xad, 0xd0, 0xfd, 0x29, 0xab, 0xd2, 0xff, 0x26, 0xa8, 0xcd, 0xda, 0x33, 0x99, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x27, 0xa7, 0xcd, 0x94, 0x2a, 0xb3, 0xda, 0xff, 0x27, 0xa4, 0xca, 0xfb, 0x24, 0xb8, 0xd7, 0xfe, 0x22, 0xce, 0xe7, 0xff, 0x22, 0xcb, 0xe5, 0xff, 0x22, 0xcb, 0xe4, 0xff, 0x0d, 0xe3, 0xeb, 0xfc, 0x0a, 0xf2, 0xf7, 0xfe, 0x09, 0xe9, 0xf0, 0xb6,
-    0x00, 0xff, 0xff, 0x05, 0x12, 0xeb, 0xf1, 0xce, 0x13, 0xf3, 0xfa, 0xff, 0x13, 0xe2, 0xec, 0xfc, 0x1c, 0xc1, 0xdc, 0xfe, 0x26, 0xa9, 0xcd, 0xfd, 0x29, 0xac, 0xd3, 0xff, 0x27, 0xa8, 0xcd, 0xd7, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x27, 0xa5, 0xcb, 0x8f, 0x2a, 0xb3, 0xdb, 0xff, 0x27, 0xa4, 0xca, 0xfb, 0x24, 0xbb, 0xda, 0xfe, 0x21, 0xce, 0xe7, 0xff, 0x24, 0xc8, 0xe4, 0xff, 0x17, 0xd7, 0xe7, 0xfe, 0x08, 0xe8, 0xed, 0xff, 0x0a, 0xe9, 0xf0, 0xff, 0x09, 0xe9, 0xef, 0xeb,
-    0x13, 0xef, 0xf3, 0x43, 0x13, 0xed, 0xf3, 0xfe, 0x12, 0xe9, 0xef, 0xfe, 0x13, 0xe1, 0xeb, 0xfe, 0x1e, 0xbd, 0xdb, 0xfe, 0x27, 0xa7, 0xcb, 0xfe, 0x28, 0xaa, 0xd0, 0xff, 0x27, 0xa8, 0xce, 0xe7, 0x2f, 0xaf, 0xcf, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x28, 0xaa, 0xd0, 0x9f, 0x2a, 0xb2, 0xd9, 0xff, 0x27, 0xa5, 0xcb, 0xfb, 0x23, 0xc1, 0xde, 0xfe, 0x23, 0xcc, 0xe6, 0xff, 0x1f, 0xcc, 0xe5, 0xfe, 0x0b, 0xe6, 0xec, 0xff, 0x0a, 0xe7, 0xed, 0xff, 0x0a, 0xe7, 0xed, 0xff, 0x0a, 0xe6, 0xec, 0xfe,
-    0x12, 0xed, 0xf3, 0x95, 0x13, 0xf4, 0xfb, 0xff, 0x11, 0xe9, 0xef, 0xfc, 0x13, 0xe1, 0xeb, 0xfe, 0x1e, 0xbc, 0xd9, 0xfe, 0x27, 0xa6, 0xcc, 0xff, 0x27, 0xa6, 0xcb, 0xfe, 0x28, 0xab, 0xd2, 0xfd, 0x27, 0xab, 0xd2, 0x34, 0x00, 0xff, 0xff, 0x01, 0x00, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x27, 0xa9, 0xce, 0xc7, 0x29, 0xae, 0xd5, 0xff, 0x26, 0xa8, 0xcd, 0xfc, 0x22, 0xc8, 0xe3, 0xfe, 0x23, 0xca, 0xe5, 0xff, 0x11, 0xde, 0xe9, 0xfe, 0x08, 0xe9, 0xee, 0xff, 0x0a, 0xe6, 0xed, 0xff, 0x0a, 0xe8, 0xee, 0xff, 0x0a, 0xe9, 0xef, 0xf5,
-    0x12, 0xea, 0xf1, 0xd4, 0x13, 0xee, 0xf5, 0xff, 0x12, 0xe8, 0xee, 0xfe, 0x13, 0xe4, 0xed, 0xfd, 0x1e, 0xbc, 0xd9, 0xfe, 0x27, 0xa6, 0xcc, 0xff, 0x26, 0xa7, 0xcc, 0xfb, 0x2a, 0xb3, 0xda, 0xff, 0x26, 0xaa, 0xce, 0x84, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x27, 0xaf, 0xcf, 0x20, 0x27, 0xaa, 0xd0, 0xf5, 0x28, 0xa6, 0xcc, 0xff, 0x25, 0xb1, 0xd2, 0xfe, 0x24, 0xca, 0xe6, 0xff, 0x18, 0xd6, 0xe7, 0xfe, 0x08, 0xe9, 0xed, 0xff, 0x0a, 0xe7, 0xed, 0xff, 0x0a, 0xe6, 0xec, 0xfd, 0x0a, 0xef, 0xf5, 0xfe, 0x0a, 0xea, 0xf0, 0xc4,
-    0x12, 0xe9, 0xf0, 0xf7, 0x12, 0xe9, 0xf0, 0xff, 0x12, 0xe8, 0xef, 0xff, 0x12, 0xe6, 0xee, 0xfe, 0x1c, 0xc1, 0xdc, 0xfd, 0x27, 0xa6, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xfd, 0x28, 0xaa, 0xd0, 0xfe, 0x27, 0xab, 0xd1, 0xe7, 0x2a, 0xaa, 0xd4, 0x12, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x99, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x27, 0xa8, 0xcd, 0x82, 0x2a, 0xb3, 0xdb, 0xff, 0x26, 0xa4, 0xca, 0xfb, 0x25, 0xbe, 0xdc, 0xfe, 0x1c, 0xd2, 0xe7, 0xfe, 0x0a, 0xe6, 0xec, 0xfe, 0x0a, 0xe7, 0xed, 0xff, 0x0a, 0xe6, 0xec, 0xfe, 0x0a, 0xe7, 0xed, 0xfb, 0x0b, 0xf3, 0xf9, 0xff, 0x09, 0xef, 0xf5, 0x51,
-    0x12, 0xe8, 0xef, 0xff, 0x12, 0xe8, 0xef, 0xff, 0x12, 0xe8, 0xef, 0xff, 0x11, 0xe9, 0xef, 0xfe, 0x1a, 0xc9, 0xe1, 0xfc, 0x27, 0xa7, 0xcd, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x26, 0xa6, 0xcb, 0xfc, 0x2a, 0xb1, 0xd9, 0xff, 0x28, 0xaa, 0xce, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x33, 0x99, 0xcc, 0x05, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa5, 0xce, 0x25, 0x28, 0xad, 0xd3, 0xf0, 0x27, 0xa8, 0xce, 0xfd, 0x27, 0xad, 0xd0, 0xfd, 0x1f, 0xce, 0xe6, 0xfe, 0x0b, 0xe5, 0xec, 0xfe, 0x09, 0xe8, 0xed, 0xff, 0x0a, 0xe5, 0xeb, 0xfc, 0x0a, 0xe6, 0xec, 0xfd, 0x0b, 0xfe, 0xff, 0xff, 0x0a, 0xea, 0xf1, 0x93, 0x00, 0x00, 0x00, 0x00,
-    0x12, 0xe8, 0xef, 0xf9, 0x12, 0xe8, 0xef, 0xff, 0x12, 0xe7, 0xef, 0xff, 0x11, 0xeb, 0xf0, 0xff, 0x16, 0xd8, 0xe8, 0xfb, 0x25, 0xa9, 0xce, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa6, 0xcc, 0xfc, 0x29, 0xb0, 0xd8, 0xff, 0x28, 0xac, 0xd2, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xbf, 0xbf, 0x04, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x3f, 0xbf, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x28, 0xae, 0xd6, 0x13, 0x27, 0xad, 0xd3, 0xce, 0x28, 0xae, 0xd4, 0xff, 0x28, 0xa4, 0xc9, 0xfd, 0x21, 0xc4, 0xdf, 0xfe, 0x0d, 0xe5, 0xed, 0xfe, 0x09, 0xe7, 0xec, 0xfc, 0x0a, 0xe6, 0xec, 0xff, 0x0b, 0xf4, 0xfb, 0xff, 0x0b, 0xef, 0xf5, 0xfe, 0x0b, 0xef, 0xf5, 0x87, 0x00, 0x01, 0x01, 0x00, 0x00, 0xff, 0xff, 0x02,
-    0x12, 0xeb, 0xf1, 0xcd, 0x13, 0xef, 0xf6, 0xfe, 0x12, 0xe7, 0xee, 0xfd, 0x12, 0xe9, 0xf0, 0xff, 0x12, 0xe7, 0xee, 0xfc, 0x21, 0xb5, 0xd4, 0xfc, 0x28, 0xa5, 0xcb, 0xff, 0x27, 0xa8, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xfe, 0x27, 0xa7, 0xcd, 0xfc, 0x29, 0xb0, 0xd7, 0xff, 0x27, 0xaf, 0xd5, 0x8d, 0x38, 0xc6, 0xe2, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x55, 0xaa, 0xff, 0x03, 0x55, 0xaa, 0xff, 0x03, 0x00, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xaf, 0xd7, 0x33, 0x28, 0xad, 0xd4, 0xd1, 0x28, 0xb1, 0xd7, 0xff, 0x28, 0xa1, 0xc7, 0xfd, 0x22, 0xbc, 0xd9, 0xfe, 0x0d, 0xe5, 0xed, 0xfc, 0x08, 0xe6, 0xeb, 0xfe, 0x0b, 0xf4, 0xfb, 0xff, 0x0a, 0xec, 0xf2, 0xfb, 0x0a, 0xf0, 0xf7, 0xad, 0x08, 0xed, 0xf6, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x12, 0xec, 0xf4, 0x62, 0x13, 0xf6, 0xfe, 0xff, 0x12, 0xe7, 0xee, 0xfa, 0x12, 0xe7, 0xee, 0xfe, 0x11, 0xec, 0xf1, 0xff, 0x18, 0xd1, 0xe4, 0xf9, 0x28, 0xa3, 0xca, 0xfe, 0x27, 0xa8, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa6, 0xcb, 0xfd, 0x29, 0xb2, 0xd9, 0xff, 0x27, 0xac, 0xd2, 0xd4, 0x27, 0xab, 0xd2, 0x62, 0x21, 0xb1, 0xd2, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x26, 0xab, 0xd2, 0x2e, 0x28, 0xaf, 0xd4, 0x90, 0x27, 0xab, 0xd1, 0xf8, 0x28, 0xae, 0xd4, 0xff, 0x29, 0xa0, 0xc8, 0xfc, 0x20, 0xbc, 0xd7, 0xfe, 0x0b, 0xe5, 0xec, 0xfb, 0x09, 0xef, 0xf5, 0xff, 0x0b, 0xef, 0xf6, 0xff, 0x0a, 0xed, 0xf4, 0xaa, 0x0a, 0xf4, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x02, 0x12, 0xec, 0xf2, 0xa9, 0x14, 0xff, 0xff, 0xff, 0x12, 0xe7, 0xee, 0xfb, 0x12, 0xe7, 0xee, 0xfc, 0x11, 0xe9, 0xef, 0xfc, 0x23, 0xb3, 0xd3, 0xfa, 0x28, 0xa5, 0xcb, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x26, 0xa5, 0xcb, 0xfc, 0x28, 0xac, 0xd3, 0xff, 0x29, 0xb1, 0xd8, 0xff, 0x28, 0xaa, 0xcf, 0xeb, 0x27, 0xaa, 0xcf, 0xbc, 0x27, 0xab, 0xd1, 0x9c, 0x27, 0xad, 0xd3, 0x93, 0x27, 0xa9, 0xce, 0xa7, 0x27, 0xaa, 0xd0, 0xcf, 0x27, 0xa9, 0xce, 0xfd, 0x29, 0xb3, 0xda, 0xff, 0x29, 0xa5, 0xcc, 0xff, 0x28, 0xa3, 0xca, 0xfc, 0x1a, 0xc6, 0xdd, 0xfc, 0x09, 0xe9, 0xee, 0xfb, 0x0a, 0xf7, 0xfd, 0xff, 0x0a, 0xee, 0xf4, 0xd7, 0x0a, 0xf0, 0xf7, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x08, 0x13, 0xf2, 0xf8, 0x9e, 0x13, 0xf5, 0xfc, 0xff, 0x13, 0xf3, 0xfa, 0xff, 0x11, 0xed, 0xf2, 0xff, 0x18, 0xd2, 0xe3, 0xf7, 0x28, 0xa2, 0xc8, 0xfa, 0x27, 0xa7, 0xcc, 0xfe, 0x27, 0xa8, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa7, 0xcb, 0xfd, 0x26, 0xa6, 0xcb, 0xfc, 0x28, 0xaa, 0xcf, 0xff, 0x29, 0xb0, 0xd6, 0xff, 0x29, 0xb2, 0xd9, 0xff, 0x29, 0xb3, 0xda, 0xff, 0x29, 0xb2, 0xd9, 0xff, 0x28, 0xae, 0xd4, 0xff, 0x28, 0xa5, 0xcb, 0xff, 0x29, 0xa2, 0xca, 0xfb, 0x22, 0xb1, 0xd0, 0xfe, 0x11, 0xd6, 0xe4, 0xfc, 0x08, 0xec, 0xef, 0xfd, 0x0b, 0xf6, 0xfd, 0xff, 0x0b, 0xf0, 0xf6, 0x9f, 0x11, 0xee, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xf1, 0xf8, 0x4b, 0x12, 0xf1, 0xf9, 0xb8, 0x12, 0xed, 0xf4, 0xf7, 0x12, 0xf9, 0xff, 0xff, 0x21, 0xc6, 0xe3, 0xff, 0x2a, 0xa4, 0xcd, 0xff, 0x28, 0xa5, 0xca, 0xfd, 0x27, 0xa6, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa6, 0xcb, 0xfe, 0x27, 0xa6, 0xcb, 0xfc, 0x27, 0xa4, 0xca, 0xfc, 0x28, 0xa3, 0xca, 0xfb, 0x29, 0xa1, 0xc9, 0xfc, 0x28, 0xa4, 0xcb, 0xfc, 0x22, 0xb2, 0xd1, 0xfd, 0x15, 0xce, 0xdf, 0xfe, 0x0a, 0xe6, 0xeb, 0xfd, 0x08, 0xec, 0xf1, 0xff, 0x0b, 0xef, 0xf6, 0xff, 0x0b, 0xf1, 0xf5, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf1, 0xff, 0x26, 0x11, 0xf4, 0xf9, 0x64, 0x14, 0xe3, 0xee, 0x97, 0x22, 0xb6, 0xd5, 0xe7, 0x24, 0xb8, 0xd9, 0xff, 0x25, 0xa8, 0xcc, 0xfb, 0x26, 0xa9, 0xcd, 0xff, 0x27, 0xa7, 0xcc, 0xff, 0x27, 0xa7, 0xcb, 0xff, 0x27, 0xa7, 0xcb, 0xff, 0x26, 0xa8, 0xcd, 0xff, 0x24, 0xad, 0xce, 0xfe, 0x20, 0xb5, 0xd3, 0xfe, 0x19, 0xc4, 0xda, 0xfe, 0x11, 0xd7, 0xe4, 0xfe, 0x0a, 0xe8, 0xed, 0xff, 0x08, 0xea, 0xee, 0xfc, 0x0a, 0xec, 0xf2, 0xff, 0x0a, 0xee, 0xf5, 0xf7, 0x08, 0xed, 0xf3, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0x2c, 0x0b, 0xef, 0xf6, 0xe3, 0x0d, 0xef, 0xf8, 0xff, 0x0d, 0xdf, 0xe8, 0xfa, 0x0e, 0xdd, 0xe7, 0xfd, 0x0e, 0xdc, 0xe7, 0xfe, 0x0e, 0xdd, 0xe7, 0xfe, 0x0d, 0xdf, 0xe9, 0xfe, 0x0b, 0xe4, 0xeb, 0xfe, 0x09, 0xe9, 0xee, 0xff, 0x08, 0xec, 0xef, 0xff, 0x09, 0xea, 0xef, 0xff, 0x0a, 0xe5, 0xeb, 0xfb, 0x0b, 0xef, 0xf6, 0xff, 0x0a, 0xf0, 0xf7, 0xec, 0x0b, 0xeb, 0xf3, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x03, 0x00, 0xcc, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0xf0, 0x23, 0x0a, 0xf4, 0xf9, 0xc2, 0x0a, 0xfa, 0xff, 0xff, 0x09, 0xef, 0xf4, 0xff, 0x09, 0xe8, 0xed, 0xfc, 0x09, 0xe8, 0xed, 0xfc, 0x09, 0xe8, 0xed, 0xfd, 0x0a, 0xe7, 0xec, 0xfe, 0x0a, 0xe6, 0xec, 0xfd, 0x0a, 0xe5, 0xeb, 0xfc, 0x0a, 0xe5, 0xeb, 0xfc, 0x0b, 0xf7, 0xfd, 0xff, 0x0a, 0xef, 0xf5, 0xdb, 0x0b, 0xf3, 0xf9, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0x04, 0x0b, 0xec, 0xf5, 0x71, 0x0a, 0xed, 0xf4, 0xde, 0x0b, 0xf5, 0xfc, 0xff, 0x0b, 0xf6, 0xfc, 0xff, 0x0b, 0xef, 0xf6, 0xff, 0x0a, 0xec, 0xf3, 0xff, 0x0a, 0xee, 0xf4, 0xff, 0x0b, 0xf5, 0xfc, 0xff, 0x0b, 0xf5, 0xfb, 0xff, 0x0a, 0xf1, 0xf9, 0xab, 0x0b, 0xe8, 0xf3, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xe9, 0xff, 0x0c, 0x0b, 0xf3, 0xfc, 0x56, 0x09, 0xed, 0xf4, 0xa4, 0x09, 0xe9, 0xef, 0xd3, 0x0a, 0xea, 0xf0, 0xe2, 0x0a, 0xe9, 0xef, 0xda, 0x0a, 0xee, 0xf6, 0xaa, 0x0a, 0xee, 0xf4, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x0f, 0xff, 0xff, 0x11, 0x00, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_image_dsc_t img_paxg_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_paxg_logo_data),
-    .data = img_paxg_logo_data,
-};
-
-// chainbase.png -> 36x36 ARGB8888
-static const uint8_t img_chainbase_logo_data[] = {
-    0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x35, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x2d, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
-    0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0xff, 0xff, 0xff, 0x2d,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x02,
-    0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0x52, 0xff, 0xff, 0xff, 0x28,
-    0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0x72, 0xff, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xa6, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0x71, 0xff, 0xff, 0xff, 0xba, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x95, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x95, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0x72, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,
-    0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0x52, 0xff, 0xff, 0xff, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x02,
-    0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x42, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0x2d, 0xff, 0xff, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x27,
-    0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x35, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x35, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6,
-};
-
-const lv_image_dsc_t img_chainbase_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_chainbase_logo_data),
-    .data = img_chainbase_logo_data,
-};
-
-// sui.png -> 36x36 ARGB8888
-static const uint8_t img_sui_logo_data[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0xaa, 0x55, 0x03, 0xff, 0xbf, 0x3f, 0x04, 0xff, 0xa7, 0x4f, 0xca, 0xff, 0xa3, 0x4f, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4e, 0x92, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa7, 0x4f, 0xfc, 0xff, 0xa4, 0x4d, 0x52, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4e, 0x6b, 0xff, 0xae, 0x53, 0xff, 0xff, 0xa0, 0x4d, 0xfb, 0xff, 0xa4, 0x4e, 0xfe, 0xff, 0xa8, 0x4f, 0xf3, 0xff, 0xa6, 0x4d, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa8, 0x4e, 0x41, 0xff, 0xa8, 0x50, 0xfb, 0xff, 0xa3, 0x4e, 0xfb, 0xff, 0xa1, 0x4d, 0xfe, 0xff, 0xa1, 0x4d, 0xfb, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa6, 0x4f, 0xd9, 0xff, 0xae, 0x50, 0x13, 0xff, 0xff, 0x00, 0x01, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9f, 0x4f, 0x20, 0xff, 0xa7, 0x4f, 0xe9, 0xff, 0xa5, 0x4e, 0xfe, 0xff, 0xa2, 0x4d, 0xfe, 0xff, 0xa5, 0x4e, 0xff, 0xff, 0xa6, 0x4f, 0xff, 0xff, 0xa2, 0x4c, 0xfa, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa5, 0x4e, 0xb6, 0xff, 0xff, 0x00, 0x01, 0xff, 0xaa, 0x55, 0x03, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0xbf, 0x5f, 0x08, 0xff, 0xa6, 0x4f, 0xca, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xa3, 0x4e, 0xfb, 0xff, 0xa7, 0x4f, 0xf8, 0xff, 0xa6, 0x4d, 0x42, 0xff, 0xa4, 0x4e, 0x7c, 0xff, 0xae, 0x53, 0xff, 0xff, 0xa1, 0x4c, 0xf7, 0xff, 0xae, 0x53, 0xff, 0xff, 0xa2, 0x4d, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4f, 0xa3, 0xff, 0xad, 0x53, 0xff, 0xff, 0xa1, 0x4b, 0xf9, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa5, 0x4e, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4e, 0xa6, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa1, 0x4d, 0xf8, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa5, 0x4e, 0x61, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x4e, 0x78, 0xff, 0xae, 0x53, 0xff, 0xff, 0xa1, 0x4d, 0xf8, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa4, 0x4c, 0x92, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x06, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0xa2, 0x45, 0x0b, 0xff, 0xa7, 0x50, 0xcc, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xa3, 0x4d, 0xfa, 0xff, 0xa7, 0x4f, 0xf9, 0xff, 0xa5, 0x50, 0x39, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x4e, 0x4e, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xa3, 0x4d, 0xfa, 0xff, 0xa5, 0x4e, 0xfe, 0xff, 0xa4, 0x4e, 0xe4, 0xff, 0xb0, 0x4e, 0x0d, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x52, 0x22, 0xff, 0xa7, 0x4f, 0xea, 0xff, 0xa5, 0x4e, 0xfd, 0xff, 0xa5, 0x4e, 0xfe, 0xff, 0xa7, 0x4f, 0xe3, 0xff, 0xa3, 0x51, 0x19, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x4e, 0x2a, 0xff, 0xa8, 0x50, 0xef, 0xff, 0xa4, 0x4e, 0xfe, 0xff, 0xa1, 0x4c, 0xfa, 0xff, 0xad, 0x53, 0xff, 0xff, 0xa3, 0x4d, 0x83, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x4f, 0x43, 0xff, 0xa8, 0x4f, 0xfd, 0xff, 0xa2, 0x4d, 0xf9, 0xff, 0xaa, 0x51, 0xff, 0xff, 0xa5, 0x4e, 0xc2, 0xff, 0xaa, 0x55, 0x06, 0xff, 0xaa, 0x55, 0x03, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0x01, 0xff, 0xaa, 0x55, 0x0f, 0xff, 0xa5, 0x4e, 0xd6, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xa0, 0x4c, 0xfc, 0xff, 0xa2, 0x4d, 0xfe, 0xff, 0xa6, 0x4f, 0xfe, 0xff, 0xa5, 0x50, 0x36, 0xff, 0xff, 0x00, 0x01, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x4d, 0x6d, 0xff, 0xad, 0x53, 0xff, 0xff, 0xa1, 0x4c, 0xf7, 0xff, 0xae, 0x53, 0xff, 0xff, 0xa5, 0x4e, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4d, 0xb1, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa1, 0x4c, 0xfb, 0xff, 0xa1, 0x4d, 0xfe, 0xff, 0xa5, 0x4e, 0xff, 0xff, 0xa3, 0x4d, 0xea, 0xff, 0x9b, 0x55, 0x12, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4e, 0x99, 0xff, 0xae, 0x52, 0xff, 0xff, 0xa1, 0x4d, 0xf7, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa4, 0x4c, 0x6e, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4f, 0x86, 0xff, 0xae, 0x53, 0xff, 0xff, 0xa1, 0x4c, 0xfa, 0xff, 0xa2, 0x4d, 0xff, 0xff, 0xa2, 0x4d, 0xfd, 0xff, 0xa7, 0x4f, 0xff, 0xff, 0xa6, 0x4f, 0xda, 0xff, 0xaa, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0xaa, 0x55, 0x03, 0xff, 0xcc, 0x66, 0x05, 0xff, 0xa6, 0x4d, 0xc1, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa2, 0x4d, 0xf9, 0xff, 0xa8, 0x50, 0xfc, 0xff, 0xa6, 0x4d, 0x45, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa6, 0x4e, 0x54, 0xff, 0xac, 0x51, 0xff, 0xff, 0xa1, 0x4d, 0xfb, 0xff, 0xa5, 0x4e, 0xff, 0xff, 0xa2, 0x4c, 0xfc, 0xff, 0xa1, 0x4d, 0xfe, 0xff, 0xa6, 0x4f, 0xff, 0xff, 0xa3, 0x4d, 0xe5, 0xff, 0xb0, 0x4e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x51, 0x19, 0xff, 0xa7, 0x50, 0xe1, 0xff, 0xa5, 0x4f, 0xfe, 0xff, 0xa5, 0x4e, 0xfd, 0xff, 0xa7, 0x4f, 0xe8, 0xff, 0xa3, 0x51, 0x1c, 0xff, 0xff, 0x00, 0x01, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0x01, 0xff, 0xb1, 0x4d, 0x17, 0xff, 0xa5, 0x4e, 0xea, 0xff, 0xa4, 0x4e, 0xfc, 0xff, 0xaa, 0x51, 0xff, 0xff, 0xa3, 0x4d, 0xc1, 0xff, 0xa8, 0x4f, 0x84, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa1, 0x4c, 0xfc, 0xff, 0xa5, 0x4e, 0xfd, 0xff, 0xa8, 0x51, 0x2f, 0xff, 0x7f, 0x00, 0x02, 0xff, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x4d, 0x38, 0xff, 0xa8, 0x4f, 0xf7, 0xff, 0xa3, 0x4d, 0xfa, 0xff, 0xac, 0x51, 0xff, 0xff, 0xa3, 0x4e, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4e, 0x8f, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa2, 0x4d, 0xfb, 0xff, 0xa8, 0x4f, 0xf3, 0xff, 0xaa, 0x55, 0x1e, 0xff, 0xa4, 0x4f, 0x30, 0xff, 0xaa, 0x51, 0xff, 0xff, 0xa1, 0x4c, 0xfa, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa2, 0x4d, 0x90, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x33, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4f, 0x67, 0xff, 0xac, 0x51, 0xff, 0xff, 0xa1, 0x4c, 0xfa, 0xff, 0xaa, 0x51, 0xff, 0xff, 0xa7, 0x50, 0x46, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x4a, 0x18, 0xff, 0xa4, 0x4d, 0xf0, 0xff, 0xa2, 0x4d, 0xfd, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa2, 0x4e, 0x7c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb2, 0x4c, 0x0a, 0xff, 0xa3, 0x4d, 0xd6, 0xff, 0xa7, 0x4f, 0xfe, 0xff, 0xa2, 0x4d, 0xfc, 0xff, 0xa7, 0x50, 0xf8, 0xff, 0xa6, 0x4e, 0x37, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x4d, 0xc1, 0xff, 0xa8, 0x50, 0xfe, 0xff, 0xa9, 0x50, 0xfe, 0xff, 0xa4, 0x4e, 0xb9, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4e, 0x68, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa2, 0x4d, 0xfe, 0xff, 0xa4, 0x4d, 0xe9, 0xff, 0xa5, 0x4b, 0x11, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa7, 0x4f, 0x5d, 0xff, 0xae, 0x53, 0xff, 0xff, 0xa1, 0x4c, 0xf9, 0xff, 0xa6, 0x4f, 0xff, 0xff, 0xa7, 0x4f, 0xe4, 0xff, 0xa2, 0x4b, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4f, 0x4a, 0xff, 0xaa, 0x50, 0xff, 0xff, 0xa1, 0x4c, 0xfe, 0xff, 0xa5, 0x4e, 0xf8, 0xff, 0xa5, 0x4b, 0x25, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4e, 0xaf, 0xff, 0xa9, 0x50, 0xfe, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa4, 0x4d, 0x9e, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0xff, 0x55, 0x55, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xa3, 0x4e, 0xb3, 0xff, 0xae, 0x52, 0xff, 0xff, 0xa0, 0x4c, 0xf8, 0xff, 0xa7, 0x4f, 0xff, 0xff, 0xa7, 0x4f, 0xea, 0xff, 0xa8, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x5f, 0x08, 0xff, 0xa3, 0x4d, 0xdf, 0xff, 0xa4, 0x4e, 0xff, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa5, 0x4f, 0x67, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb6, 0x6d, 0x07, 0xff, 0xa5, 0x4e, 0xdb, 0xff, 0xa4, 0x4e, 0xff, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa4, 0x4c, 0x5d, 0xff, 0x00, 0x00, 0x01, 0xff, 0x7f, 0x3f, 0x04, 0xff, 0x7f, 0x00, 0x02, 0xff, 0xff, 0x00, 0x01, 0xff, 0xaa, 0x55, 0x12, 0xff, 0xa5, 0x4e, 0xd1, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa1, 0x4c, 0xf8, 0xff, 0xa5, 0x4e, 0xff, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xa8, 0x4f, 0xa0, 0xff, 0xaa, 0x4c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4e, 0xa6, 0xff, 0xaa, 0x51, 0xff, 0xff, 0xaa, 0x51, 0xff, 0xff, 0xa6, 0x4e, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x4e, 0x1a, 0xff, 0xa3, 0x4c, 0xf2, 0xff, 0xa3, 0x4d, 0xff, 0xff, 0xa6, 0x4f, 0xff, 0xff, 0xa5, 0x50, 0x39, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9f, 0x4a, 0x18, 0xff, 0xa8, 0x50, 0xc2, 0xff, 0xaf, 0x53, 0xff, 0xff, 0xa0, 0x4c, 0xfc, 0xff, 0xa1, 0x4c, 0xfb, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa7, 0x4e, 0xec, 0xff, 0xa7, 0x4f, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa6, 0x4e, 0x7f, 0xff, 0xab, 0x52, 0xff, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa3, 0x4d, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x4e, 0x27, 0xff, 0xa1, 0x4c, 0xfc, 0xff, 0xa3, 0x4d, 0xff, 0xff, 0xa3, 0x4d, 0xfc, 0xff, 0xad, 0x51, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9f, 0x3f, 0x08, 0xff, 0xa8, 0x4f, 0x91, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa0, 0x4d, 0xf8, 0xff, 0xa4, 0x4e, 0xff, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa8, 0x50, 0x99, 0xff, 0x99, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa7, 0x4e, 0x6f, 0xff, 0xab, 0x52, 0xff, 0xff, 0xa7, 0x4f, 0xff, 0xff, 0xa1, 0x4d, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa1, 0x49, 0x26, 0xff, 0xa1, 0x4d, 0xfb, 0xff, 0xa2, 0x4d, 0xff, 0xff, 0xa3, 0x4e, 0xfe, 0xff, 0xab, 0x53, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa8, 0x4e, 0x41, 0xff, 0xa9, 0x50, 0xc7, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa1, 0x4c, 0xfd, 0xff, 0xa1, 0x4c, 0xfa, 0xff, 0xb0, 0x53, 0xff, 0xff, 0xa5, 0x4e, 0xb3, 0xff, 0xb6, 0x48, 0x07, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0xff, 0x00, 0x01, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa7, 0x50, 0x75, 0xff, 0xab, 0x52, 0xff, 0xff, 0xa6, 0x4f, 0xff, 0xff, 0xa2, 0x4c, 0xcb, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9f, 0x4a, 0x18, 0xff, 0xa3, 0x4d, 0xf0, 0xff, 0xa2, 0x4d, 0xff, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xa7, 0x50, 0x49, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0xff, 0xa9, 0x4f, 0x7d, 0xff, 0xa6, 0x4f, 0xfe, 0xff, 0xa4, 0x4e, 0xff, 0xff, 0xa1, 0x4d, 0xf8, 0xff, 0xaf, 0x53, 0xff, 0xff, 0xa3, 0x4d, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4e, 0x92, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa4, 0x4d, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x66, 0x05, 0xff, 0xa4, 0x4e, 0xd7, 0xff, 0xa5, 0x4e, 0xff, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa5, 0x4d, 0x7d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa6, 0x4e, 0x4e, 0xff, 0xa7, 0x4f, 0xf5, 0xff, 0xa4, 0x4e, 0xfe, 0xff, 0xa1, 0x4c, 0xf9, 0xff, 0xaf, 0x53, 0xff, 0xff, 0xa4, 0x4e, 0x68, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa3, 0x4d, 0xc6, 0xff, 0xa7, 0x4f, 0xff, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa4, 0x4e, 0x96, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4e, 0xa8, 0xff, 0xaa, 0x51, 0xfe, 0xff, 0xa7, 0x4f, 0xff, 0xff, 0xa4, 0x4e, 0xca, 0xff, 0xff, 0x00, 0x01, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x99, 0x33, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4c, 0x49, 0xff, 0xa8, 0x50, 0xfa, 0xff, 0xa3, 0x4e, 0xfb, 0xff, 0xa5, 0x4e, 0xfd, 0xff, 0xa4, 0x4d, 0xec, 0xff, 0xa6, 0x4d, 0x17, 0xff, 0xff, 0x00, 0x01, 0xff, 0xa7, 0x50, 0x26, 0xff, 0xa6, 0x4f, 0xf7, 0xff, 0xa1, 0x4c, 0xfd, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa6, 0x4d, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x4e, 0x5e, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa0, 0x4c, 0xfb, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa4, 0x4e, 0x41, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4e, 0x7f, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa0, 0x4c, 0xf9, 0xff, 0xad, 0x53, 0xff, 0xff, 0xa5, 0x4f, 0x7a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4e, 0x8f, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa2, 0x4c, 0xfd, 0xff, 0xa3, 0x4e, 0xf5, 0xff, 0xa1, 0x4c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb4, 0x4b, 0x11, 0xff, 0xa4, 0x4d, 0xe9, 0xff, 0xa4, 0x4e, 0xfc, 0xff, 0xa8, 0x50, 0xfe, 0xff, 0xa4, 0x4f, 0xc8, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x3f, 0x04, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0xaa, 0x55, 0x0c, 0xff, 0xa4, 0x4d, 0xe4, 0xff, 0xa4, 0x4e, 0xfe, 0xff, 0xaa, 0x51, 0xfe, 0xff, 0xa4, 0x4e, 0xbc, 0xff, 0xaa, 0x4d, 0x24, 0xff, 0xa7, 0x4f, 0xf4, 0xff, 0xa2, 0x4c, 0xfc, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa5, 0x4e, 0xad, 0x00, 0x00, 0x00, 0x00, 0xff, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa4, 0x4e, 0x7f, 0xff, 0xae, 0x53, 0xff, 0xff, 0x9f, 0x4b, 0xf9, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa5, 0x4e, 0x86, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa6, 0x4e, 0x98, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa3, 0x4e, 0xfe, 0xff, 0xa3, 0x4c, 0xe9, 0xff, 0xa4, 0x4e, 0xd1, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa2, 0x4d, 0xfa, 0xff, 0xa7, 0x4f, 0xff, 0xff, 0xa8, 0x51, 0x38, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0x7f, 0x00, 0x02, 0xff, 0xa3, 0x48, 0x0e, 0xff, 0xa5, 0x4e, 0xdd, 0xff, 0xa7, 0x4f, 0xff, 0xff, 0xa1, 0x4c, 0xf9, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa6, 0x4f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x3f, 0x04, 0xff, 0xaa, 0x55, 0x03, 0xff, 0xa5, 0x4d, 0x6c, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa1, 0x4d, 0xfb, 0xff, 0xa4, 0x4e, 0xff, 0xff, 0xa6, 0x4f, 0xff, 0xff, 0xa0, 0x4c, 0xfa, 0xff, 0xaf, 0x53, 0xff, 0xff, 0xa3, 0x4d, 0x9e, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa5, 0x50, 0x3f, 0xff, 0xa8, 0x4f, 0xfd, 0xff, 0xa3, 0x4d, 0xfc, 0xff, 0xa2, 0x4d, 0xfb, 0xff, 0xab, 0x51, 0xff, 0xff, 0xa7, 0x4e, 0x98, 0xff, 0xb4, 0x5a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0x7f, 0x3f, 0x04, 0xff, 0x7f, 0x3f, 0x04, 0xff, 0x7f, 0x3f, 0x04, 0xff, 0xaa, 0x55, 0x03, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa7, 0x50, 0x52, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa1, 0x4c, 0xfc, 0xff, 0xa2, 0x4d, 0xfe, 0xff, 0xa1, 0x4c, 0xf9, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xa6, 0x4e, 0xda, 0xff, 0xa5, 0x4b, 0x11, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa2, 0x4d, 0x66, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa3, 0x4d, 0xfd, 0xff, 0xa1, 0x4c, 0xfa, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa7, 0x4f, 0xde, 0xff, 0xaa, 0x50, 0x6f, 0xff, 0xa7, 0x4f, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xad, 0x51, 0x2f, 0xff, 0xa7, 0x4e, 0xac, 0xff, 0xa8, 0x50, 0xfe, 0xff, 0xa2, 0x4d, 0xfd, 0xff, 0xa1, 0x4d, 0xfb, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa7, 0x4f, 0xea, 0xff, 0xa4, 0x4f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa6, 0x4e, 0x65, 0xff, 0xa8, 0x50, 0xfb, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa0, 0x4c, 0xf8, 0xff, 0xa5, 0x4f, 0xff, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa4, 0x4e, 0xf1, 0xff, 0xa5, 0x4e, 0xbf, 0xff, 0xa4, 0x4e, 0x96, 0xff, 0xa8, 0x51, 0x81, 0xff, 0xa6, 0x50, 0x85, 0xff, 0xa4, 0x4e, 0xa0, 0xff, 0xa5, 0x4e, 0xcd, 0xff, 0xa4, 0x4e, 0xfd, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xa0, 0x4c, 0xfc, 0xff, 0xa1, 0x4c, 0xfc, 0xff, 0xad, 0x52, 0xff, 0xff, 0xa8, 0x50, 0xde, 0xff, 0xa1, 0x4e, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa8, 0x4e, 0x3e, 0xff, 0xa9, 0x50, 0xd4, 0xff, 0xaf, 0x53, 0xff, 0xff, 0xa5, 0x4f, 0xff, 0xff, 0xa1, 0x4c, 0xfa, 0xff, 0xa2, 0x4d, 0xff, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xad, 0x52, 0xff, 0xff, 0xad, 0x52, 0xff, 0xff, 0xad, 0x52, 0xff, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa7, 0x4f, 0xff, 0xff, 0xa1, 0x4c, 0xfd, 0xff, 0xa1, 0x4c, 0xfd, 0xff, 0xaa, 0x51, 0xff, 0xff, 0xac, 0x52, 0xff, 0xff, 0xa8, 0x50, 0xae, 0xff, 0xa3, 0x51, 0x19, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa2, 0x45, 0x0b, 0xff, 0xa8, 0x4f, 0x73, 0xff, 0xa6, 0x4f, 0xd9, 0xff, 0xa8, 0x50, 0xff, 0xff, 0xa9, 0x50, 0xff, 0xff, 0xa4, 0x4e, 0xff, 0xff, 0xa2, 0x4c, 0xfd, 0xff, 0xa2, 0x4d, 0xfb, 0xff, 0xa1, 0x4c, 0xfc, 0xff, 0xa1, 0x4d, 0xfe, 0xff, 0xa6, 0x4f, 0xff, 0xff, 0xaa, 0x51, 0xff, 0xff, 0xa5, 0x4e, 0xfd, 0xff, 0xa6, 0x4e, 0xc2, 0xff, 0xa8, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x55, 0x0c, 0xff, 0xa8, 0x51, 0x55, 0xff, 0xa7, 0x50, 0x9e, 0xff, 0xa4, 0x4e, 0xd4, 0xff, 0xa3, 0x4d, 0xf3, 0xff, 0xa2, 0x4d, 0xfe, 0xff, 0xa2, 0x4c, 0xfd, 0xff, 0xa4, 0x4d, 0xec, 0xff, 0xa4, 0x4d, 0xc8, 0xff, 0xa7, 0x50, 0x8c, 0xff, 0xa8, 0x52, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_image_dsc_t img_sui_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_sui_logo_data),
-    .data = img_sui_logo_data,
-};
-
-// doge.png -> 36x36 ARGB8888
-static const uint8_t img_doge_logo_data[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x87, 0x9d, 0x2f, 0x30, 0x80, 0x94, 0x73, 0x30, 0x7f, 0x92, 0xae, 0x2e, 0x7e, 0x92, 0xda, 0x2d, 0x7e, 0x91, 0xf4, 0x2e, 0x7d, 0x91, 0xfe, 0x2e, 0x7d, 0x91, 0xfe, 0x2d, 0x7e, 0x91, 0xf4, 0x2e, 0x7e, 0x92, 0xda, 0x30, 0x7e, 0x91, 0xaf, 0x30, 0x80, 0x94, 0x73, 0x30, 0x87, 0x9d, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x66, 0xcc, 0xff, 0x05, 0x31, 0x85, 0x98, 0x5c, 0x2e, 0x7f, 0x92, 0xbe, 0x2f, 0x82, 0x96, 0xf6, 0x32, 0x8d, 0xa4, 0xff, 0x33, 0x95, 0xae, 0xff, 0x32, 0x98, 0xb2, 0xff, 0x32, 0x9a, 0xb4, 0xff, 0x32, 0x9b, 0xb5, 0xff, 0x32, 0x9b, 0xb5, 0xff, 0x32, 0x9a, 0xb4, 0xff, 0x32, 0x99, 0xb2, 0xff, 0x33, 0x95, 0xae, 0xff, 0x32, 0x8d, 0xa4, 0xff, 0x2f, 0x81, 0x96, 0xf6, 0x2e, 0x7e, 0x92, 0xbe, 0x31, 0x85, 0x98, 0x5c, 0x66, 0xcc, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x87, 0x9a, 0x4f, 0x2f, 0x80, 0x94, 0xd0, 0x32, 0x8b, 0xa1, 0xff, 0x33, 0x98, 0xb2, 0xff, 0x33, 0x9c, 0xba, 0xff, 0x33, 0xa2, 0xbd, 0xfd, 0x33, 0xa2, 0xbd, 0xfd, 0x33, 0xa1, 0xbc, 0xfe, 0x33, 0xa0, 0xbc, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x33, 0xa0, 0xbc, 0xff, 0x33, 0xa1, 0xbc, 0xfe, 0x33, 0xa2, 0xbd, 0xfd, 0x33, 0xa1, 0xbd, 0xfd, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0x99, 0xb2, 0xff, 0x32, 0x8e, 0xa3, 0xff, 0x2f, 0x81, 0x94, 0xd0, 0x33, 0x87, 0x9a, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x33, 0xb2, 0xcc, 0x0a, 0x30, 0x82, 0x96, 0x99, 0x30, 0x85, 0x9a, 0xff, 0x33, 0x97, 0xb0, 0xff, 0x32, 0x9f, 0xbb, 0xfc, 0x38, 0xa4, 0xc0, 0xfc, 0x4c, 0xa8, 0xce, 0xfe, 0x33, 0x93, 0xb7, 0xff, 0x33, 0xa0, 0xb9, 0xff, 0x33, 0x9e, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xb9, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0xa0, 0xbb, 0xfe, 0x32, 0x9d, 0xba, 0xfc, 0x33, 0x92, 0xb1, 0xfc, 0x32, 0x94, 0xae, 0xff, 0x30, 0x86, 0x9b, 0xff, 0x30, 0x82, 0x96, 0x99, 0x33, 0xb2, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x31, 0x93, 0xa6, 0x1a, 0x2f, 0x80, 0x94, 0xc6, 0x33, 0x8f, 0xa6, 0xff, 0x32, 0x9d, 0xb9, 0xfc, 0x33, 0xa2, 0xbd, 0xfd, 0x32, 0x9e, 0xb9, 0xff, 0x37, 0x9f, 0xb9, 0xff, 0x5d, 0xb7, 0xd7, 0xff, 0x37, 0x8c, 0xb9, 0xff, 0x32, 0x9b, 0xb7, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x34, 0xa1, 0xbb, 0xff, 0x3e, 0x97, 0xb8, 0xff, 0x36, 0x79, 0x9f, 0xff, 0x34, 0x8a, 0xac, 0xfd, 0x32, 0x9f, 0xba, 0xfc, 0x33, 0x8f, 0xa6, 0xff, 0x2f, 0x80, 0x94, 0xc6, 0x31, 0x93, 0xa6, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x33, 0x99, 0xad, 0x19, 0x2f, 0x80, 0x93, 0xd5, 0x32, 0x92, 0xaa, 0xff, 0x33, 0xa2, 0xbd, 0xfa, 0x33, 0xa0, 0xbb, 0xff, 0x34, 0x9f, 0xb9, 0xff, 0x34, 0x9f, 0xbb, 0xff, 0x35, 0x9d, 0xb7, 0xff, 0x55, 0xb0, 0xd0, 0xff, 0x38, 0x89, 0xba, 0xff, 0x33, 0x8e, 0xb4, 0xff, 0x33, 0xa1, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x34, 0x9f, 0xba, 0xff, 0x34, 0xa0, 0xbb, 0xff, 0x34, 0xa0, 0xbb, 0xff, 0x34, 0xa0, 0xbb, 0xff, 0x34, 0xa1, 0xbb, 0xff, 0x32, 0x9e, 0xb9, 0xff, 0x40, 0x9d, 0xbe, 0xff, 0x48, 0xa1, 0xc3, 0xff, 0x3d, 0x8c, 0xae, 0xff, 0x33, 0x7b, 0x9f, 0xff, 0x33, 0x9e, 0xba, 0xff, 0x33, 0xa3, 0xbe, 0xfa, 0x32, 0x91, 0xa9, 0xff, 0x2f, 0x80, 0x93, 0xd5, 0x33, 0x99, 0xad, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x7f, 0x7f, 0x02, 0x33, 0xb2, 0xcc, 0x0a, 0x2f, 0x7f, 0x92, 0xc8, 0x32, 0x92, 0xaa, 0xff, 0x32, 0xa2, 0xbd, 0xfb, 0x33, 0x9f, 0xba, 0xff, 0x32, 0x9e, 0xb9, 0xff, 0x30, 0x9e, 0xb9, 0xff, 0x2f, 0x9e, 0xba, 0xff, 0x33, 0x9b, 0xb5, 0xff, 0x47, 0xa5, 0xc9, 0xff, 0x32, 0x8e, 0xbe, 0xff, 0x35, 0x91, 0xbf, 0xff, 0x33, 0x9e, 0xbf, 0xff, 0x32, 0x9f, 0xbc, 0xff, 0x30, 0x9e, 0xb9, 0xff, 0x30, 0x9b, 0xb7, 0xff, 0x30, 0x9a, 0xb5, 0xff, 0x30, 0x9a, 0xb4, 0xff, 0x31, 0x9c, 0xb7, 0xff, 0x33, 0x86, 0xad, 0xff, 0x46, 0x97, 0xb9, 0xff, 0x41, 0x8c, 0xad, 0xff, 0x3c, 0x77, 0x98, 0xff, 0x36, 0x78, 0x9b, 0xff, 0x33, 0x9a, 0xb7, 0xff, 0x33, 0xa0, 0xba, 0xff, 0x32, 0xa1, 0xbd, 0xfb, 0x32, 0x92, 0xaa, 0xff, 0x2f, 0x7f, 0x92, 0xc8, 0x33, 0xb2, 0xcc, 0x0a, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x7e, 0x92, 0x9b, 0x33, 0x8f, 0xa6, 0xff, 0x33, 0xa2, 0xbd, 0xfa, 0x33, 0x9f, 0xba, 0xff, 0x32, 0x9f, 0xba, 0xff, 0x36, 0xa0, 0xbb, 0xff, 0x3f, 0xa4, 0xbe, 0xff, 0x3c, 0xa3, 0xbd, 0xff, 0x47, 0xa5, 0xc0, 0xff, 0x50, 0xa8, 0xce, 0xff, 0x5b, 0xb7, 0xd9, 0xff, 0x55, 0xb7, 0xdb, 0xff, 0x47, 0xac, 0xd4, 0xff, 0x48, 0xad, 0xd4, 0xff, 0x47, 0xab, 0xd0, 0xff, 0x48, 0xa9, 0xcd, 0xff, 0x47, 0xa8, 0xcc, 0xff, 0x47, 0xa8, 0xcc, 0xff, 0x3c, 0x8c, 0xb3, 0xff, 0x2d, 0x78, 0xa1, 0xff, 0x31, 0x71, 0x90, 0xff, 0x2f, 0x52, 0x6d, 0xff, 0x30, 0x55, 0x70, 0xff, 0x36, 0x75, 0x97, 0xff, 0x33, 0x98, 0xb6, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0xa2, 0xbd, 0xfa, 0x33, 0x8f, 0xa6, 0xff, 0x2f, 0x7e, 0x92, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x33, 0x84, 0x99, 0x4b, 0x31, 0x86, 0x9a, 0xff, 0x32, 0x9e, 0xb9, 0xfb, 0x33, 0x9f, 0xba, 0xff, 0x35, 0xa0, 0xba, 0xff, 0x2b, 0x9c, 0xb7, 0xff, 0x5b, 0xb2, 0xc8, 0xff, 0xd1, 0xe9, 0xef, 0xff, 0xcc, 0xe7, 0xee, 0xff, 0xd1, 0xe9, 0xf2, 0xff, 0xd6, 0xee, 0xf7, 0xff, 0xd9, 0xf1, 0xf8, 0xff, 0xd4, 0xed, 0xf5, 0xff, 0xcd, 0xe9, 0xf3, 0xff, 0xcd, 0xe7, 0xf2, 0xff, 0xcf, 0xea, 0xf3, 0xff, 0xd2, 0xec, 0xf5, 0xff, 0xd1, 0xeb, 0xf4, 0xff, 0xce, 0xe8, 0xf3, 0xff, 0xc9, 0xdb, 0xe6, 0xff, 0xab, 0xc9, 0xd8, 0xff, 0x63, 0x8f, 0xa5, 0xff, 0x22, 0x45, 0x5d, 0xff, 0x28, 0x49, 0x63, 0xff, 0x38, 0x7d, 0xa2, 0xff, 0x33, 0x99, 0xb6, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x33, 0x9e, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x32, 0x9e, 0xb9, 0xfb, 0x31, 0x86, 0x9a, 0xff, 0x33, 0x84, 0x99, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xaa, 0x03,
-    0x00, 0xff, 0xff, 0x01, 0x48, 0xb6, 0xb6, 0x07, 0x2e, 0x7d, 0x8e, 0xd6, 0x32, 0x97, 0xb0, 0xfe, 0x33, 0xa2, 0xbd, 0xfd, 0x33, 0x9e, 0xb9, 0xff, 0x35, 0xa0, 0xbb, 0xff, 0x29, 0x9a, 0xb7, 0xff, 0x5e, 0xaf, 0xc4, 0xff, 0xe8, 0xf5, 0xfa, 0xff, 0xe2, 0xf3, 0xfa, 0xff, 0xe3, 0xf3, 0xfa, 0xff, 0xe7, 0xf6, 0xfb, 0xff, 0xe5, 0xf5, 0xfb, 0xff, 0xdd, 0xf0, 0xf7, 0xff, 0xda, 0xed, 0xf4, 0xff, 0xdd, 0xef, 0xf5, 0xff, 0xdf, 0xf1, 0xf7, 0xff, 0xde, 0xf0, 0xf6, 0xff, 0xdc, 0xee, 0xf5, 0xff, 0xdc, 0xef, 0xf5, 0xff, 0xdc, 0xed, 0xf3, 0xff, 0xe0, 0xeb, 0xf1, 0xff, 0xe3, 0xf1, 0xf6, 0xff, 0x9e, 0xac, 0xb8, 0xff, 0x3e, 0x73, 0x92, 0xff, 0x31, 0x7f, 0xa3, 0xff, 0x34, 0x9e, 0xb9, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0xa2, 0xbd, 0xfd, 0x32, 0x97, 0xb0, 0xfe, 0x2e, 0x7d, 0x8e, 0xd6, 0x48, 0xb6, 0xb6, 0x07, 0x00, 0xff, 0xff, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x2f, 0x80, 0x94, 0x5b, 0x32, 0x8b, 0xa1, 0xff, 0x33, 0xa0, 0xbc, 0xfc, 0x33, 0x9f, 0xb9, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x34, 0xa0, 0xbb, 0xff, 0x2d, 0x99, 0xb3, 0xff, 0x7c, 0xc4, 0xdd, 0xff, 0xe6, 0xf7, 0xfd, 0xff, 0xdd, 0xf1, 0xf9, 0xff, 0xe0, 0xf3, 0xfa, 0xff, 0xe3, 0xf4, 0xfa, 0xff, 0xe0, 0xf3, 0xf9, 0xff, 0xd8, 0xec, 0xf4, 0xff, 0xd8, 0xeb, 0xf2, 0xff, 0xde, 0xf0, 0xf7, 0xff, 0xdd, 0xef, 0xf5, 0xff, 0xdb, 0xee, 0xf5, 0xff, 0xd9, 0xed, 0xf5, 0xff, 0xda, 0xef, 0xf6, 0xff, 0xda, 0xee, 0xf6, 0xff, 0xd7, 0xeb, 0xf2, 0xff, 0xd3, 0xdd, 0xe3, 0xff, 0xe3, 0xe8, 0xec, 0xff, 0xc3, 0xe0, 0xeb, 0xff, 0x42, 0x98, 0xbd, 0xff, 0x30, 0x9c, 0xb9, 0xff, 0x34, 0xa0, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xb9, 0xff, 0x33, 0xa0, 0xbc, 0xfc, 0x32, 0x8b, 0xa1, 0xff, 0x2f, 0x80, 0x94, 0x5b, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x01, 0x2e, 0x7c, 0x90, 0xc1, 0x33, 0x98, 0xb2, 0xfe, 0x33, 0xa1, 0xbe, 0xfc, 0x33, 0x9e, 0xb9, 0xff, 0x34, 0xa0, 0xbb, 0xff, 0x31, 0x9c, 0xb7, 0xff, 0x43, 0xa7, 0xc4, 0xff, 0x91, 0xd9, 0xf2, 0xff, 0xea, 0xf7, 0xfc, 0xff, 0xe5, 0xf3, 0xf7, 0xff, 0xe1, 0xee, 0xf1, 0xff, 0xe1, 0xf2, 0xf8, 0xff, 0xdc, 0xf0, 0xf6, 0xff, 0xd8, 0xe9, 0xf1, 0xff, 0xdc, 0xed, 0xf3, 0xff, 0xe2, 0xf2, 0xf8, 0xff, 0xe5, 0xf6, 0xfb, 0xff, 0xe3, 0xf5, 0xfb, 0xff, 0xe2, 0xf1, 0xf6, 0xff, 0xdb, 0xef, 0xf6, 0xff, 0xdc, 0xef, 0xf6, 0xff, 0xdc, 0xf0, 0xf7, 0xff, 0xda, 0xed, 0xf5, 0xff, 0xd5, 0xe6, 0xee, 0xff, 0xe3, 0xed, 0xf2, 0xff, 0xb0, 0xd5, 0xe8, 0xff, 0x32, 0x9a, 0xbd, 0xff, 0x33, 0xa0, 0xb9, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0xa1, 0xbe, 0xfc, 0x33, 0x99, 0xb2, 0xfe, 0x2e, 0x7c, 0x90, 0xc1, 0x00, 0xff, 0xff, 0x01,
-    0x31, 0x85, 0x9b, 0x2e, 0x2f, 0x81, 0x94, 0xf9, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x34, 0xa0, 0xbb, 0xff, 0x30, 0x9b, 0xb6, 0xff, 0x64, 0xbe, 0xda, 0xff, 0xbc, 0xec, 0xf8, 0xff, 0xd0, 0xea, 0xf3, 0xff, 0xb3, 0xbc, 0xbe, 0xff, 0xc6, 0xca, 0xca, 0xff, 0xe3, 0xf6, 0xfa, 0xff, 0xdd, 0xee, 0xf6, 0xff, 0xdb, 0xec, 0xf3, 0xff, 0xe1, 0xf2, 0xf8, 0xff, 0xdd, 0xee, 0xf2, 0xff, 0xc6, 0xd6, 0xd9, 0xff, 0xb8, 0xd3, 0xdb, 0xff, 0xbc, 0xe2, 0xf1, 0xff, 0xda, 0xee, 0xf5, 0xff, 0xde, 0xf1, 0xf7, 0xff, 0xdc, 0xf0, 0xf7, 0xff, 0xdd, 0xf0, 0xf7, 0xff, 0xda, 0xef, 0xf7, 0xff, 0xd1, 0xe1, 0xe9, 0xff, 0xe2, 0xe9, 0xf0, 0xff, 0x78, 0xbb, 0xd4, 0xff, 0x28, 0x98, 0xb5, 0xff, 0x36, 0xa1, 0xbb, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x2f, 0x81, 0x95, 0xf8, 0x31, 0x85, 0x9b, 0x2e,
-    0x2f, 0x7e, 0x92, 0x75, 0x32, 0x8d, 0xa4, 0xff, 0x33, 0xa1, 0xbd, 0xfd, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x30, 0x9c, 0xb9, 0xff, 0xa8, 0xdf, 0xec, 0xff, 0xaf, 0xe7, 0xf3, 0xff, 0x65, 0xc0, 0xdf, 0xff, 0x3d, 0x74, 0x87, 0xff, 0xa1, 0xbf, 0xcb, 0xff, 0xed, 0xfb, 0xfe, 0xff, 0xde, 0xf0, 0xf7, 0xff, 0xde, 0xf0, 0xf7, 0xff, 0xd8, 0xe6, 0xed, 0xff, 0xdb, 0xe7, 0xeb, 0xff, 0x6d, 0x82, 0x86, 0xff, 0x0e, 0x1c, 0x1e, 0xff, 0x33, 0x7d, 0x97, 0xff, 0x7c, 0xc9, 0xe6, 0xff, 0xde, 0xef, 0xf5, 0xff, 0xde, 0xf0, 0xf7, 0xff, 0xdd, 0xf0, 0xf7, 0xff, 0xdc, 0xf0, 0xf7, 0xff, 0xd6, 0xe9, 0xf1, 0xff, 0xdc, 0xe9, 0xf1, 0xff, 0xbf, 0xdd, 0xe9, 0xff, 0x33, 0x9c, 0xb7, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0xa1, 0xbd, 0xfd, 0x32, 0x8d, 0xa4, 0xff, 0x2f, 0x7e, 0x92, 0x75,
-    0x2e, 0x7d, 0x90, 0xb1, 0x33, 0x95, 0xad, 0xff, 0x33, 0xa2, 0xbd, 0xfd, 0x33, 0x9e, 0xb9, 0xff, 0x35, 0xa0, 0xbb, 0xff, 0x2c, 0x9b, 0xb6, 0xff, 0x5c, 0xb7, 0xce, 0xff, 0xc2, 0xf1, 0xf7, 0xff, 0xaa, 0xe8, 0xf5, 0xff, 0x77, 0xd5, 0xf5, 0xff, 0x68, 0xce, 0xf9, 0xff, 0xba, 0xe7, 0xfc, 0xff, 0xeb, 0xf5, 0xfa, 0xff, 0xe1, 0xf3, 0xf9, 0xff, 0xde, 0xf1, 0xf8, 0xff, 0xd5, 0xe3, 0xe9, 0xff, 0xe1, 0xed, 0xf0, 0xff, 0x51, 0x70, 0x77, 0xff, 0x23, 0x42, 0x4a, 0xff, 0x52, 0xa4, 0xc0, 0xff, 0x61, 0xbc, 0xda, 0xff, 0xb9, 0xe2, 0xee, 0xff, 0xec, 0xf7, 0xfa, 0xff, 0xe4, 0xf3, 0xf9, 0xff, 0xe6, 0xf5, 0xf9, 0xff, 0xdd, 0xef, 0xf6, 0xff, 0xd6, 0xeb, 0xf4, 0xff, 0xde, 0xee, 0xf5, 0xff, 0x58, 0xaf, 0xc5, 0xff, 0x2b, 0x9c, 0xb7, 0xff, 0x35, 0xa0, 0xbb, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0xa2, 0xbd, 0xfd, 0x33, 0x95, 0xad, 0xff, 0x2e, 0x7e, 0x90, 0xb0,
-    0x2e, 0x7d, 0x90, 0xdb, 0x32, 0x98, 0xb2, 0xff, 0x33, 0xa1, 0xbc, 0xfe, 0x34, 0x9f, 0xba, 0xff, 0x34, 0xa0, 0xbb, 0xff, 0x31, 0x9e, 0xb9, 0xff, 0x99, 0xdb, 0xe7, 0xff, 0xbe, 0xf3, 0xfa, 0xff, 0xa7, 0xd8, 0xe0, 0xff, 0x53, 0x82, 0x90, 0xff, 0x48, 0x81, 0x95, 0xff, 0xb8, 0xd7, 0xe2, 0xff, 0xec, 0xf9, 0xfc, 0xff, 0xe2, 0xf2, 0xf8, 0xff, 0xe1, 0xf2, 0xf8, 0xff, 0xe0, 0xf1, 0xf7, 0xff, 0xda, 0xed, 0xf2, 0xff, 0x6a, 0xb5, 0xce, 0xff, 0x59, 0xb5, 0xd4, 0xff, 0x6c, 0xc1, 0xde, 0xff, 0x83, 0xca, 0xe1, 0xff, 0x90, 0xd1, 0xe5, 0xff, 0xe5, 0xf4, 0xf9, 0xff, 0xe8, 0xf5, 0xf9, 0xff, 0xe8, 0xf6, 0xf9, 0xff, 0xe1, 0xf1, 0xf7, 0xff, 0xd5, 0xea, 0xf3, 0xff, 0xe6, 0xf4, 0xf9, 0xff, 0x7e, 0xc2, 0xd4, 0xff, 0x27, 0x99, 0xb6, 0xff, 0x36, 0xa0, 0xbb, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0xa1, 0xbc, 0xfe, 0x32, 0x98, 0xb2, 0xff, 0x2e, 0x7d, 0x90, 0xdb,
-    0x2f, 0x7e, 0x91, 0xf3, 0x32, 0x9a, 0xb4, 0xff, 0x33, 0xa0, 0xbc, 0xff, 0x35, 0xa0, 0xbb, 0xff, 0x32, 0x9e, 0xba, 0xff, 0x45, 0xa9, 0xc2, 0xff, 0xad, 0xe6, 0xef, 0xff, 0xbc, 0xf5, 0xfe, 0xff, 0x46, 0x69, 0x6f, 0xff, 0x02, 0x0c, 0x0d, 0xff, 0x01, 0x0f, 0x11, 0xff, 0x8d, 0x95, 0x96, 0xff, 0xef, 0xfa, 0xfb, 0xff, 0xe3, 0xf3, 0xf6, 0xff, 0xe2, 0xf3, 0xf9, 0xff, 0xe3, 0xf3, 0xf9, 0xff, 0xe1, 0xf2, 0xf7, 0xff, 0x80, 0xc8, 0xe1, 0xff, 0x7b, 0xc7, 0xdf, 0xff, 0x89, 0xcd, 0xe2, 0xff, 0x86, 0xcc, 0xe2, 0xff, 0x83, 0xcb, 0xe1, 0xff, 0xd4, 0xed, 0xf5, 0xff, 0xeb, 0xf7, 0xfa, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xe3, 0xf2, 0xf7, 0xff, 0xd5, 0xea, 0xf2, 0xff, 0xe5, 0xf4, 0xf9, 0xff, 0x9b, 0xce, 0xdc, 0xff, 0x28, 0x99, 0xb6, 0xff, 0x36, 0xa0, 0xbb, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0xa0, 0xbc, 0xff, 0x32, 0x9a, 0xb4, 0xff, 0x2f, 0x7e, 0x91, 0xf3,
-    0x2e, 0x7d, 0x91, 0xfe, 0x32, 0x9b, 0xb5, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x34, 0xa0, 0xba, 0xff, 0x2f, 0x9d, 0xb8, 0xff, 0x52, 0xb0, 0xc7, 0xff, 0xad, 0xe7, 0xf2, 0xff, 0xaf, 0xea, 0xf6, 0xff, 0x36, 0x52, 0x58, 0xff, 0x0d, 0x1b, 0x1e, 0xff, 0x08, 0x1b, 0x1f, 0xff, 0x92, 0x9c, 0x9f, 0xff, 0xef, 0xf9, 0xfc, 0xff, 0xe4, 0xf1, 0xf4, 0xff, 0xe4, 0xf3, 0xf7, 0xff, 0xe4, 0xf4, 0xf9, 0xff, 0xe6, 0xf4, 0xf8, 0xff, 0x94, 0xd2, 0xe5, 0xff, 0x83, 0xcc, 0xe1, 0xff, 0x85, 0xcc, 0xe2, 0xff, 0x86, 0xcc, 0xe2, 0xff, 0x80, 0xca, 0xe1, 0xff, 0xca, 0xe9, 0xf2, 0xff, 0xed, 0xf7, 0xfa, 0xff, 0xe6, 0xf5, 0xf9, 0xff, 0xe6, 0xf4, 0xf9, 0xff, 0xd7, 0xeb, 0xf2, 0xff, 0xe3, 0xf3, 0xf9, 0xff, 0xad, 0xd5, 0xe1, 0xff, 0x2b, 0x99, 0xb5, 0xff, 0x35, 0xa0, 0xbb, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x32, 0x9b, 0xb5, 0xff, 0x2e, 0x7d, 0x91, 0xfe,
-    0x2e, 0x7d, 0x91, 0xfe, 0x32, 0x9b, 0xb5, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x35, 0xa0, 0xbb, 0xff, 0x31, 0x9d, 0xb9, 0xff, 0x58, 0xb2, 0xc9, 0xff, 0xad, 0xe8, 0xf4, 0xff, 0x95, 0xd3, 0xe3, 0xff, 0x40, 0x60, 0x6a, 0xff, 0x1a, 0x2d, 0x32, 0xff, 0x10, 0x24, 0x29, 0xff, 0xa3, 0xb4, 0xb9, 0xff, 0xf0, 0xfc, 0xfe, 0xff, 0xe3, 0xf0, 0xf3, 0xff, 0xe3, 0xf1, 0xf5, 0xff, 0xe2, 0xf1, 0xf6, 0xff, 0xe5, 0xf5, 0xf9, 0xff, 0x8f, 0xcf, 0xe4, 0xff, 0x80, 0xca, 0xe0, 0xff, 0x86, 0xcc, 0xe2, 0xff, 0x86, 0xcc, 0xe2, 0xff, 0x7f, 0xca, 0xe1, 0xff, 0xc7, 0xe8, 0xf2, 0xff, 0xed, 0xf7, 0xfa, 0xff, 0xe6, 0xf5, 0xf9, 0xff, 0xe5, 0xf4, 0xf8, 0xff, 0xd7, 0xeb, 0xf2, 0xff, 0xe2, 0xf2, 0xf7, 0xff, 0xb5, 0xdb, 0xe9, 0xff, 0x2f, 0x9b, 0xb8, 0xff, 0x34, 0xa0, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x32, 0x9b, 0xb5, 0xff, 0x2e, 0x7d, 0x91, 0xfe,
-    0x2f, 0x7e, 0x91, 0xf3, 0x32, 0x9a, 0xb4, 0xff, 0x33, 0xa0, 0xbc, 0xff, 0x34, 0xa0, 0xbb, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x4f, 0xaf, 0xc7, 0xff, 0xb1, 0xeb, 0xf4, 0xff, 0x99, 0xdd, 0xee, 0xff, 0x4e, 0x75, 0x81, 0xff, 0x31, 0x4b, 0x53, 0xff, 0x26, 0x42, 0x4a, 0xff, 0xa3, 0xb3, 0xb7, 0xff, 0xf1, 0xfd, 0xff, 0xff, 0xe1, 0xf0, 0xf4, 0xff, 0xde, 0xef, 0xf7, 0xff, 0xe2, 0xf1, 0xf8, 0xff, 0xe6, 0xf5, 0xf9, 0xff, 0x92, 0xd1, 0xe5, 0xff, 0x82, 0xcb, 0xe1, 0xff, 0x86, 0xcc, 0xe2, 0xff, 0x84, 0xcb, 0xe1, 0xff, 0x83, 0xcb, 0xe2, 0xff, 0xd3, 0xed, 0xf6, 0xff, 0xed, 0xf8, 0xfc, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xe0, 0xf1, 0xf6, 0xff, 0xd6, 0xea, 0xf2, 0xff, 0xe2, 0xf1, 0xf7, 0xff, 0xb0, 0xd9, 0xe9, 0xff, 0x33, 0x9c, 0xbb, 0xff, 0x33, 0x9f, 0xb9, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0xa0, 0xbc, 0xff, 0x32, 0x9a, 0xb4, 0xff, 0x2f, 0x7e, 0x91, 0xf3,
-    0x2e, 0x7d, 0x90, 0xdb, 0x32, 0x98, 0xb2, 0xff, 0x33, 0xa1, 0xbc, 0xfe, 0x34, 0x9f, 0xba, 0xff, 0x31, 0x9e, 0xb9, 0xff, 0x3e, 0xa5, 0xbf, 0xff, 0xa2, 0xe0, 0xee, 0xff, 0xa6, 0xeb, 0xfc, 0xff, 0x71, 0xa6, 0xb4, 0xff, 0x2d, 0x45, 0x4d, 0xff, 0x27, 0x44, 0x4d, 0xff, 0x9d, 0xa9, 0xad, 0xff, 0xeb, 0xf4, 0xf5, 0xff, 0xde, 0xeb, 0xf0, 0xff, 0xd9, 0xe5, 0xea, 0xff, 0xdb, 0xe6, 0xea, 0xff, 0xe5, 0xf3, 0xf8, 0xff, 0x92, 0xd2, 0xe5, 0xff, 0x81, 0xcb, 0xe1, 0xff, 0x87, 0xcd, 0xe3, 0xff, 0x88, 0xcf, 0xe5, 0xff, 0x96, 0xd6, 0xeb, 0xff, 0xe4, 0xf6, 0xfb, 0xff, 0xe9, 0xf6, 0xfa, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xda, 0xec, 0xf3, 0xff, 0xd6, 0xeb, 0xf3, 0xff, 0xe2, 0xf0, 0xf5, 0xff, 0x9e, 0xd1, 0xe5, 0xff, 0x36, 0x9d, 0xc0, 0xff, 0x34, 0x9f, 0xb8, 0xff, 0x33, 0x9f, 0xbb, 0xff, 0x33, 0x9f, 0xb9, 0xff, 0x33, 0xa1, 0xbc, 0xfe, 0x32, 0x98, 0xb2, 0xff, 0x2e, 0x7d, 0x90, 0xdb,
-    0x2e, 0x7d, 0x90, 0xb1, 0x33, 0x95, 0xad, 0xff, 0x33, 0xa2, 0xbd, 0xfd, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x31, 0x9d, 0xb8, 0xff, 0x89, 0xd3, 0xe5, 0xff, 0xa3, 0xe5, 0xf6, 0xff, 0x8f, 0xd7, 0xec, 0xff, 0x57, 0x85, 0x94, 0xff, 0x39, 0x5a, 0x66, 0xff, 0xa6, 0xba, 0xc1, 0xff, 0xe2, 0xe9, 0xeb, 0xff, 0xd7, 0xe0, 0xe3, 0xff, 0xd7, 0xdf, 0xe2, 0xff, 0xdc, 0xe6, 0xea, 0xff, 0xe3, 0xf4, 0xf9, 0xff, 0x94, 0xd2, 0xe5, 0xff, 0x85, 0xcc, 0xe3, 0xff, 0x94, 0xd6, 0xeb, 0xff, 0x8b, 0xd3, 0xec, 0xff, 0xb6, 0xe3, 0xf2, 0xff, 0xed, 0xf8, 0xfa, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xe2, 0xf1, 0xf6, 0xff, 0xd7, 0xeb, 0xf2, 0xff, 0xd7, 0xec, 0xf3, 0xff, 0xe1, 0xef, 0xf4, 0xff, 0x7b, 0xbf, 0xd9, 0xff, 0x3b, 0xa1, 0xc5, 0xff, 0x36, 0x9d, 0xb8, 0xff, 0x33, 0xa0, 0xbb, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0xa2, 0xbe, 0xfc, 0x33, 0x95, 0xad, 0xff, 0x2e, 0x7d, 0x90, 0xb1,
-    0x2f, 0x7e, 0x92, 0x75, 0x32, 0x8d, 0xa4, 0xff, 0x33, 0xa1, 0xbd, 0xfd, 0x33, 0x9e, 0xb9, 0xff, 0x35, 0xa0, 0xbb, 0xff, 0x2b, 0x9a, 0xb6, 0xff, 0x61, 0xbb, 0xd1, 0xff, 0xa2, 0xe4, 0xf6, 0xff, 0x87, 0xd8, 0xf3, 0xff, 0x78, 0xca, 0xe5, 0xff, 0x4d, 0x98, 0xb1, 0xff, 0xac, 0xd1, 0xde, 0xff, 0xe9, 0xf5, 0xf8, 0xff, 0xde, 0xef, 0xf5, 0xff, 0xe2, 0xf1, 0xf6, 0xff, 0xe5, 0xf4, 0xf8, 0xff, 0xe5, 0xf5, 0xf9, 0xff, 0x8d, 0xcf, 0xe3, 0xff, 0x7d, 0xc9, 0xe1, 0xff, 0x89, 0xd1, 0xea, 0xff, 0xa4, 0xdc, 0xef, 0xff, 0xe5, 0xf5, 0xfa, 0xff, 0xe8, 0xf6, 0xf9, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xda, 0xec, 0xf3, 0xff, 0xd7, 0xeb, 0xf2, 0xff, 0xd9, 0xec, 0xf2, 0xff, 0xd3, 0xe7, 0xf0, 0xff, 0x4d, 0xa4, 0xc7, 0xff, 0x41, 0xa3, 0xc8, 0xff, 0x38, 0xa0, 0xbc, 0xff, 0x32, 0x9f, 0xb9, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0xa1, 0xbd, 0xfd, 0x32, 0x8d, 0xa4, 0xff, 0x2f, 0x7e, 0x92, 0x75,
-    0x31, 0x85, 0x9b, 0x2e, 0x2f, 0x81, 0x94, 0xf9, 0x33, 0x9e, 0xb9, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x31, 0x9e, 0xb9, 0xff, 0x39, 0xa3, 0xbd, 0xff, 0x8d, 0xd8, 0xed, 0xff, 0x9b, 0xdf, 0xf5, 0xff, 0xba, 0xe7, 0xf5, 0xff, 0xaf, 0xe2, 0xf2, 0xff, 0xd1, 0xed, 0xf5, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xe4, 0xf4, 0xf9, 0xff, 0xe6, 0xf5, 0xfa, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xc5, 0xe7, 0xf2, 0xff, 0xbc, 0xe3, 0xef, 0xff, 0xc5, 0xe8, 0xf3, 0xff, 0xe8, 0xf7, 0xfb, 0xff, 0xea, 0xf6, 0xfa, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xe0, 0xf0, 0xf6, 0xff, 0xd8, 0xeb, 0xf2, 0xff, 0xd5, 0xe9, 0xf1, 0xff, 0xe0, 0xeb, 0xf1, 0xff, 0xa0, 0xcc, 0xdf, 0xff, 0x2f, 0x93, 0xbc, 0xff, 0x47, 0xa6, 0xca, 0xff, 0x3b, 0xa3, 0xc1, 0xff, 0x32, 0x9e, 0xb9, 0xff, 0x33, 0x9f, 0xba, 0xff, 0x33, 0x9e, 0xb9, 0xff, 0x2f, 0x81, 0x94, 0xf9, 0x31, 0x85, 0x9b, 0x2e,
-    0x00, 0xff, 0xff, 0x01, 0x2e, 0x7c, 0x90, 0xc1, 0x33, 0x98, 0xb2, 0xfe, 0x33, 0xa1, 0xbe, 0xfc, 0x34, 0x9f, 0xba, 0xff, 0x30, 0x9d, 0xb8, 0xff, 0x46, 0xab, 0xc5, 0xff, 0x6c, 0xc2, 0xdf, 0xff, 0x96, 0xd5, 0xeb, 0xff, 0xf4, 0xfd, 0xfe, 0xff, 0xee, 0xf9, 0xfd, 0xff, 0xe8, 0xf6, 0xfb, 0xff, 0xe4, 0xf5, 0xfa, 0xff, 0xe7, 0xf6, 0xfb, 0xff, 0xe6, 0xf5, 0xfa, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xe7, 0xf6, 0xfa, 0xff, 0xef, 0xf9, 0xfc, 0xff, 0xf1, 0xfa, 0xfd, 0xff, 0xf0, 0xfa, 0xfd, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xe4, 0xf3, 0xf8, 0xff, 0xe7, 0xf5, 0xf9, 0xff, 0xe1, 0xf1, 0xf6, 0xff, 0xd6, 0xe9, 0xf1, 0xff, 0xd7, 0xe6, 0xee, 0xff, 0xd6, 0xe5, 0xed, 0xff, 0x55, 0xa9, 0xcb, 0xff, 0x3a, 0x9e, 0xc5, 0xff, 0x48, 0xa8, 0xcd, 0xff, 0x3b, 0xa2, 0xc1, 0xff, 0x31, 0x9e, 0xb8, 0xff, 0x33, 0xa1, 0xbe, 0xfc, 0x33, 0x98, 0xb2, 0xfe, 0x2e, 0x7c, 0x90, 0xc1, 0x00, 0xff, 0xff, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x2f, 0x80, 0x94, 0x5b, 0x32, 0x8b, 0xa1, 0xff, 0x33, 0xa0, 0xbc, 0xfc, 0x34, 0x9f, 0xba, 0xff, 0x2e, 0x9c, 0xb7, 0xff, 0x52, 0xb2, 0xcc, 0xff, 0x72, 0xc6, 0xe2, 0xff, 0x78, 0xbf, 0xd9, 0xff, 0xe6, 0xf5, 0xf9, 0xff, 0xe5, 0xf7, 0xfc, 0xff, 0xe7, 0xf7, 0xfc, 0xff, 0xe7, 0xf7, 0xfc, 0xff, 0xe7, 0xf7, 0xfc, 0xff, 0xe7, 0xf7, 0xfc, 0xff, 0xe8, 0xf7, 0xfc, 0xff, 0xe8, 0xf8, 0xfd, 0xff, 0xe7, 0xf7, 0xfc, 0xff, 0xe5, 0xf6, 0xfb, 0xff, 0xe0, 0xf1, 0xf7, 0xff, 0xde, 0xef, 0xf5, 0xff, 0xe6, 0xf4, 0xf8, 0xff, 0xe7, 0xf6, 0xfa, 0xff, 0xe3, 0xf3, 0xf8, 0xff, 0xda, 0xec, 0xf3, 0xff, 0xde, 0xe8, 0xf0, 0xff, 0x7c, 0xbd, 0xd7, 0xff, 0x40, 0xa6, 0xcb, 0xff, 0x64, 0xb9, 0xd4, 0xff, 0x57, 0xb0, 0xd0, 0xff, 0x35, 0x9d, 0xbd, 0xff, 0x33, 0x9f, 0xb9, 0xff, 0x33, 0xa0, 0xbc, 0xfc, 0x32, 0x8b, 0xa1, 0xff, 0x2f, 0x80, 0x94, 0x5b, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x01, 0x48, 0xb6, 0xb6, 0x07, 0x2e, 0x7d, 0x8e, 0xd6, 0x33, 0x97, 0xb0, 0xfe, 0x34, 0xa2, 0xbe, 0xfd, 0x2e, 0x9b, 0xb6, 0xff, 0x53, 0xb3, 0xcd, 0xff, 0x7a, 0xcc, 0xe7, 0xff, 0x8c, 0xcf, 0xe5, 0xff, 0xe0, 0xef, 0xf5, 0xff, 0xdf, 0xf1, 0xf7, 0xff, 0xe3, 0xf4, 0xfa, 0xff, 0xe5, 0xf6, 0xfb, 0xff, 0xe5, 0xf6, 0xfb, 0xff, 0xe4, 0xf5, 0xfa, 0xff, 0xe2, 0xf3, 0xf9, 0xff, 0xe1, 0xf2, 0xf8, 0xff, 0xde, 0xf0, 0xf6, 0xff, 0xda, 0xed, 0xf3, 0xff, 0xdd, 0xef, 0xf4, 0xff, 0xe4, 0xf4, 0xf8, 0xff, 0xe6, 0xf5, 0xf9, 0xff, 0xe8, 0xf5, 0xf9, 0xff, 0xec, 0xf7, 0xfa, 0xff, 0xdb, 0xeb, 0xf2, 0xff, 0x84, 0xc0, 0xd7, 0xff, 0x58, 0xb2, 0xd0, 0xff, 0x6f, 0xbe, 0xd7, 0xff, 0x7a, 0xc5, 0xda, 0xff, 0x5b, 0xb1, 0xcf, 0xff, 0x34, 0x9b, 0xbd, 0xff, 0x33, 0xa2, 0xbd, 0xfd, 0x33, 0x97, 0xb0, 0xfe, 0x2e, 0x7d, 0x8e, 0xd6, 0x48, 0xb6, 0xb6, 0x07, 0x00, 0xff, 0xff, 0x01,
-    0x55, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x84, 0x99, 0x4b, 0x30, 0x85, 0x9a, 0xff, 0x33, 0x9f, 0xb9, 0xfb, 0x2e, 0x9d, 0xb7, 0xff, 0x5f, 0xba, 0xd4, 0xff, 0x79, 0xcc, 0xe7, 0xff, 0x97, 0xd7, 0xeb, 0xff, 0xed, 0xf8, 0xfc, 0xff, 0xe1, 0xf1, 0xf7, 0xff, 0xe2, 0xf0, 0xf6, 0xff, 0xe2, 0xf1, 0xf5, 0xff, 0xe2, 0xf1, 0xf6, 0xff, 0xe2, 0xf0, 0xf5, 0xff, 0xdf, 0xef, 0xf4, 0xff, 0xe0, 0xef, 0xf4, 0xff, 0xe2, 0xf0, 0xf5, 0xff, 0xe6, 0xf4, 0xf7, 0xff, 0xe9, 0xf6, 0xf9, 0xff, 0xe8, 0xf5, 0xf8, 0xff, 0xe8, 0xf5, 0xf8, 0xff, 0xe3, 0xf3, 0xf7, 0xff, 0xc1, 0xe3, 0xed, 0xff, 0x81, 0xc5, 0xda, 0xff, 0x6d, 0xbf, 0xd7, 0xff, 0x81, 0xcb, 0xdf, 0xff, 0x7a, 0xc6, 0xdb, 0xff, 0x75, 0xc3, 0xd9, 0xff, 0x51, 0xa9, 0xcb, 0xff, 0x35, 0x9c, 0xbe, 0xff, 0x32, 0x9f, 0xb9, 0xfb, 0x31, 0x86, 0x9a, 0xff, 0x33, 0x84, 0x99, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xaa, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x7e, 0x92, 0x9b, 0x33, 0x90, 0xa6, 0xff, 0x2f, 0xa0, 0xbb, 0xfa, 0x64, 0xbd, 0xd7, 0xff, 0x7c, 0xcd, 0xe7, 0xff, 0x80, 0xcd, 0xe6, 0xff, 0x98, 0xd7, 0xeb, 0xff, 0x94, 0xd4, 0xe9, 0xff, 0x7d, 0xc1, 0xdb, 0xff, 0x7c, 0xc1, 0xdb, 0xff, 0x75, 0xb9, 0xd2, 0xff, 0x70, 0xb5, 0xcd, 0xff, 0x83, 0xc4, 0xd9, 0xff, 0x93, 0xcf, 0xe1, 0xff, 0x91, 0xce, 0xe1, 0xff, 0x91, 0xcf, 0xe1, 0xff, 0x91, 0xce, 0xe0, 0xff, 0x91, 0xce, 0xe0, 0xff, 0x90, 0xce, 0xe0, 0xff, 0x81, 0xc7, 0xdc, 0xff, 0x6d, 0xbd, 0xd6, 0xff, 0x76, 0xc6, 0xdb, 0xff, 0x83, 0xce, 0xe0, 0xff, 0x82, 0xce, 0xe1, 0xff, 0x7f, 0xcc, 0xdf, 0xff, 0x77, 0xc4, 0xda, 0xff, 0x4d, 0xa7, 0xc9, 0xff, 0x36, 0x9e, 0xc2, 0xfa, 0x33, 0x90, 0xa6, 0xff, 0x2f, 0x7e, 0x92, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x7f, 0x7f, 0x02, 0x33, 0xb2, 0xcc, 0x0a, 0x2f, 0x7f, 0x92, 0xc8, 0x31, 0x91, 0xa9, 0xff, 0x70, 0xc8, 0xe3, 0xfb, 0x7d, 0xcc, 0xe6, 0xff, 0x77, 0xc9, 0xe3, 0xff, 0x74, 0xc9, 0xe4, 0xff, 0x72, 0xc7, 0xe2, 0xff, 0x49, 0xa4, 0xc3, 0xff, 0x4c, 0xa7, 0xc8, 0xff, 0x46, 0xa1, 0xc2, 0xff, 0x4f, 0xa7, 0xc4, 0xff, 0x6c, 0xbd, 0xd6, 0xff, 0x6d, 0xbf, 0xd7, 0xff, 0x6d, 0xbe, 0xd6, 0xff, 0x6d, 0xbe, 0xd6, 0xff, 0x6d, 0xbe, 0xd6, 0xff, 0x6d, 0xbe, 0xd6, 0xff, 0x6c, 0xbe, 0xd6, 0xff, 0x6f, 0xbe, 0xd7, 0xff, 0x7a, 0xc7, 0xdc, 0xff, 0x82, 0xce, 0xe1, 0xff, 0x81, 0xcd, 0xe0, 0xff, 0x80, 0xcc, 0xe0, 0xff, 0x80, 0xcc, 0xdf, 0xff, 0x6c, 0xbc, 0xd5, 0xff, 0x40, 0xa1, 0xc9, 0xfb, 0x36, 0x90, 0xae, 0xff, 0x2f, 0x7f, 0x91, 0xc8, 0x33, 0xb2, 0xcc, 0x0a, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x33, 0x99, 0xad, 0x19, 0x2c, 0x7d, 0x90, 0xd5, 0x5b, 0xab, 0xc3, 0xff, 0x82, 0xd4, 0xed, 0xfa, 0x7a, 0xcb, 0xe5, 0xff, 0x7a, 0xca, 0xe3, 0xff, 0x7c, 0xcd, 0xe6, 0xff, 0x59, 0xae, 0xca, 0xff, 0x49, 0xa0, 0xbe, 0xff, 0x56, 0xaa, 0xc7, 0xff, 0x73, 0xc1, 0xd8, 0xff, 0x76, 0xc2, 0xd9, 0xff, 0x74, 0xc1, 0xd8, 0xff, 0x75, 0xc2, 0xd8, 0xff, 0x74, 0xc1, 0xd8, 0xff, 0x73, 0xc1, 0xd8, 0xff, 0x74, 0xc1, 0xd8, 0xff, 0x78, 0xc5, 0xdb, 0xff, 0x7d, 0xc9, 0xdd, 0xff, 0x82, 0xce, 0xe0, 0xff, 0x81, 0xcd, 0xe0, 0xff, 0x80, 0xcd, 0xe0, 0xff, 0x83, 0xce, 0xe0, 0xff, 0x75, 0xc4, 0xda, 0xff, 0x45, 0xa5, 0xca, 0xfa, 0x35, 0x8f, 0xae, 0xff, 0x2f, 0x80, 0x93, 0xd5, 0x33, 0x99, 0xad, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x31, 0x93, 0xa6, 0x1a, 0x2b, 0x7e, 0x91, 0xc6, 0x51, 0xa2, 0xb9, 0xff, 0x7b, 0xca, 0xe4, 0xfc, 0x7e, 0xd0, 0xeb, 0xfd, 0x7c, 0xcc, 0xe5, 0xff, 0x57, 0xac, 0xc9, 0xff, 0x5e, 0xb1, 0xcb, 0xff, 0x73, 0xc1, 0xd9, 0xff, 0x74, 0xc2, 0xd8, 0xff, 0x73, 0xc1, 0xd8, 0xff, 0x73, 0xc1, 0xd8, 0xff, 0x72, 0xc0, 0xd8, 0xff, 0x74, 0xc2, 0xd9, 0xff, 0x78, 0xc6, 0xdb, 0xff, 0x7e, 0xcb, 0xdf, 0xff, 0x82, 0xce, 0xe0, 0xff, 0x82, 0xce, 0xe0, 0xff, 0x81, 0xcd, 0xe0, 0xff, 0x7f, 0xcb, 0xdf, 0xff, 0x82, 0xce, 0xe0, 0xff, 0x81, 0xce, 0xe3, 0xfd, 0x49, 0xa5, 0xc8, 0xfc, 0x32, 0x8c, 0xa8, 0xff, 0x30, 0x82, 0x94, 0xc6, 0x31, 0x93, 0xa6, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xb2, 0xcc, 0x0a, 0x28, 0x7d, 0x91, 0x99, 0x3e, 0x8e, 0xa2, 0xff, 0x68, 0xb7, 0xd0, 0xff, 0x67, 0xbc, 0xd7, 0xfc, 0x5a, 0xb2, 0xce, 0xfc, 0x76, 0xc3, 0xd9, 0xfe, 0x75, 0xc2, 0xd8, 0xff, 0x72, 0xc0, 0xd7, 0xff, 0x72, 0xc0, 0xd7, 0xff, 0x71, 0xbf, 0xd7, 0xff, 0x76, 0xc3, 0xda, 0xff, 0x81, 0xcd, 0xdf, 0xff, 0x82, 0xcd, 0xe0, 0xff, 0x81, 0xcd, 0xe0, 0xff, 0x80, 0xcc, 0xdf, 0xff, 0x7f, 0xcb, 0xdf, 0xff, 0x81, 0xcd, 0xe0, 0xfe, 0x87, 0xd3, 0xe6, 0xfc, 0x81, 0xce, 0xe2, 0xfc, 0x45, 0x9e, 0xbc, 0xff, 0x2f, 0x82, 0x9b, 0xff, 0x32, 0x83, 0x96, 0x99, 0x33, 0xb2, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x81, 0x94, 0x4f, 0x2c, 0x7e, 0x91, 0xd0, 0x3a, 0x90, 0xa7, 0xff, 0x4d, 0xa7, 0xc3, 0xff, 0x5f, 0xb6, 0xd1, 0xff, 0x65, 0xbc, 0xd7, 0xfd, 0x76, 0xc5, 0xdd, 0xfd, 0x77, 0xc5, 0xdc, 0xfe, 0x7b, 0xc8, 0xde, 0xff, 0x82, 0xcf, 0xe2, 0xff, 0x83, 0xcf, 0xe2, 0xff, 0x83, 0xcf, 0xe2, 0xff, 0x84, 0xd0, 0xe3, 0xfe, 0x87, 0xd3, 0xe6, 0xfd, 0x88, 0xd3, 0xe5, 0xfd, 0x82, 0xcc, 0xdf, 0xff, 0x70, 0xbd, 0xcf, 0xff, 0x44, 0x95, 0xab, 0xff, 0x2a, 0x7e, 0x91, 0xd0, 0x33, 0x8a, 0x9a, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0x05, 0x2c, 0x85, 0x95, 0x5c, 0x2d, 0x7e, 0x91, 0xbd, 0x31, 0x83, 0x99, 0xf6, 0x43, 0x98, 0xaf, 0xff, 0x63, 0xb1, 0xc5, 0xff, 0x72, 0xbd, 0xd0, 0xff, 0x7a, 0xc4, 0xd7, 0xff, 0x7c, 0xc7, 0xd9, 0xff, 0x7c, 0xc6, 0xd9, 0xff, 0x79, 0xc4, 0xd7, 0xff, 0x73, 0xbf, 0xd2, 0xff, 0x66, 0xb3, 0xc6, 0xff, 0x52, 0xa0, 0xb4, 0xff, 0x3c, 0x89, 0x9d, 0xf6, 0x2a, 0x7c, 0x90, 0xbe, 0x26, 0x7f, 0x95, 0x5c, 0x66, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8a, 0x9b, 0x2e, 0x2a, 0x7e, 0x90, 0x73, 0x2a, 0x7c, 0x8f, 0xae, 0x2f, 0x7e, 0x91, 0xd9, 0x34, 0x81, 0x94, 0xf4, 0x36, 0x82, 0x95, 0xfe, 0x36, 0x82, 0x95, 0xfe, 0x34, 0x81, 0x94, 0xf4, 0x2f, 0x7e, 0x91, 0xd9, 0x29, 0x7b, 0x8e, 0xae, 0x23, 0x78, 0x8c, 0x74, 0x20, 0x82, 0x97, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_image_dsc_t img_doge_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_doge_logo_data),
-    .data = img_doge_logo_data,
-};
-
-// solana.png -> 36x36 ARGB8888
-static const uint8_t img_solana_logo_data[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x00, 0x02, 0x7f, 0x7f, 0x00, 0x02, 0x7f, 0x7f, 0x00, 0x02, 0x7f, 0x7f, 0x00, 0x02, 0x7f, 0x7f, 0x00, 0x02, 0x7f, 0x7f, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02, 0x7f, 0xff, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xca, 0xb8, 0x4f, 0x1d, 0xcc, 0xb8, 0x4c, 0x28, 0xc4, 0xb7, 0x47, 0x27, 0xc4, 0xbd, 0x47, 0x27, 0xc4, 0xbd, 0x47, 0x27, 0xc4, 0xc4, 0x41, 0x27, 0xc4, 0xc4, 0x41, 0x27, 0xbd, 0xc4, 0x41, 0x27, 0xbd, 0xca, 0x3a, 0x27, 0xbd, 0xca, 0x3a, 0x27, 0xbd, 0xca, 0x34, 0x27, 0xbd, 0xd1, 0x34, 0x27, 0xbd, 0xd1, 0x34, 0x27, 0xbd, 0xd1, 0x2d, 0x27, 0xb7, 0xd7, 0x2d, 0x27, 0xb7, 0xd7, 0x27, 0x27, 0xb7, 0xde, 0x27, 0x27, 0xb7, 0xde, 0x27, 0x27, 0xb7, 0xde, 0x20, 0x27, 0xb0, 0xe4, 0x20, 0x27, 0xb0, 0xe4, 0x1a, 0x27, 0xb0, 0xe4, 0x1a, 0x27, 0xb0, 0xeb, 0x1a, 0x27, 0xb0, 0xeb, 0x13, 0x27, 0xb0, 0xf1, 0x13, 0x27, 0xb0, 0xf1, 0x13, 0x27, 0xaa, 0xf1, 0x0d, 0x27, 0xaa, 0xf8, 0x0d, 0x27, 0xaa, 0xf8, 0x06, 0x27, 0xaa, 0xff, 0x08, 0x1e,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xb1, 0x55, 0x6c, 0xcd, 0xb4, 0x53, 0xf4, 0xc4, 0xb1, 0x4e, 0xfa, 0xc3, 0xb2, 0x4b, 0xfc, 0xc2, 0xb5, 0x48, 0xfc, 0xc1, 0xb7, 0x46, 0xfc, 0xc0, 0xba, 0x44, 0xfc, 0xbf, 0xbc, 0x41, 0xfc, 0xbe, 0xbe, 0x3f, 0xfc, 0xbd, 0xc1, 0x3c, 0xfc, 0xbc, 0xc3, 0x3a, 0xfc, 0xbb, 0xc6, 0x38, 0xfc, 0xba, 0xc8, 0x36, 0xfc, 0xb9, 0xca, 0x33, 0xfc, 0xb8, 0xcd, 0x31, 0xfc, 0xb7, 0xcf, 0x2f, 0xfc, 0xb6, 0xd2, 0x2c, 0xfc, 0xb5, 0xd4, 0x2a, 0xfc, 0xb4, 0xd6, 0x28, 0xfc, 0xb3, 0xd9, 0x25, 0xfc, 0xb2, 0xdb, 0x23, 0xfc, 0xb1, 0xde, 0x21, 0xfc, 0xb0, 0xe0, 0x1e, 0xfc, 0xaf, 0xe3, 0x1c, 0xfc, 0xae, 0xe5, 0x19, 0xfc, 0xad, 0xe7, 0x17, 0xfc, 0xac, 0xea, 0x15, 0xfc, 0xab, 0xec, 0x12, 0xfc, 0xa8, 0xed, 0x10, 0xfb, 0xab, 0xf4, 0x0e, 0xfe, 0xa8, 0xf4, 0x0b, 0xf0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xa8, 0x5d, 0x6d, 0xd4, 0xb0, 0x5c, 0xff, 0xc8, 0xaa, 0x55, 0xff, 0xc5, 0xab, 0x52, 0xff, 0xc5, 0xae, 0x50, 0xff, 0xc4, 0xb1, 0x4e, 0xff, 0xc3, 0xb3, 0x4b, 0xff, 0xc2, 0xb6, 0x49, 0xff, 0xc1, 0xb8, 0x47, 0xff, 0xc0, 0xba, 0x44, 0xff, 0xbf, 0xbd, 0x42, 0xff, 0xbe, 0xbf, 0x40, 0xff, 0xbd, 0xc1, 0x3d, 0xff, 0xbc, 0xc4, 0x3b, 0xff, 0xbb, 0xc6, 0x38, 0xff, 0xba, 0xc9, 0x36, 0xff, 0xb9, 0xcb, 0x34, 0xff, 0xb8, 0xce, 0x31, 0xff, 0xb7, 0xd0, 0x2f, 0xff, 0xb6, 0xd2, 0x2d, 0xff, 0xb5, 0xd5, 0x2a, 0xff, 0xb4, 0xd7, 0x28, 0xff, 0xb3, 0xda, 0x26, 0xff, 0xb2, 0xdc, 0x23, 0xff, 0xb1, 0xdf, 0x21, 0xff, 0xb0, 0xe1, 0x1e, 0xff, 0xaf, 0xe3, 0x1c, 0xff, 0xaf, 0xe6, 0x1a, 0xff, 0xab, 0xe6, 0x17, 0xfe, 0xb0, 0xf0, 0x15, 0xff, 0xaf, 0xf1, 0x13, 0xf6, 0xab, 0xf2, 0x0f, 0x52,
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xa1, 0x64, 0x6d, 0xd6, 0xa9, 0x63, 0xff, 0xca, 0xa2, 0x5c, 0xfc, 0xc7, 0xa3, 0x59, 0xfe, 0xc7, 0xa6, 0x57, 0xff, 0xc6, 0xa8, 0x54, 0xfe, 0xc5, 0xab, 0x52, 0xfe, 0xc4, 0xad, 0x4f, 0xfe, 0xc3, 0xb0, 0x4d, 0xfe, 0xc2, 0xb2, 0x4b, 0xfe, 0xc1, 0xb5, 0x48, 0xfe, 0xc0, 0xb7, 0x46, 0xfe, 0xbf, 0xb9, 0x44, 0xfe, 0xbe, 0xbc, 0x42, 0xfe, 0xbd, 0xbe, 0x3f, 0xfe, 0xbc, 0xc1, 0x3d, 0xfe, 0xbb, 0xc3, 0x3a, 0xfe, 0xba, 0xc5, 0x38, 0xfe, 0xb9, 0xc8, 0x36, 0xfe, 0xb8, 0xca, 0x33, 0xfe, 0xb7, 0xcd, 0x31, 0xfe, 0xb6, 0xcf, 0x2f, 0xfe, 0xb5, 0xd1, 0x2c, 0xfe, 0xb4, 0xd4, 0x2a, 0xfe, 0xb3, 0xd6, 0x27, 0xfe, 0xb2, 0xd9, 0x25, 0xfe, 0xb1, 0xdb, 0x23, 0xfe, 0xb0, 0xde, 0x20, 0xff, 0xaf, 0xe0, 0x1e, 0xfc, 0xb1, 0xe6, 0x1c, 0xff, 0xb4, 0xee, 0x1a, 0xf7, 0xac, 0xe9, 0x15, 0x47, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x9a, 0x6b, 0x6d, 0xda, 0xa1, 0x6b, 0xff, 0xcd, 0x9b, 0x63, 0xfc, 0xca, 0x9c, 0x60, 0xfe, 0xca, 0xa0, 0x5e, 0xff, 0xc9, 0xa2, 0x5c, 0xff, 0xc8, 0xa4, 0x59, 0xff, 0xc7, 0xa7, 0x57, 0xff, 0xc6, 0xa9, 0x54, 0xff, 0xc5, 0xac, 0x52, 0xff, 0xc4, 0xae, 0x50, 0xff, 0xc3, 0xb0, 0x4d, 0xff, 0xc2, 0xb3, 0x4b, 0xff, 0xc1, 0xb5, 0x49, 0xff, 0xc0, 0xb7, 0x46, 0xff, 0xbf, 0xba, 0x44, 0xff, 0xbe, 0xbc, 0x41, 0xff, 0xbd, 0xbf, 0x3f, 0xff, 0xbc, 0xc1, 0x3d, 0xff, 0xbb, 0xc4, 0x3a, 0xff, 0xba, 0xc6, 0x38, 0xff, 0xb9, 0xc8, 0x36, 0xff, 0xb8, 0xcb, 0x33, 0xff, 0xb7, 0xcd, 0x31, 0xff, 0xb6, 0xd0, 0x2f, 0xff, 0xb5, 0xd2, 0x2c, 0xff, 0xb4, 0xd5, 0x2a, 0xff, 0xb4, 0xd7, 0x27, 0xff, 0xb1, 0xd8, 0x25, 0xfd, 0xb4, 0xdf, 0x23, 0xff, 0xb7, 0xe6, 0x22, 0xf7, 0xaf, 0xdf, 0x1b, 0x4a, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0xd8, 0x94, 0x72, 0x69, 0xdc, 0x9a, 0x72, 0xff, 0xd0, 0x94, 0x6a, 0xfa, 0xce, 0x95, 0x67, 0xfc, 0xcd, 0x99, 0x64, 0xfd, 0xcc, 0x9b, 0x62, 0xfd, 0xcb, 0x9d, 0x5f, 0xfd, 0xca, 0xa0, 0x5d, 0xfd, 0xc9, 0xa2, 0x5b, 0xfd, 0xc8, 0xa5, 0x58, 0xfd, 0xc7, 0xa7, 0x56, 0xfd, 0xc6, 0xa9, 0x53, 0xfd, 0xc5, 0xac, 0x51, 0xfd, 0xc4, 0xae, 0x4f, 0xfd, 0xc3, 0xb1, 0x4c, 0xfd, 0xc2, 0xb3, 0x4a, 0xfd, 0xc1, 0xb5, 0x48, 0xfd, 0xc0, 0xb8, 0x45, 0xfd, 0xbf, 0xba, 0x43, 0xfd, 0xbe, 0xbd, 0x41, 0xfd, 0xbd, 0xbf, 0x3e, 0xfd, 0xbc, 0xc1, 0x3c, 0xfd, 0xbb, 0xc4, 0x3a, 0xfd, 0xba, 0xc6, 0x37, 0xfd, 0xb9, 0xc8, 0x35, 0xfd, 0xb8, 0xcb, 0x33, 0xfd, 0xb7, 0xcd, 0x30, 0xfd, 0xb5, 0xcf, 0x2e, 0xfe, 0xb5, 0xd1, 0x2b, 0xfc, 0xb7, 0xd8, 0x2a, 0xff, 0xba, 0xde, 0x28, 0xf8, 0xb2, 0xd8, 0x26, 0x49, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xd8, 0x89, 0x79, 0x7e, 0xe2, 0x94, 0x7b, 0xff, 0xd8, 0x90, 0x74, 0xff, 0xd6, 0x92, 0x71, 0xff, 0xd6, 0x95, 0x6f, 0xff, 0xd5, 0x98, 0x6c, 0xff, 0xd4, 0x9a, 0x6a, 0xff, 0xd3, 0x9d, 0x68, 0xff, 0xd2, 0x9f, 0x65, 0xff, 0xd1, 0xa2, 0x63, 0xff, 0xd0, 0xa4, 0x60, 0xff, 0xcf, 0xa7, 0x5e, 0xff, 0xce, 0xa9, 0x5b, 0xff, 0xcd, 0xac, 0x59, 0xff, 0xcc, 0xae, 0x57, 0xff, 0xcb, 0xb1, 0x54, 0xff, 0xca, 0xb3, 0x52, 0xff, 0xc9, 0xb5, 0x4f, 0xff, 0xc8, 0xb8, 0x4d, 0xff, 0xc7, 0xbb, 0x4a, 0xff, 0xc6, 0xbd, 0x48, 0xff, 0xc5, 0xc0, 0x45, 0xff, 0xc4, 0xc2, 0x43, 0xff, 0xc3, 0xc5, 0x41, 0xff, 0xc1, 0xc7, 0x3e, 0xff, 0xc1, 0xc9, 0x3c, 0xff, 0xc0, 0xcc, 0x39, 0xff, 0xbf, 0xce, 0x37, 0xff, 0xbc, 0xd0, 0x34, 0xff, 0xc0, 0xd7, 0x33, 0xff, 0xbd, 0xd7, 0x2f, 0xf7, 0xb5, 0xd5, 0x2d, 0x49, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xda, 0x86, 0x7b, 0xd7, 0xd9, 0x87, 0x79, 0xde, 0xd6, 0x89, 0x76, 0xdc, 0xd5, 0x8b, 0x73, 0xdd, 0xd4, 0x8d, 0x71, 0xdd, 0xd3, 0x90, 0x6e, 0xdd, 0xd2, 0x93, 0x6c, 0xdd, 0xd0, 0x96, 0x6a, 0xdd, 0xcf, 0x98, 0x67, 0xdd, 0xcf, 0x9a, 0x65, 0xdd, 0xce, 0x9c, 0x63, 0xdd, 0xcd, 0x9f, 0x5f, 0xdd, 0xcc, 0xa2, 0x5e, 0xdd, 0xcb, 0xa5, 0x5b, 0xdd, 0xcb, 0xa6, 0x5a, 0xdd, 0xc9, 0xa9, 0x56, 0xdd, 0xc8, 0xab, 0x54, 0xdd, 0xc7, 0xae, 0x51, 0xdd, 0xc6, 0xb0, 0x4f, 0xdd, 0xc5, 0xb4, 0x4d, 0xdd, 0xc5, 0xb6, 0x4b, 0xdd, 0xc3, 0xb8, 0x48, 0xdd, 0xc3, 0xba, 0x46, 0xdd, 0xc1, 0xbd, 0x44, 0xdd, 0xc0, 0xbf, 0x40, 0xdd, 0xbf, 0xc1, 0x3f, 0xdd, 0xbe, 0xc5, 0x3c, 0xdd, 0xbe, 0xc7, 0x39, 0xdc, 0xbd, 0xc9, 0x37, 0xdd, 0xc2, 0xd3, 0x36, 0xd3, 0xba, 0xcc, 0x32, 0x47, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0xda, 0x6d, 0x6d, 0x07, 0xd4, 0x7f, 0x7f, 0x06, 0xd4, 0x7f, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0x7f, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xd4, 0x55, 0x06, 0xd4, 0xd4, 0x55, 0x06, 0xd4, 0xd4, 0x55, 0x06, 0xd4, 0xd4, 0x55, 0x06, 0xd4, 0xd4, 0x55, 0x06, 0xda, 0xda, 0x48, 0x07, 0x7f, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xaa, 0x55, 0xaa, 0x03, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0xff, 0xaa, 0x55, 0x03, 0xbf, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe4, 0x72, 0x8f, 0x8e, 0xe1, 0x74, 0x8c, 0x93, 0xe1, 0x77, 0x8a, 0x93, 0xde, 0x78, 0x88, 0x94, 0xde, 0x7c, 0x84, 0x94, 0xdc, 0x7d, 0x82, 0x94, 0xdc, 0x81, 0x81, 0x94, 0xda, 0x82, 0x7d, 0x94, 0xd9, 0x84, 0x7c, 0x94, 0xd9, 0x88, 0x78, 0x94, 0xd7, 0x89, 0x76, 0x94, 0xd7, 0x8d, 0x75, 0x94, 0xd5, 0x8f, 0x71, 0x94, 0xd5, 0x92, 0x6f, 0x94, 0xd3, 0x94, 0x6e, 0x94, 0xd2, 0x95, 0x6a, 0x94, 0xd2, 0x99, 0x69, 0x94, 0xd0, 0x9b, 0x65, 0x94, 0xd0, 0x9e, 0x63, 0x94, 0xce, 0xa0, 0x62, 0x94, 0xcd, 0xa3, 0x5e, 0x94, 0xcd, 0xa5, 0x5d, 0x94, 0xcb, 0xa8, 0x59, 0x94, 0xcb, 0xaa, 0x57, 0x94, 0xc9, 0xac, 0x56, 0x94, 0xc7, 0xaf, 0x52, 0x94, 0xc7, 0xb1, 0x50, 0x94, 0xc7, 0xb4, 0x4e, 0x93, 0xc6, 0xb8, 0x4b, 0x95, 0xca, 0xbe, 0x4b, 0x87, 0xbb, 0xbb, 0x43, 0x13, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe5, 0x6f, 0x93, 0xc9, 0xfb, 0x7d, 0xa0, 0xff, 0xe8, 0x77, 0x92, 0xff, 0xeb, 0x7c, 0x92, 0xff, 0xea, 0x7e, 0x90, 0xff, 0xe9, 0x81, 0x8d, 0xff, 0xe8, 0x83, 0x8b, 0xff, 0xe7, 0x86, 0x88, 0xff, 0xe6, 0x88, 0x86, 0xff, 0xe5, 0x8b, 0x83, 0xff, 0xe4, 0x8e, 0x81, 0xff, 0xe3, 0x90, 0x7e, 0xff, 0xe2, 0x93, 0x7b, 0xff, 0xe1, 0x95, 0x79, 0xff, 0xe0, 0x98, 0x76, 0xff, 0xdf, 0x9a, 0x74, 0xff, 0xde, 0x9d, 0x72, 0xff, 0xdc, 0x9f, 0x6f, 0xff, 0xdb, 0xa2, 0x6c, 0xff, 0xda, 0xa5, 0x6a, 0xff, 0xd9, 0xa7, 0x67, 0xff, 0xd8, 0xaa, 0x65, 0xff, 0xd7, 0xac, 0x62, 0xff, 0xd6, 0xaf, 0x60, 0xff, 0xd5, 0xb2, 0x5d, 0xff, 0xd4, 0xb4, 0x5a, 0xff, 0xd3, 0xb7, 0x58, 0xff, 0xd2, 0xba, 0x55, 0xff, 0xcf, 0xbb, 0x52, 0xff, 0xd5, 0xc4, 0x52, 0xff, 0xc7, 0xb9, 0x4b, 0xcd, 0xb9, 0xad, 0x45, 0x16, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x55, 0xff, 0x03, 0xe8, 0x6f, 0x97, 0xaa, 0xee, 0x72, 0x9a, 0xff, 0xdc, 0x6e, 0x8d, 0xf7, 0xdd, 0x70, 0x8c, 0xfb, 0xdc, 0x72, 0x89, 0xfb, 0xdb, 0x75, 0x87, 0xfb, 0xda, 0x77, 0x84, 0xfb, 0xd9, 0x7a, 0x82, 0xfb, 0xd8, 0x7c, 0x80, 0xfb, 0xd7, 0x80, 0x7c, 0xfb, 0xd6, 0x82, 0x7a, 0xfb, 0xd5, 0x84, 0x78, 0xfb, 0xd4, 0x87, 0x75, 0xfb, 0xd3, 0x89, 0x73, 0xfb, 0xd2, 0x8b, 0x71, 0xfb, 0xd1, 0x8e, 0x6f, 0xfb, 0xd0, 0x90, 0x6c, 0xfb, 0xcf, 0x93, 0x6a, 0xfb, 0xce, 0x95, 0x67, 0xfb, 0xcd, 0x97, 0x65, 0xfb, 0xcc, 0x9a, 0x63, 0xfb, 0xcb, 0x9c, 0x61, 0xfb, 0xca, 0x9e, 0x5e, 0xfb, 0xc9, 0xa0, 0x5c, 0xfb, 0xc8, 0xa3, 0x59, 0xfb, 0xc7, 0xa6, 0x57, 0xfb, 0xc6, 0xa8, 0x54, 0xfb, 0xc4, 0xaa, 0x51, 0xfc, 0xc3, 0xac, 0x50, 0xf9, 0xcf, 0xbb, 0x52, 0xff, 0xc8, 0xb6, 0x4d, 0xcd, 0xbf, 0xb2, 0x4c, 0x14, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xd4, 0x55, 0xaa, 0x06, 0xe9, 0x6b, 0x99, 0xb2, 0xf1, 0x71, 0x9d, 0xff, 0xdd, 0x6c, 0x8f, 0xfb, 0xde, 0x6f, 0x8e, 0xff, 0xdd, 0x71, 0x8b, 0xff, 0xdc, 0x74, 0x89, 0xff, 0xdb, 0x76, 0x87, 0xff, 0xda, 0x79, 0x84, 0xff, 0xd9, 0x7b, 0x82, 0xff, 0xd8, 0x7d, 0x7f, 0xff, 0xd7, 0x80, 0x7d, 0xff, 0xd6, 0x82, 0x7b, 0xff, 0xd5, 0x85, 0x78, 0xff, 0xd4, 0x87, 0x76, 0xff, 0xd3, 0x89, 0x74, 0xff, 0xd2, 0x8c, 0x71, 0xff, 0xd1, 0x8e, 0x6f, 0xff, 0xd0, 0x91, 0x6c, 0xff, 0xd0, 0x93, 0x6a, 0xff, 0xce, 0x96, 0x68, 0xff, 0xcd, 0x98, 0x65, 0xff, 0xcc, 0x9a, 0x63, 0xff, 0xcb, 0x9d, 0x61, 0xff, 0xca, 0x9f, 0x5e, 0xff, 0xc9, 0xa1, 0x5c, 0xff, 0xc9, 0xa4, 0x59, 0xff, 0xc7, 0xa6, 0x57, 0xff, 0xc7, 0xa9, 0x55, 0xff, 0xc5, 0xaa, 0x52, 0xfb, 0xd0, 0xb8, 0x54, 0xff, 0xca, 0xb5, 0x50, 0xcc, 0xc2, 0xb6, 0x48, 0x15, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03,
-    0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x66, 0xcc, 0x05, 0xea, 0x6a, 0x9d, 0xb1, 0xf2, 0x6f, 0x9f, 0xff, 0xdf, 0x69, 0x91, 0xfb, 0xdf, 0x6d, 0x90, 0xff, 0xde, 0x6f, 0x8e, 0xff, 0xdd, 0x71, 0x8b, 0xff, 0xdc, 0x74, 0x88, 0xff, 0xdb, 0x77, 0x86, 0xff, 0xda, 0x79, 0x84, 0xff, 0xd9, 0x7b, 0x81, 0xff, 0xd8, 0x7e, 0x7f, 0xff, 0xd7, 0x80, 0x7d, 0xff, 0xd6, 0x82, 0x7a, 0xff, 0xd5, 0x85, 0x78, 0xff, 0xd4, 0x87, 0x76, 0xff, 0xd3, 0x8a, 0x73, 0xff, 0xd2, 0x8c, 0x71, 0xff, 0xd1, 0x8f, 0x6e, 0xff, 0xd0, 0x91, 0x6c, 0xff, 0xcf, 0x93, 0x6a, 0xff, 0xce, 0x96, 0x67, 0xff, 0xcd, 0x98, 0x65, 0xff, 0xcc, 0x9a, 0x63, 0xff, 0xcb, 0x9d, 0x60, 0xff, 0xca, 0xa0, 0x5e, 0xff, 0xc9, 0xa2, 0x5b, 0xff, 0xc8, 0xa4, 0x59, 0xff, 0xc8, 0xa7, 0x57, 0xff, 0xc5, 0xa8, 0x54, 0xfb, 0xd1, 0xb6, 0x57, 0xff, 0xca, 0xb3, 0x52, 0xcd, 0xbf, 0xb2, 0x4c, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x00, 0x00, 0x01, 0xff, 0x55, 0xaa, 0x06, 0xec, 0x67, 0x9e, 0xb1, 0xf3, 0x6c, 0xa2, 0xff, 0xdf, 0x68, 0x92, 0xfa, 0xe0, 0x6a, 0x91, 0xfb, 0xde, 0x6d, 0x8f, 0xfb, 0xde, 0x6f, 0x8d, 0xfb, 0xdd, 0x71, 0x8a, 0xfb, 0xdc, 0x74, 0x88, 0xfb, 0xdb, 0x76, 0x86, 0xfb, 0xda, 0x78, 0x83, 0xfb, 0xd9, 0x7a, 0x81, 0xfb, 0xd8, 0x7d, 0x7e, 0xfb, 0xd7, 0x80, 0x7b, 0xfb, 0xd6, 0x83, 0x79, 0xfb, 0xd5, 0x85, 0x77, 0xfb, 0xd4, 0x88, 0x74, 0xfb, 0xd3, 0x8a, 0x72, 0xfb, 0xd2, 0x8c, 0x70, 0xfb, 0xd1, 0x8f, 0x6e, 0xfb, 0xd0, 0x91, 0x6b, 0xfb, 0xcf, 0x93, 0x69, 0xfb, 0xce, 0x96, 0x67, 0xfb, 0xcd, 0x98, 0x64, 0xfb, 0xcc, 0x9b, 0x62, 0xfb, 0xcb, 0x9d, 0x5f, 0xfb, 0xca, 0x9f, 0x5d, 0xfb, 0xc9, 0xa2, 0x5b, 0xfb, 0xc8, 0xa4, 0x58, 0xfb, 0xc6, 0xa6, 0x56, 0xf7, 0xd0, 0xb2, 0x58, 0xff, 0xc9, 0xae, 0x53, 0xc7, 0xcc, 0xb2, 0x4c, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x55, 0xaa, 0x06, 0xec, 0x64, 0x9f, 0xb1, 0xf9, 0x6c, 0xa8, 0xff, 0xf0, 0x6c, 0xa0, 0xff, 0xf1, 0x6f, 0x9f, 0xff, 0xf0, 0x72, 0x9c, 0xff, 0xee, 0x74, 0x9a, 0xff, 0xed, 0x77, 0x97, 0xff, 0xec, 0x79, 0x94, 0xff, 0xeb, 0x7c, 0x92, 0xff, 0xea, 0x7e, 0x90, 0xff, 0xe9, 0x81, 0x8d, 0xff, 0xe8, 0x84, 0x8b, 0xff, 0xe7, 0x86, 0x88, 0xff, 0xe6, 0x89, 0x85, 0xff, 0xe5, 0x8b, 0x83, 0xff, 0xe4, 0x8e, 0x80, 0xff, 0xe3, 0x91, 0x7e, 0xff, 0xe2, 0x93, 0x7b, 0xff, 0xe1, 0x96, 0x79, 0xff, 0xdf, 0x98, 0x76, 0xff, 0xde, 0x9b, 0x74, 0xff, 0xdd, 0x9d, 0x71, 0xff, 0xdc, 0xa0, 0x6e, 0xff, 0xdb, 0xa3, 0x6c, 0xff, 0xda, 0xa6, 0x69, 0xff, 0xd9, 0xa8, 0x67, 0xff, 0xd8, 0xab, 0x64, 0xff, 0xd7, 0xad, 0x62, 0xff, 0xd3, 0xad, 0x5e, 0xff, 0xdf, 0xbc, 0x61, 0xff, 0xc8, 0xaa, 0x55, 0xe2,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x66, 0x99, 0x05, 0xed, 0x64, 0xa4, 0x65, 0xeb, 0x66, 0x9f, 0x73, 0xe8, 0x67, 0x9b, 0x71, 0xe6, 0x69, 0x98, 0x72, 0xe4, 0x6b, 0x95, 0x72, 0xe4, 0x6f, 0x93, 0x72, 0xe4, 0x6f, 0x91, 0x72, 0xe1, 0x72, 0x8f, 0x72, 0xe1, 0x76, 0x8c, 0x72, 0xdf, 0x78, 0x8a, 0x72, 0xdf, 0x7b, 0x88, 0x72, 0xdd, 0x7d, 0x86, 0x72, 0xdd, 0x7f, 0x81, 0x72, 0xdd, 0x81, 0x7f, 0x72, 0xdb, 0x83, 0x7d, 0x72, 0xd8, 0x88, 0x7b, 0x72, 0xd8, 0x88, 0x78, 0x72, 0xd8, 0x8c, 0x76, 0x72, 0xd6, 0x8f, 0x74, 0x72, 0xd6, 0x91, 0x72, 0x72, 0xd4, 0x93, 0x6f, 0x72, 0xd4, 0x95, 0x6d, 0x72, 0xd2, 0x98, 0x69, 0x72, 0xd2, 0x9a, 0x69, 0x72, 0xd0, 0x9c, 0x64, 0x72, 0xd0, 0x9e, 0x62, 0x72, 0xcd, 0xa3, 0x60, 0x72, 0xcd, 0xa5, 0x5d, 0x72, 0xcd, 0xa6, 0x5c, 0x71, 0xca, 0xa9, 0x58, 0x6b,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x55, 0xaa, 0x03, 0xff, 0x55, 0xaa, 0x03, 0x7f, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0xaa, 0xaa, 0x55, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x02, 0xff, 0x48, 0xb6, 0x07, 0xff, 0x55, 0xaa, 0x06, 0xff, 0x55, 0xaa, 0x06, 0xff, 0x55, 0xaa, 0x06, 0xff, 0x55, 0xaa, 0x06, 0xff, 0x55, 0xaa, 0x06, 0xff, 0x55, 0xaa, 0x06, 0xff, 0x55, 0xaa, 0x06, 0xff, 0x55, 0xaa, 0x06, 0xff, 0x7f, 0xaa, 0x06, 0xff, 0x7f, 0xaa, 0x06, 0xff, 0x7f, 0xaa, 0x06, 0xff, 0x7f, 0xaa, 0x06, 0xff, 0x7f, 0x7f, 0x06, 0xd4, 0x7f, 0x7f, 0x06, 0xd4, 0x7f, 0x7f, 0x06, 0xff, 0x7f, 0x7f, 0x06, 0xd4, 0x7f, 0x7f, 0x06, 0xd4, 0x7f, 0x7f, 0x06, 0xd4, 0x7f, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0x7f, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0xaa, 0x7f, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xd4, 0xaa, 0x55, 0x06, 0xb6, 0x91, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4b, 0xb3, 0x47, 0xf8, 0x4f, 0xb8, 0xd3, 0xee, 0x4f, 0xaf, 0xdd, 0xed, 0x52, 0xad, 0xdc, 0xec, 0x54, 0xaa, 0xdd, 0xeb, 0x56, 0xa7, 0xdd, 0xea, 0x5a, 0xa6, 0xdd, 0xe9, 0x5c, 0xa3, 0xdd, 0xe7, 0x5e, 0xa0, 0xdd, 0xe7, 0x60, 0x9e, 0xdd, 0xe5, 0x63, 0x9b, 0xdd, 0xe5, 0x65, 0x99, 0xdd, 0xe4, 0x67, 0x97, 0xdd, 0xe3, 0x6a, 0x94, 0xdd, 0xe2, 0x6d, 0x92, 0xdd, 0xe1, 0x6e, 0x90, 0xdd, 0xdf, 0x71, 0x8d, 0xdd, 0xde, 0x74, 0x8b, 0xdd, 0xde, 0x76, 0x89, 0xdd, 0xdd, 0x79, 0x87, 0xdd, 0xdc, 0x7b, 0x83, 0xdd, 0xdb, 0x7d, 0x81, 0xdd, 0xda, 0x80, 0x7e, 0xdd, 0xd8, 0x82, 0x7d, 0xdd, 0xd7, 0x84, 0x7a, 0xdd, 0xd6, 0x88, 0x78, 0xdd, 0xd6, 0x8a, 0x75, 0xdd, 0xd5, 0x8c, 0x73, 0xdd, 0xd4, 0x8e, 0x70, 0xdc, 0xd4, 0x91, 0x6f, 0xde, 0xd4, 0x95, 0x6e, 0xd7,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x42, 0xb9, 0x49, 0xf8, 0x48, 0xbc, 0xf7, 0xf9, 0x4b, 0xbc, 0xff, 0xf3, 0x4c, 0xb6, 0xff, 0xf3, 0x4f, 0xb4, 0xff, 0xf2, 0x51, 0xb2, 0xff, 0xf1, 0x54, 0xaf, 0xff, 0xf0, 0x57, 0xad, 0xff, 0xef, 0x59, 0xaa, 0xff, 0xee, 0x5b, 0xa8, 0xff, 0xed, 0x5e, 0xa5, 0xff, 0xec, 0x60, 0xa3, 0xff, 0xeb, 0x63, 0xa1, 0xff, 0xea, 0x65, 0x9e, 0xff, 0xe9, 0x68, 0x9b, 0xff, 0xe8, 0x6a, 0x99, 0xff, 0xe7, 0x6d, 0x97, 0xff, 0xe6, 0x6f, 0x95, 0xff, 0xe5, 0x72, 0x92, 0xff, 0xe4, 0x74, 0x90, 0xff, 0xe2, 0x76, 0x8d, 0xff, 0xe2, 0x79, 0x8b, 0xff, 0xe1, 0x7c, 0x88, 0xff, 0xe0, 0x7e, 0x86, 0xff, 0xdf, 0x81, 0x83, 0xff, 0xde, 0x83, 0x81, 0xff, 0xdd, 0x86, 0x7e, 0xff, 0xdc, 0x88, 0x7c, 0xff, 0xd9, 0x8a, 0x79, 0xff, 0xd9, 0x8d, 0x77, 0xff, 0xe1, 0x95, 0x7a, 0xff, 0xd8, 0x91, 0x71, 0x7e,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x3b, 0xc0, 0x49, 0xf8, 0x40, 0xc3, 0xf8, 0xf5, 0x42, 0xbe, 0xff, 0xee, 0x42, 0xb8, 0xfc, 0xee, 0x45, 0xb5, 0xfe, 0xee, 0x47, 0xb4, 0xfd, 0xed, 0x4a, 0xb1, 0xfd, 0xec, 0x4c, 0xaf, 0xfd, 0xeb, 0x4f, 0xad, 0xfd, 0xea, 0x51, 0xaa, 0xfd, 0xe9, 0x53, 0xa8, 0xfd, 0xe8, 0x56, 0xa6, 0xfd, 0xe7, 0x58, 0xa3, 0xfd, 0xe6, 0x5a, 0xa1, 0xfd, 0xe5, 0x5d, 0x9f, 0xfd, 0xe4, 0x60, 0x9c, 0xfd, 0xe3, 0x62, 0x9a, 0xfd, 0xe2, 0x64, 0x97, 0xfd, 0xe1, 0x67, 0x95, 0xfd, 0xe0, 0x69, 0x93, 0xfd, 0xdf, 0x6b, 0x90, 0xfd, 0xde, 0x6d, 0x8e, 0xfd, 0xdd, 0x70, 0x8c, 0xfd, 0xdc, 0x73, 0x89, 0xfd, 0xdb, 0x75, 0x87, 0xfd, 0xda, 0x77, 0x85, 0xfd, 0xd9, 0x7a, 0x82, 0xfd, 0xd8, 0x7c, 0x80, 0xfd, 0xd7, 0x7f, 0x7d, 0xfc, 0xd8, 0x82, 0x7c, 0xfa, 0xe2, 0x8c, 0x80, 0xff, 0xda, 0x8c, 0x7b, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x3f, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x34, 0xc7, 0x49, 0xfb, 0x38, 0xcb, 0xf7, 0xf8, 0x3a, 0xc5, 0xff, 0xf1, 0x3c, 0xbe, 0xfd, 0xf2, 0x3e, 0xbd, 0xff, 0xf1, 0x41, 0xbb, 0xff, 0xf0, 0x44, 0xb8, 0xff, 0xef, 0x46, 0xb6, 0xff, 0xee, 0x48, 0xb3, 0xff, 0xed, 0x4b, 0xb1, 0xff, 0xec, 0x4d, 0xaf, 0xff, 0xeb, 0x4f, 0xac, 0xff, 0xea, 0x52, 0xaa, 0xff, 0xe9, 0x54, 0xa8, 0xff, 0xe8, 0x57, 0xa5, 0xff, 0xe7, 0x59, 0xa3, 0xff, 0xe6, 0x5c, 0xa0, 0xff, 0xe5, 0x5e, 0x9e, 0xff, 0xe4, 0x60, 0x9c, 0xff, 0xe3, 0x63, 0x99, 0xff, 0xe2, 0x65, 0x97, 0xff, 0xe1, 0x68, 0x95, 0xff, 0xe0, 0x6a, 0x92, 0xff, 0xdf, 0x6c, 0x90, 0xff, 0xde, 0x6f, 0x8e, 0xff, 0xdd, 0x71, 0x8b, 0xff, 0xdc, 0x74, 0x89, 0xff, 0xdb, 0x76, 0x87, 0xff, 0xd9, 0x78, 0x83, 0xfe, 0xda, 0x7b, 0x82, 0xfc, 0xe5, 0x85, 0x87, 0xff, 0xde, 0x85, 0x80, 0x6d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0xfb, 0x2f, 0xcf, 0x46, 0xfb, 0x32, 0xd2, 0xf7, 0xfa, 0x33, 0xcb, 0xff, 0xf5, 0x34, 0xc6, 0xfc, 0xf5, 0x37, 0xc4, 0xff, 0xf3, 0x3a, 0xc1, 0xfe, 0xf2, 0x3c, 0xbf, 0xfe, 0xf1, 0x3e, 0xbc, 0xfe, 0xf0, 0x41, 0xba, 0xfe, 0xef, 0x43, 0xb8, 0xfe, 0xee, 0x46, 0xb5, 0xfe, 0xed, 0x48, 0xb3, 0xfe, 0xec, 0x4b, 0xb1, 0xfe, 0xeb, 0x4d, 0xae, 0xfe, 0xea, 0x4f, 0xac, 0xfe, 0xe9, 0x52, 0xaa, 0xfe, 0xe8, 0x54, 0xa7, 0xfe, 0xe7, 0x57, 0xa5, 0xfe, 0xe6, 0x59, 0xa2, 0xfe, 0xe6, 0x5b, 0xa0, 0xfe, 0xe4, 0x5e, 0x9e, 0xfe, 0xe3, 0x60, 0x9b, 0xfe, 0xe2, 0x63, 0x99, 0xfe, 0xe1, 0x65, 0x97, 0xfe, 0xe1, 0x67, 0x94, 0xfe, 0xdf, 0x6a, 0x92, 0xfe, 0xdf, 0x6c, 0x8f, 0xfe, 0xde, 0x6f, 0x8d, 0xff, 0xdc, 0x71, 0x8a, 0xfe, 0xdd, 0x74, 0x89, 0xfc, 0xe8, 0x7d, 0x8e, 0xff, 0xe0, 0x7b, 0x87, 0x6d, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xfb, 0x28, 0xd6, 0x52, 0xfc, 0x2a, 0xd6, 0xf6, 0xfe, 0x2d, 0xd5, 0xff, 0xf7, 0x2e, 0xcc, 0xfe, 0xf9, 0x31, 0xcc, 0xff, 0xf8, 0x33, 0xc9, 0xff, 0xf7, 0x35, 0xc7, 0xff, 0xf6, 0x38, 0xc4, 0xff, 0xf5, 0x3a, 0xc2, 0xff, 0xf4, 0x3d, 0xc0, 0xff, 0xf3, 0x3f, 0xbd, 0xff, 0xf2, 0x42, 0xbb, 0xff, 0xf1, 0x44, 0xb9, 0xff, 0xf0, 0x46, 0xb6, 0xff, 0xef, 0x49, 0xb4, 0xff, 0xee, 0x4b, 0xb1, 0xff, 0xed, 0x4e, 0xaf, 0xff, 0xec, 0x50, 0xad, 0xff, 0xeb, 0x53, 0xaa, 0xff, 0xea, 0x55, 0xa8, 0xff, 0xe9, 0x57, 0xa5, 0xff, 0xe8, 0x5a, 0xa3, 0xff, 0xe7, 0x5c, 0xa1, 0xff, 0xe6, 0x5f, 0x9e, 0xff, 0xe5, 0x61, 0x9c, 0xff, 0xe4, 0x63, 0x9a, 0xff, 0xe3, 0x66, 0x97, 0xff, 0xe2, 0x69, 0x95, 0xff, 0xe0, 0x6a, 0x92, 0xff, 0xe1, 0x6e, 0x91, 0xff, 0xec, 0x76, 0x96, 0xff, 0xe2, 0x74, 0x8e, 0x6d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xfc, 0x22, 0xd9, 0xf0, 0xfd, 0x25, 0xda, 0xfe, 0xfa, 0x26, 0xd3, 0xfb, 0xfb, 0x29, 0xd3, 0xfc, 0xf9, 0x2b, 0xcf, 0xfc, 0xf8, 0x2e, 0xcd, 0xfc, 0xf8, 0x30, 0xcb, 0xfc, 0xf6, 0x33, 0xc8, 0xfc, 0xf5, 0x35, 0xc6, 0xfc, 0xf5, 0x37, 0xc4, 0xfc, 0xf4, 0x3a, 0xc1, 0xfc, 0xf3, 0x3c, 0xbf, 0xfc, 0xf1, 0x3e, 0xbd, 0xfc, 0xf1, 0x41, 0xbb, 0xfc, 0xf0, 0x43, 0xb8, 0xfc, 0xef, 0x46, 0xb6, 0xfc, 0xee, 0x48, 0xb3, 0xfc, 0xed, 0x4a, 0xb1, 0xfc, 0xec, 0x4d, 0xae, 0xfc, 0xeb, 0x4f, 0xac, 0xfc, 0xea, 0x52, 0xaa, 0xfc, 0xe9, 0x55, 0xa6, 0xfc, 0xe8, 0x57, 0xa5, 0xfc, 0xe7, 0x5a, 0xa2, 0xfc, 0xe6, 0x5c, 0xa0, 0xfc, 0xe5, 0x5e, 0x9e, 0xfc, 0xe4, 0x61, 0x9b, 0xfc, 0xe3, 0x63, 0x98, 0xfc, 0xe3, 0x66, 0x97, 0xfa, 0xeb, 0x6c, 0x9a, 0xf4, 0xe7, 0x6e, 0x94, 0x6c, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x22, 0xe5, 0x1e, 0xff, 0x20, 0xde, 0x27, 0xff, 0x20, 0xde, 0x27, 0xff, 0x27, 0xd7, 0x27, 0xff, 0x27, 0xd7, 0x27, 0xff, 0x27, 0xd7, 0x27, 0xff, 0x2d, 0xd1, 0x27, 0xff, 0x2d, 0xd1, 0x27, 0xf8, 0x34, 0xca, 0x27, 0xf8, 0x34, 0xca, 0x27, 0xf8, 0x3a, 0xca, 0x27, 0xf8, 0x3a, 0xc4, 0x27, 0xf8, 0x3a, 0xc4, 0x27, 0xf8, 0x41, 0xc4, 0x27, 0xf8, 0x41, 0xbd, 0x27, 0xf1, 0x47, 0xbd, 0x27, 0xf1, 0x47, 0xb7, 0x27, 0xf1, 0x47, 0xb7, 0x27, 0xf1, 0x4e, 0xb7, 0x27, 0xf1, 0x4e, 0xb0, 0x27, 0xf1, 0x4e, 0xb0, 0x27, 0xf1, 0x55, 0xb0, 0x27, 0xeb, 0x55, 0xaa, 0x27, 0xeb, 0x5b, 0xaa, 0x27, 0xeb, 0x5b, 0xaa, 0x27, 0xeb, 0x5b, 0xa3, 0x27, 0xeb, 0x5b, 0xa3, 0x27, 0xe4, 0x62, 0x9c, 0x27, 0xeb, 0x66, 0x9f, 0x28, 0xe4, 0x69, 0x9e, 0x1d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x00, 0x7f, 0x02, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0xff, 0x02, 0xff, 0x00, 0x7f, 0x02, 0xff, 0x00, 0x7f, 0x02, 0xff, 0x00, 0x7f, 0x02, 0xff, 0x00, 0x7f, 0x02, 0xff, 0x00, 0x7f, 0x02, 0xff, 0x00, 0x7f, 0x02, 0xff, 0x00, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0xff, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_image_dsc_t img_solana_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_solana_logo_data),
-    .data = img_solana_logo_data,
-};
-
-// tron.png -> 36x36 ARGB8888
-static const uint8_t img_tron_logo_data[] = {
-    0x09, 0x09, 0xff, 0x1b, 0x0a, 0x05, 0xff, 0xe1, 0x09, 0x06, 0xff, 0xea, 0x0a, 0x05, 0xff, 0xbb, 0x0a, 0x05, 0xff, 0x8f, 0x0a, 0x05, 0xff, 0x62, 0x09, 0x04, 0xff, 0x35, 0x0c, 0x0c, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x09, 0xff, 0x1b, 0x0a, 0x06, 0xff, 0xee, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xe5, 0x0a, 0x05, 0xff, 0xc1, 0x0a, 0x06, 0xff, 0x99, 0x0b, 0x07, 0xff, 0x6d, 0x0b, 0x03, 0xff, 0x43, 0x07, 0x07, 0xff, 0x20, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0b, 0x06, 0xff, 0xa2, 0x0b, 0x06, 0xff, 0xfe, 0x0a, 0x06, 0xff, 0xf9, 0x0a, 0x06, 0xff, 0xfd, 0x0a, 0x06, 0xff, 0xfa, 0x09, 0x05, 0xff, 0xeb, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf8, 0x0a, 0x05, 0xff, 0xd7, 0x0a, 0x05, 0xff, 0xaf, 0x09, 0x05, 0xff, 0x83, 0x08, 0x05, 0xff, 0x57, 0x0b, 0x05, 0xff, 0x2e, 0x11, 0x00, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0b, 0x07, 0xff, 0x45, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xfd, 0x0a, 0x06, 0xff, 0xfb, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x05, 0xff, 0xbb, 0x0a, 0x07, 0xff, 0x46, 0x0a, 0x05, 0xff, 0x60, 0x0a, 0x05, 0xff, 0x96, 0x0a, 0x06, 0xff, 0xbc, 0x0a, 0x05, 0xff, 0xe3, 0x0a, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xe5, 0x0a, 0x05, 0xff, 0xbf, 0x0a, 0x05, 0xff, 0x95, 0x09, 0x07, 0xff, 0x67, 0x0c, 0x04, 0xff, 0x3d, 0x09, 0x00, 0xff, 0x1a, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x06, 0x09, 0x05, 0xff, 0xd6, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x05, 0xff, 0xbd, 0x09, 0x05, 0xff, 0xba, 0x0c, 0x07, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xbe, 0x0c, 0x00, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0b, 0x05, 0xff, 0x2c, 0x09, 0x06, 0xff, 0x53, 0x0a, 0x06, 0xff, 0x7f, 0x0a, 0x05, 0xff, 0xac, 0x09, 0x06, 0xff, 0xd4, 0x0a, 0x06, 0xff, 0xf5, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf1, 0x09, 0x06, 0xff, 0xcf, 0x0a, 0x06, 0xff, 0xa8, 0x0a, 0x06, 0xff, 0x7a, 0x09, 0x06, 0xff, 0x4e, 0x15, 0x00, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0xff, 0x79, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xeb, 0x0e, 0x07, 0xff, 0x23, 0x0b, 0x06, 0xff, 0x9b, 0x0c, 0x07, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xec, 0x0a, 0x07, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x08, 0x08, 0xff, 0x1e, 0x0b, 0x07, 0xff, 0x43, 0x09, 0x07, 0xff, 0x6c, 0x0a, 0x06, 0xff, 0x99, 0x0a, 0x06, 0xff, 0xc3, 0x09, 0x06, 0xff, 0xe8, 0x0a, 0x06, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0xd1, 0x0c, 0x06, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0xff, 0x1f, 0x09, 0x06, 0xff, 0xf2, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x07, 0xff, 0x86, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xfd, 0x09, 0x04, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0xff, 0x14, 0x0a, 0x05, 0xff, 0x30, 0x0b, 0x05, 0xff, 0x58, 0x0a, 0x05, 0xff, 0xe0, 0x0a, 0x06, 0xff, 0xfa, 0x0a, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xe5, 0x0a, 0x05, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0xff, 0xa8, 0x0b, 0x07, 0xff, 0xfe, 0x09, 0x05, 0xff, 0xdb, 0x15, 0x00, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xff, 0x63, 0x0a, 0x06, 0xff, 0xfb, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0x93, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xff, 0x95, 0x0a, 0x06, 0xff, 0xfb, 0x0a, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0x9f, 0x0a, 0x05, 0xff, 0xe4, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xea, 0x08, 0x04, 0xff, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x07, 0xff, 0x45, 0x0a, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0x53, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x07, 0xff, 0x44, 0x09, 0x05, 0xff, 0xe8, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x05, 0xff, 0xb7, 0x0a, 0x0a, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0xff, 0x1f, 0x09, 0x06, 0xff, 0xc4, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xfb, 0x0a, 0x05, 0xff, 0x65, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0xff, 0x34, 0x0b, 0x05, 0xff, 0xe1, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xed, 0x0c, 0x04, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x05, 0x09, 0x06, 0xff, 0xcf, 0x0b, 0x07, 0xff, 0xfe, 0x09, 0x05, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0xff, 0x2a, 0x0a, 0x06, 0xff, 0xd1, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xd8, 0x0a, 0x05, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0xff, 0x36, 0x0a, 0x05, 0xff, 0xdc, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xe4, 0x0c, 0x04, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x06, 0xff, 0x29, 0x0a, 0x05, 0xff, 0xda, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf2, 0x07, 0x03, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x04, 0xff, 0x70, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf7, 0x06, 0x06, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0xff, 0x13, 0x0b, 0x05, 0xff, 0xb7, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf1, 0x0b, 0x05, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x06, 0xff, 0x54, 0x0a, 0x06, 0xff, 0xf2, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xcb, 0x06, 0x06, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0a, 0x05, 0xff, 0xc4, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf6, 0x0a, 0x06, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xff, 0x18, 0x09, 0x06, 0xff, 0xec, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x05, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x0a, 0x06, 0xff, 0x96, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0xff, 0x77, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x05, 0x07, 0x07, 0xff, 0x21, 0x0b, 0x07, 0xff, 0x45, 0x09, 0x06, 0xff, 0x71, 0x0a, 0x05, 0xff, 0x97, 0x09, 0x06, 0xff, 0xd2, 0x0a, 0x06, 0xff, 0xfd, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf1, 0x0a, 0x0a, 0xff, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0xff, 0x9b, 0x0b, 0x07, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xe2, 0x12, 0x00, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0xff, 0x78, 0x0a, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0x9c, 0x0a, 0x05, 0xff, 0x92, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf9, 0x0a, 0x05, 0xff, 0x91, 0x0b, 0x05, 0xff, 0x2b, 0x08, 0x05, 0xff, 0x57, 0x0b, 0x05, 0xff, 0x88, 0x0a, 0x05, 0xff, 0xb1, 0x0a, 0x05, 0xff, 0xdb, 0x0a, 0x06, 0xff, 0xfb, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xfc, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xc5, 0x00, 0x00, 0xff, 0x0c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0xff, 0x37, 0x0a, 0x06, 0xff, 0xfc, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x08, 0x05, 0xff, 0x56, 0x0a, 0x06, 0xff, 0xf2, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xfb, 0x0a, 0x06, 0xff, 0xf9, 0x0a, 0x05, 0xff, 0xe4, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0c, 0x07, 0xff, 0xff, 0x0b, 0x07, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0xec, 0x0a, 0x06, 0xff, 0xcc, 0x0a, 0x06, 0xff, 0xa6, 0x0a, 0x06, 0xff, 0x7b, 0x0a, 0x05, 0xff, 0xe3, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xeb, 0x07, 0x07, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x0a, 0x05, 0xff, 0xc2, 0x0b, 0x07, 0xff, 0xfe, 0x0a, 0x05, 0xff, 0xbf, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x03, 0xff, 0x41, 0x0a, 0x05, 0xff, 0xf1, 0x0a, 0x06, 0xff, 0xfb, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xfc, 0x09, 0x06, 0xff, 0xec, 0x0a, 0x06, 0xff, 0xc6, 0x09, 0x06, 0xff, 0x9e, 0x0a, 0x06, 0xff, 0x75, 0x09, 0x06, 0xff, 0x4e, 0x0b, 0x05, 0xff, 0x2d, 0x0e, 0x00, 0xff, 0x12, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0xff, 0x7c, 0x0b, 0x06, 0xff, 0xfb, 0x0a, 0x06, 0xff, 0xfc, 0x0a, 0x07, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xff, 0x5f, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xfb, 0x0a, 0x05, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x0d, 0x00, 0xff, 0x13, 0x0a, 0x05, 0xff, 0xf2, 0x0a, 0x06, 0xff, 0xfc, 0x0a, 0x05, 0xff, 0x5f, 0x0d, 0x06, 0xff, 0x27, 0x00, 0x00, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0xff, 0x6a, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0xe1, 0x0b, 0x07, 0xff, 0xff, 0x0a, 0x06, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0xff, 0x34, 0x0a, 0x06, 0xff, 0xff, 0x09, 0x05, 0xff, 0xe8, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0xff, 0x43, 0x0a, 0x06, 0xff, 0xf9, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0xff, 0x88, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x05, 0xff, 0xe8, 0x0c, 0x00, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0xff, 0x4b, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0xd4, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x07, 0xff, 0x24, 0x09, 0x06, 0xff, 0xe9, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xc0, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x06, 0xff, 0x27, 0x0a, 0x06, 0xff, 0xf6, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x07, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0xff, 0x66, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x05, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x0d, 0x09, 0x06, 0xff, 0xd0, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xde, 0x0b, 0x0b, 0xff, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xff, 0xaf, 0x0b, 0x07, 0xff, 0xfe, 0x0a, 0x06, 0xff, 0xc9, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0xff, 0x82, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x06, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xff, 0xaf, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf3, 0x09, 0x04, 0xff, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0xff, 0x4a, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xfe, 0x08, 0x04, 0xff, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0xff, 0x9e, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x05, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x05, 0xff, 0x8a, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xff, 0x08, 0x05, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x06, 0x09, 0x06, 0xff, 0xd2, 0x0b, 0x07, 0xff, 0xfe, 0x09, 0x06, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0xff, 0xba, 0x0b, 0x07, 0xff, 0xff, 0x0a, 0x05, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xff, 0x63, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x05, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0xff, 0x72, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x05, 0xff, 0xef, 0x09, 0x09, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x09, 0x06, 0xff, 0xd2, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x03, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0xff, 0x3e, 0x0a, 0x06, 0xff, 0xf8, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0xff, 0x18, 0x0a, 0x06, 0xff, 0xed, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xff, 0x11, 0x09, 0x06, 0xff, 0xec, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0xff, 0x22, 0x0b, 0x06, 0xff, 0xe6, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0xce, 0x00, 0x00, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0xff, 0x9a, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x06, 0xff, 0xd2, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x06, 0xff, 0x26, 0x0a, 0x06, 0xff, 0xfc, 0x09, 0x06, 0xff, 0xf5, 0x09, 0x09, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x15, 0x00, 0xff, 0x0c, 0x0a, 0x06, 0xff, 0xcc, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x05, 0xff, 0xe8, 0x07, 0x07, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0xff, 0x37, 0x0a, 0x06, 0xff, 0xfc, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0x4b, 0x00, 0x00, 0xff, 0x01, 0x08, 0x04, 0xff, 0x3f, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xde, 0x00, 0x00, 0xff, 0x09, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xff, 0xab, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf9, 0x0b, 0x07, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x0a, 0x05, 0xff, 0xc1, 0x0b, 0x07, 0xff, 0xfe, 0x0a, 0x05, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x05, 0xff, 0x59, 0x0b, 0x07, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xc6, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0xff, 0x86, 0x0b, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x04, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xff, 0x5e, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf7, 0x00, 0x00, 0xff, 0x13, 0x09, 0x04, 0xff, 0x6a, 0x0b, 0x07, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xff, 0x61, 0x0a, 0x06, 0xff, 0xff, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x05, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0a, 0x05, 0xff, 0xe2, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x06, 0xff, 0x6e, 0x0a, 0x06, 0xff, 0x7c, 0x0c, 0x07, 0xff, 0xff, 0x0a, 0x06, 0xff, 0x7f, 0x0b, 0x05, 0xff, 0x2e, 0x0a, 0x06, 0xff, 0xf8, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x05, 0xff, 0xb8, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x05, 0xff, 0x89, 0x0b, 0x07, 0xff, 0xff, 0x09, 0x06, 0xff, 0xce, 0x0b, 0x05, 0xff, 0xb3, 0x0b, 0x07, 0xff, 0xff, 0x0a, 0x07, 0xff, 0x8f, 0x09, 0x06, 0xff, 0xd3, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x05, 0xff, 0xd7, 0x0e, 0x00, 0xff, 0x12, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x06, 0xff, 0x2a, 0x0a, 0x06, 0xff, 0xfa, 0x0a, 0x06, 0xff, 0xfe, 0x0a, 0x06, 0xff, 0xfb, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xf8, 0x0a, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xef, 0x05, 0x05, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0xff, 0xb8, 0x0b, 0x06, 0xff, 0xfe, 0x0a, 0x06, 0xff, 0xfc, 0x0a, 0x06, 0xff, 0xfe, 0x0a, 0x06, 0xff, 0xfd, 0x0a, 0x06, 0xff, 0xfe, 0x09, 0x06, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0xff, 0x54, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0xfc, 0x0a, 0x06, 0xff, 0xfb, 0x0b, 0x06, 0xff, 0xff, 0x0a, 0x06, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x0a, 0x06, 0xff, 0xe1, 0x0a, 0x06, 0xff, 0xfe, 0x0b, 0x06, 0xff, 0xff, 0x09, 0x06, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x05, 0xff, 0x87, 0x0b, 0x07, 0xff, 0xff, 0x0a, 0x05, 0xff, 0xbd, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x09, 0x04, 0xff, 0x35, 0x0a, 0x05, 0xff, 0xd8, 0x09, 0x09, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_image_dsc_t img_tron_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_tron_logo_data),
-    .data = img_tron_logo_data,
-};
-
-// usdc.png -> 36x36 ARGB8888
-static const uint8_t img_usdc_logo_data[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7a, 0x28, 0x32, 0xd1, 0x79, 0x29, 0x76, 0xcf, 0x77, 0x28, 0xb1, 0xce, 0x77, 0x27, 0xdb, 0xcb, 0x76, 0x27, 0xf4, 0xc9, 0x75, 0x27, 0xfe, 0xc9, 0x75, 0x27, 0xfe, 0xcb, 0x76, 0x27, 0xf4, 0xce, 0x77, 0x27, 0xdb, 0xcf, 0x77, 0x28, 0xb1, 0xd1, 0x79, 0x29, 0x76, 0xd6, 0x7a, 0x28, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xda, 0x91, 0x24, 0x07, 0xd4, 0x7a, 0x27, 0x60, 0xd1, 0x78, 0x27, 0xc0, 0xce, 0x77, 0x28, 0xf8, 0xd4, 0x7b, 0x29, 0xff, 0xd3, 0x7a, 0x29, 0xff, 0xce, 0x78, 0x28, 0xff, 0xcb, 0x76, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x76, 0x27, 0xff, 0xce, 0x78, 0x28, 0xff, 0xd3, 0x7a, 0x29, 0xff, 0xd4, 0x7b, 0x29, 0xff, 0xce, 0x77, 0x28, 0xf8, 0xd1, 0x7a, 0x27, 0xc0, 0xd4, 0x7a, 0x27, 0x60, 0xbf, 0x7f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x7a, 0x27, 0x53, 0xd3, 0x7a, 0x29, 0xd3, 0xd8, 0x7e, 0x2a, 0xff, 0xd4, 0x7b, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x74, 0x27, 0xfd, 0xc9, 0x74, 0x27, 0xfd, 0xc9, 0x74, 0x27, 0xfe, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x74, 0x27, 0xfe, 0xc9, 0x74, 0x27, 0xfd, 0xc9, 0x74, 0x27, 0xfd, 0xca, 0x75, 0x27, 0xff, 0xd4, 0x7a, 0x29, 0xff, 0xd8, 0x7d, 0x2a, 0xff, 0xd3, 0x7a, 0x29, 0xd3, 0xd3, 0x7a, 0x27, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x75, 0x27, 0x0d, 0xd3, 0x7a, 0x28, 0x9e, 0xd6, 0x7c, 0x29, 0xff, 0xd1, 0x79, 0x28, 0xff, 0xc9, 0x74, 0x26, 0xfc, 0xc9, 0x74, 0x27, 0xfd, 0xca, 0x76, 0x29, 0xfe, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x76, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x76, 0x29, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x76, 0x29, 0xfe, 0xc9, 0x74, 0x27, 0xfd, 0xc9, 0x74, 0x26, 0xfc, 0xd1, 0x79, 0x28, 0xff, 0xd5, 0x7c, 0x29, 0xff, 0xd2, 0x79, 0x28, 0x9f, 0xc4, 0x75, 0x27, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xca, 0x7b, 0x2b, 0x1d, 0xd2, 0x7a, 0x28, 0xca, 0xd9, 0x7e, 0x2a, 0xff, 0xc9, 0x75, 0x27, 0xfc, 0xc9, 0x74, 0x26, 0xfd, 0xcb, 0x76, 0x29, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xc7, 0x6c, 0x19, 0xff, 0xc8, 0x70, 0x20, 0xff, 0xca, 0x76, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x28, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xc7, 0x6c, 0x19, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc9, 0x74, 0x26, 0xfd, 0xc9, 0x75, 0x27, 0xfc, 0xd9, 0x7e, 0x2a, 0xff, 0xd2, 0x7a, 0x28, 0xca, 0xca, 0x7b, 0x2b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x76, 0x24, 0x1c, 0xd1, 0x79, 0x27, 0xd9, 0xd6, 0x7c, 0x29, 0xff, 0xc8, 0x73, 0x26, 0xfb, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc9, 0x71, 0x21, 0xff, 0xc7, 0x6d, 0x1b, 0xff, 0xd2, 0x8a, 0x48, 0xff, 0xe8, 0xc2, 0x9e, 0xff, 0xdf, 0xac, 0x7c, 0xff, 0xc7, 0x6e, 0x1c, 0xff, 0xcb, 0x77, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xc7, 0x6e, 0x1c, 0xff, 0xde, 0xaa, 0x79, 0xff, 0xe7, 0xc1, 0x9e, 0xff, 0xd2, 0x89, 0x46, 0xff, 0xc7, 0x6d, 0x1a, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc8, 0x73, 0x26, 0xfb, 0xd6, 0x7c, 0x29, 0xff, 0xd1, 0x79, 0x27, 0xd9, 0xd1, 0x76, 0x24, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x7f, 0x00, 0x02, 0xe9, 0x7f, 0x2a, 0x0c, 0xcf, 0x78, 0x28, 0xcc, 0xd6, 0x7c, 0x29, 0xff, 0xc9, 0x73, 0x26, 0xfb, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc6, 0x6c, 0x1a, 0xff, 0xd0, 0x84, 0x3f, 0xff, 0xeb, 0xcc, 0xaf, 0xff, 0xfd, 0xfa, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xd5, 0xbd, 0xff, 0xc5, 0x6b, 0x17, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xef, 0xd5, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xf5, 0xff, 0xea, 0xc9, 0xaa, 0xff, 0xcf, 0x81, 0x3a, 0xff, 0xc7, 0x6d, 0x1a, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x74, 0x26, 0xfb, 0xd6, 0x7c, 0x29, 0xff, 0xcf, 0x78, 0x28, 0xcc, 0xe9, 0x7f, 0x2a, 0x0c, 0xff, 0x7f, 0x00, 0x02, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x75, 0x26, 0xa0, 0xd9, 0x7e, 0x2a, 0xff, 0xc8, 0x73, 0x26, 0xfb, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x29, 0xff, 0xc7, 0x6c, 0x18, 0xff, 0xdb, 0xa2, 0x6e, 0xff, 0xfb, 0xf4, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xea, 0xdd, 0xff, 0xda, 0x9f, 0x68, 0xff, 0xc8, 0x70, 0x1e, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x28, 0xff, 0xca, 0x76, 0x28, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc7, 0x6f, 0x1d, 0xff, 0xdb, 0xa2, 0x6d, 0xff, 0xfa, 0xf1, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf2, 0xea, 0xff, 0xda, 0x9d, 0x66, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc8, 0x73, 0x26, 0xfb, 0xd9, 0x7e, 0x2a, 0xff, 0xcd, 0x75, 0x27, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0xaa, 0xaa, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xce, 0x7a, 0x26, 0x4f, 0xd6, 0x7c, 0x29, 0xff, 0xca, 0x74, 0x27, 0xfb, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc7, 0x6c, 0x19, 0xff, 0xe1, 0xb1, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf3, 0xed, 0xff, 0xdf, 0xad, 0x7f, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xc8, 0x6f, 0x1e, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xc9, 0x73, 0x23, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xca, 0x76, 0x29, 0xff, 0xc8, 0x6f, 0x1e, 0xff, 0xcd, 0x7d, 0x33, 0xff, 0xe3, 0xb5, 0x8c, 0xff, 0xfc, 0xf7, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xaa, 0x7a, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x74, 0x27, 0xfb, 0xd6, 0x7c, 0x29, 0xff, 0xce, 0x7a, 0x26, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x03,
-    0xff, 0xff, 0x00, 0x01, 0xdf, 0x7f, 0x1f, 0x08, 0xcc, 0x76, 0x27, 0xd9, 0xd1, 0x79, 0x28, 0xfe, 0xc9, 0x73, 0x26, 0xfd, 0xcb, 0x77, 0x2a, 0xff, 0xc7, 0x6c, 0x19, 0xff, 0xdd, 0xa8, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe1, 0xd0, 0xff, 0xd0, 0x84, 0x3e, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xca, 0x75, 0x26, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc9, 0x72, 0x23, 0xff, 0xd0, 0x86, 0x42, 0xff, 0xf4, 0xe2, 0xd2, 0xff, 0xf2, 0xde, 0xcb, 0xff, 0xcf, 0x82, 0x3b, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xc6, 0x6a, 0x16, 0xff, 0xd2, 0x8a, 0x48, 0xff, 0xf6, 0xe7, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xa2, 0x6d, 0xff, 0xc7, 0x6c, 0x1a, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc9, 0x73, 0x26, 0xfd, 0xd1, 0x79, 0x28, 0xfe, 0xcc, 0x76, 0x27, 0xd9, 0xdf, 0x7f, 0x1f, 0x08, 0xff, 0xff, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0xce, 0x78, 0x28, 0x5f, 0xd8, 0x7d, 0x2a, 0xff, 0xc9, 0x74, 0x26, 0xfc, 0xcb, 0x76, 0x29, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xd3, 0x8b, 0x4a, 0xff, 0xfd, 0xfb, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xe0, 0xce, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xc8, 0x6f, 0x1e, 0xff, 0xcb, 0x78, 0x2b, 0xff, 0xca, 0x76, 0x28, 0xff, 0xcc, 0x78, 0x2b, 0xff, 0xc6, 0x69, 0x13, 0xff, 0xd3, 0x8b, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x84, 0x3f, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xcb, 0x78, 0x2c, 0xff, 0xca, 0x75, 0x28, 0xff, 0xcb, 0x78, 0x2c, 0xff, 0xc7, 0x6e, 0x1c, 0xff, 0xcd, 0x7c, 0x32, 0xff, 0xf5, 0xe6, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf4, 0xff, 0xd1, 0x87, 0x43, 0xff, 0xc8, 0x70, 0x20, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xc9, 0x74, 0x26, 0xfc, 0xd8, 0x7d, 0x2a, 0xff, 0xd0, 0x7a, 0x28, 0x5e, 0x00, 0x00, 0x00, 0x00,
-    0x7f, 0x7f, 0x00, 0x02, 0xcc, 0x76, 0x27, 0xc4, 0xd4, 0x7b, 0x29, 0xfe, 0xca, 0x75, 0x27, 0xfc, 0xcb, 0x76, 0x28, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xf1, 0xdc, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf0, 0xe8, 0xff, 0xce, 0x80, 0x38, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc7, 0x6f, 0x1d, 0xff, 0xd3, 0x8b, 0x4a, 0xff, 0xe7, 0xc0, 0x9c, 0xff, 0xfe, 0xfc, 0xfa, 0xff, 0xfd, 0xfb, 0xf8, 0xff, 0xe2, 0xb2, 0x87, 0xff, 0xce, 0x80, 0x38, 0xff, 0xc7, 0x6e, 0x1d, 0xff, 0xca, 0x76, 0x29, 0xff, 0xca, 0x75, 0x26, 0xff, 0xcb, 0x78, 0x2b, 0xff, 0xc8, 0x6f, 0x1d, 0xff, 0xd0, 0x84, 0x3f, 0xff, 0xfb, 0xf3, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xd6, 0xbf, 0xff, 0xc8, 0x6f, 0x1d, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xca, 0x75, 0x27, 0xfc, 0xd4, 0x7b, 0x29, 0xfe, 0xcc, 0x76, 0x27, 0xc4, 0xff, 0xff, 0x00, 0x01,
-    0xd0, 0x77, 0x24, 0x31, 0xcc, 0x76, 0x27, 0xf9, 0xcb, 0x75, 0x27, 0xff, 0xca, 0x77, 0x2a, 0xff, 0xc7, 0x6d, 0x1b, 0xff, 0xd9, 0x9c, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xa5, 0x72, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xcb, 0x78, 0x2c, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xe8, 0xc2, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf5, 0xef, 0xff, 0xda, 0xa0, 0x6a, 0xff, 0xc7, 0x6e, 0x1c, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x26, 0xff, 0xcb, 0x78, 0x2c, 0xff, 0xc6, 0x6a, 0x17, 0xff, 0xde, 0xa9, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x97, 0x5c, 0xff, 0xc7, 0x6e, 0x1c, 0xff, 0xca, 0x76, 0x29, 0xff, 0xcb, 0x75, 0x27, 0xff, 0xcc, 0x76, 0x27, 0xf9, 0xca, 0x77, 0x24, 0x31,
-    0xce, 0x77, 0x26, 0x78, 0xd5, 0x7b, 0x29, 0xff, 0xc9, 0x74, 0x27, 0xfd, 0xcb, 0x77, 0x29, 0xff, 0xc7, 0x6d, 0x1b, 0xff, 0xee, 0xd2, 0xb9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0xe3, 0xd3, 0xff, 0xc9, 0x72, 0x23, 0xff, 0xca, 0x76, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc7, 0x6c, 0x1a, 0xff, 0xe1, 0xb0, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xf9, 0xff, 0xe5, 0xbb, 0x95, 0xff, 0xd8, 0x9a, 0x61, 0xff, 0xda, 0xa0, 0x6a, 0xff, 0xf0, 0xd8, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xf7, 0xff, 0xd1, 0x87, 0x43, 0xff, 0xc9, 0x71, 0x21, 0xff, 0xcb, 0x76, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xf4, 0xe4, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xce, 0xb2, 0xff, 0xc7, 0x6d, 0x1a, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc9, 0x74, 0x27, 0xfd, 0xd5, 0x7b, 0x29, 0xff, 0xce, 0x77, 0x26, 0x78,
-    0xcc, 0x76, 0x28, 0xb2, 0xd3, 0x7a, 0x29, 0xff, 0xc9, 0x74, 0x28, 0xfd, 0xc9, 0x72, 0x23, 0xff, 0xcf, 0x80, 0x39, 0xff, 0xfb, 0xf5, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xaf, 0x82, 0xff, 0xc6, 0x6b, 0x18, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xf3, 0xe1, 0xcf, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xe9, 0xc6, 0xa5, 0xff, 0xc4, 0x66, 0x10, 0xff, 0xc9, 0x70, 0x21, 0xff, 0xc6, 0x6b, 0x18, 0xff, 0xca, 0x74, 0x26, 0xff, 0xf6, 0xe8, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xb2, 0x86, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xc6, 0x6b, 0x18, 0xff, 0xe0, 0xaf, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf2, 0xeb, 0xff, 0xcd, 0x7d, 0x35, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xc9, 0x74, 0x28, 0xfd, 0xd3, 0x7a, 0x29, 0xff, 0xcc, 0x76, 0x28, 0xb2,
-    0xcc, 0x76, 0x27, 0xdc, 0xce, 0x78, 0x28, 0xff, 0xca, 0x76, 0x2a, 0xfe, 0xc7, 0x6e, 0x1b, 0xff, 0xd8, 0x99, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfa, 0xff, 0xd2, 0x8a, 0x48, 0xff, 0xc8, 0x70, 0x20, 0xff, 0xca, 0x76, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xf5, 0xe6, 0xd7, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xe8, 0xc3, 0xa1, 0xff, 0xc4, 0x65, 0x0e, 0xff, 0xc9, 0x73, 0x23, 0xff, 0xca, 0x75, 0x28, 0xff, 0xc9, 0x72, 0x23, 0xff, 0xd1, 0x87, 0x43, 0xff, 0xd7, 0x96, 0x5b, 0xff, 0xce, 0x7f, 0x37, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xca, 0x75, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x76, 0x29, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xd2, 0x8a, 0x48, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x97, 0x5c, 0xff, 0xc7, 0x6e, 0x1c, 0xff, 0xca, 0x76, 0x2a, 0xfe, 0xce, 0x78, 0x28, 0xff, 0xcd, 0x76, 0x27, 0xdc,
-    0xcb, 0x76, 0x27, 0xf4, 0xcb, 0x76, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc6, 0x6b, 0x18, 0xff, 0xe0, 0xae, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xeb, 0xdf, 0xff, 0xcb, 0x79, 0x2c, 0xff, 0xca, 0x74, 0x25, 0xff, 0xca, 0x75, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc7, 0x6d, 0x1a, 0xff, 0xed, 0xd0, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf7, 0xf2, 0xff, 0xe3, 0xb6, 0x8d, 0xff, 0xd3, 0x8c, 0x4b, 0xff, 0xce, 0x7e, 0x36, 0xff, 0xca, 0x75, 0x26, 0xff, 0xc5, 0x68, 0x13, 0xff, 0xc6, 0x6a, 0x15, 0xff, 0xca, 0x74, 0x25, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x28, 0xff, 0xca, 0x74, 0x25, 0xff, 0xcb, 0x79, 0x2c, 0xff, 0xf8, 0xeb, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xac, 0x7e, 0xff, 0xc6, 0x6c, 0x18, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xcb, 0x76, 0x27, 0xff, 0xcb, 0x76, 0x27, 0xf4,
-    0xc9, 0x75, 0x27, 0xfe, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xe5, 0xbb, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xdf, 0xcd, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xca, 0x76, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x76, 0x29, 0xff, 0xc8, 0x70, 0x20, 0xff, 0xd2, 0x89, 0x46, 0xff, 0xf9, 0xef, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf4, 0xef, 0xff, 0xf4, 0xe2, 0xd2, 0xff, 0xe8, 0xc2, 0xa0, 0xff, 0xd2, 0x8a, 0x48, 0xff, 0xc8, 0x70, 0x1e, 0xff, 0xca, 0x76, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xf3, 0xdf, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xba, 0x93, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x75, 0x27, 0xfe,
-    0xc9, 0x75, 0x27, 0xfe, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xe6, 0xbd, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xde, 0xcb, 0xff, 0xc8, 0x71, 0x21, 0xff, 0xca, 0x76, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xcf, 0x81, 0x3a, 0xff, 0xe2, 0xb5, 0x8c, 0xff, 0xf0, 0xd8, 0xc2, 0xff, 0xf8, 0xed, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf4, 0xff, 0xd6, 0x94, 0x58, 0xff, 0xc8, 0x6f, 0x1e, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc8, 0x71, 0x21, 0xff, 0xf2, 0xde, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xbd, 0x98, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x75, 0x27, 0xfe,
-    0xcb, 0x76, 0x27, 0xf4, 0xcb, 0x76, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xe2, 0xb4, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xe5, 0xd5, 0xff, 0xca, 0x75, 0x26, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x74, 0x25, 0xff, 0xc7, 0x6e, 0x1c, 0xff, 0xc6, 0x6a, 0x15, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xc8, 0x70, 0x20, 0xff, 0xcc, 0x79, 0x2d, 0xff, 0xd1, 0x87, 0x43, 0xff, 0xe1, 0xb1, 0x84, 0xff, 0xfb, 0xf4, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xdd, 0xc9, 0xff, 0xc8, 0x6f, 0x1e, 0xff, 0xca, 0x76, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x74, 0x26, 0xff, 0xf5, 0xe4, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xb5, 0x8c, 0xff, 0xc6, 0x6b, 0x18, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xcb, 0x76, 0x27, 0xff, 0xcb, 0x76, 0x27, 0xf4,
-    0xcc, 0x76, 0x27, 0xdc, 0xce, 0x78, 0x28, 0xff, 0xca, 0x76, 0x2a, 0xfe, 0xc7, 0x6c, 0x1a, 0xff, 0xdb, 0xa1, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf6, 0xf0, 0xff, 0xce, 0x81, 0x39, 0xff, 0xc9, 0x72, 0x23, 0xff, 0xca, 0x76, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x74, 0x26, 0xff, 0xcb, 0x79, 0x2c, 0xff, 0xdb, 0xa3, 0x6f, 0xff, 0xdd, 0xa7, 0x74, 0xff, 0xcd, 0x7c, 0x32, 0xff, 0xca, 0x76, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xc4, 0x64, 0x0d, 0xff, 0xe5, 0xba, 0x93, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf8, 0xec, 0xe1, 0xff, 0xcc, 0x7a, 0x2e, 0xff, 0xca, 0x74, 0x25, 0xff, 0xca, 0x75, 0x28, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc9, 0x72, 0x23, 0xff, 0xce, 0x80, 0x38, 0xff, 0xfb, 0xf5, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xa4, 0x70, 0xff, 0xc7, 0x6c, 0x19, 0xff, 0xca, 0x77, 0x2a, 0xfe, 0xce, 0x78, 0x28, 0xff, 0xcd, 0x76, 0x27, 0xdc,
-    0xcc, 0x76, 0x28, 0xb2, 0xd3, 0x7a, 0x29, 0xff, 0xc9, 0x75, 0x28, 0xfd, 0xc8, 0x70, 0x20, 0xff, 0xd2, 0x89, 0x46, 0xff, 0xfd, 0xfb, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x9c, 0x64, 0xff, 0xc7, 0x6d, 0x1b, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xcf, 0x82, 0x3b, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xa3, 0x70, 0xff, 0xc4, 0x65, 0x0f, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc4, 0x66, 0x10, 0xff, 0xe5, 0xbb, 0x95, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xf7, 0xe9, 0xdc, 0xff, 0xca, 0x76, 0x29, 0xff, 0xca, 0x75, 0x26, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc7, 0x6d, 0x1b, 0xff, 0xd9, 0x9c, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xd3, 0x8c, 0x4b, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xc9, 0x75, 0x28, 0xfd, 0xd3, 0x7a, 0x29, 0xff, 0xcc, 0x76, 0x28, 0xb2,
-    0xce, 0x77, 0x26, 0x78, 0xd5, 0x7b, 0x29, 0xff, 0xc9, 0x74, 0x27, 0xfd, 0xca, 0x75, 0x28, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xf4, 0xe1, 0xd0, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xec, 0xcc, 0xb0, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x29, 0xff, 0xc7, 0x6e, 0x1d, 0xff, 0xee, 0xd1, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xeb, 0xdf, 0xff, 0xd7, 0x97, 0x5c, 0xff, 0xcd, 0x7d, 0x34, 0xff, 0xcd, 0x7c, 0x32, 0xff, 0xdc, 0xa2, 0x6e, 0xff, 0xfb, 0xf4, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc1, 0x9e, 0xff, 0xc7, 0x6c, 0x19, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xeb, 0xcb, 0xae, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf5, 0xe5, 0xd6, 0xff, 0xca, 0x74, 0x26, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x74, 0x27, 0xfd, 0xd5, 0x7b, 0x29, 0xff, 0xce, 0x77, 0x26, 0x78,
-    0xd0, 0x77, 0x24, 0x31, 0xcc, 0x76, 0x27, 0xf9, 0xcb, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc6, 0x6c, 0x18, 0xff, 0xe1, 0xb0, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xf5, 0xff, 0xd2, 0x89, 0x47, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x76, 0x29, 0xff, 0xc9, 0x71, 0x22, 0xff, 0xcf, 0x83, 0x3c, 0xff, 0xf6, 0xe8, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf4, 0xee, 0xff, 0xfb, 0xf5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xdc, 0xc8, 0xff, 0xcc, 0x79, 0x2d, 0xff, 0xca, 0x74, 0x24, 0xff, 0xca, 0x75, 0x28, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xc8, 0x71, 0x20, 0xff, 0xd1, 0x87, 0x43, 0xff, 0xfc, 0xf8, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xb6, 0x8c, 0xff, 0xc6, 0x6b, 0x18, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xcb, 0x75, 0x27, 0xff, 0xcc, 0x76, 0x27, 0xf9, 0xca, 0x77, 0x24, 0x31,
-    0x7f, 0x7f, 0x00, 0x02, 0xcc, 0x76, 0x27, 0xc4, 0xd4, 0x7b, 0x29, 0xfe, 0xca, 0x75, 0x28, 0xfc, 0xca, 0x73, 0x25, 0xff, 0xcc, 0x7b, 0x30, 0xff, 0xf9, 0xf0, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xd7, 0xc0, 0xff, 0xc7, 0x6e, 0x1c, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xc9, 0x71, 0x20, 0xff, 0xcc, 0x7a, 0x30, 0xff, 0xe1, 0xb0, 0x83, 0xff, 0xf2, 0xdd, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xdf, 0xcc, 0xff, 0xdf, 0xac, 0x7e, 0xff, 0xca, 0x75, 0x28, 0xff, 0xc9, 0x72, 0x23, 0xff, 0xca, 0x76, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xee, 0xd2, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf4, 0xed, 0xff, 0xce, 0x7f, 0x37, 0xff, 0xc9, 0x72, 0x23, 0xff, 0xca, 0x75, 0x28, 0xfc, 0xd4, 0x7b, 0x29, 0xfe, 0xcc, 0x76, 0x27, 0xc4, 0xff, 0xff, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0xd0, 0x7a, 0x28, 0x5e, 0xd8, 0x7d, 0x2a, 0xff, 0xc9, 0x74, 0x26, 0xfc, 0xcb, 0x77, 0x2a, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xdd, 0xa7, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xb9, 0x92, 0xff, 0xc5, 0x69, 0x14, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x76, 0x29, 0xff, 0xca, 0x76, 0x29, 0xff, 0xc9, 0x74, 0x27, 0xff, 0xc4, 0x66, 0x10, 0xff, 0xd0, 0x86, 0x41, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xd3, 0x8d, 0x4d, 0xff, 0xc4, 0x66, 0x0f, 0xff, 0xcb, 0x76, 0x28, 0xff, 0xca, 0x76, 0x28, 0xff, 0xca, 0x76, 0x28, 0xff, 0xcb, 0x77, 0x2b, 0xff, 0xc5, 0x69, 0x14, 0xff, 0xe2, 0xb3, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xb0, 0x82, 0xff, 0xc6, 0x6b, 0x19, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc9, 0x74, 0x26, 0xfc, 0xd8, 0x7d, 0x2a, 0xff, 0xd0, 0x7a, 0x28, 0x5e, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x01, 0xdf, 0x7f, 0x1f, 0x08, 0xcc, 0x76, 0x27, 0xd9, 0xd1, 0x79, 0x28, 0xfe, 0xc9, 0x74, 0x27, 0xfd, 0xcb, 0x76, 0x29, 0xff, 0xc7, 0x6e, 0x1c, 0xff, 0xec, 0xcd, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xb6, 0x8c, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xcb, 0x78, 0x2b, 0xff, 0xca, 0x77, 0x2b, 0xff, 0xc9, 0x73, 0x23, 0xff, 0xd1, 0x88, 0x45, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x8f, 0x4f, 0xff, 0xc9, 0x71, 0x21, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xcb, 0x78, 0x2b, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xc6, 0x6a, 0x16, 0xff, 0xe0, 0xaf, 0x81, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xd6, 0xbf, 0xff, 0xc8, 0x70, 0x1f, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc9, 0x74, 0x27, 0xfd, 0xd1, 0x79, 0x28, 0xfe, 0xcc, 0x76, 0x27, 0xd9, 0xdf, 0x7f, 0x1f, 0x08, 0xff, 0xff, 0x00, 0x01,
-    0xaa, 0xaa, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xce, 0x7a, 0x26, 0x4f, 0xd6, 0x7c, 0x29, 0xff, 0xca, 0x74, 0x26, 0xfb, 0xca, 0x76, 0x28, 0xff, 0xca, 0x74, 0x25, 0xff, 0xca, 0x75, 0x26, 0xff, 0xf0, 0xda, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xce, 0xb2, 0xff, 0xcf, 0x81, 0x39, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xc9, 0x73, 0x23, 0xff, 0xca, 0x75, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xd4, 0x90, 0x50, 0xff, 0xd5, 0x92, 0x55, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xcc, 0x7b, 0x31, 0xff, 0xe9, 0xc6, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe2, 0xd3, 0xff, 0xcb, 0x79, 0x2e, 0xff, 0xc9, 0x73, 0x23, 0xff, 0xca, 0x76, 0x29, 0xff, 0xca, 0x74, 0x26, 0xfb, 0xd6, 0x7c, 0x29, 0xff, 0xce, 0x7a, 0x26, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x75, 0x27, 0xa0, 0xd9, 0x7e, 0x2a, 0xff, 0xc8, 0x73, 0x26, 0xfb, 0xcb, 0x77, 0x29, 0xff, 0xc9, 0x73, 0x23, 0xff, 0xca, 0x76, 0x28, 0xff, 0xec, 0xce, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf3, 0xec, 0xff, 0xe5, 0xbc, 0x96, 0xff, 0xce, 0x81, 0x39, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xca, 0x76, 0x28, 0xff, 0xc8, 0x6f, 0x1e, 0xff, 0xc8, 0x6f, 0x1d, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x74, 0x25, 0xff, 0xcd, 0x7e, 0x35, 0xff, 0xe2, 0xb3, 0x89, 0xff, 0xf8, 0xed, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xda, 0xc4, 0xff, 0xcc, 0x7b, 0x30, 0xff, 0xc8, 0x71, 0x21, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc8, 0x73, 0x26, 0xfb, 0xd9, 0x7e, 0x2a, 0xff, 0xcd, 0x75, 0x27, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x7f, 0x00, 0x02, 0xe9, 0x7f, 0x2a, 0x0c, 0xcf, 0x78, 0x28, 0xcc, 0xd6, 0x7c, 0x29, 0xff, 0xc9, 0x73, 0x26, 0xfb, 0xcb, 0x76, 0x29, 0xff, 0xc9, 0x74, 0x25, 0xff, 0xc8, 0x6f, 0x1e, 0xff, 0xdf, 0xad, 0x7e, 0xff, 0xfa, 0xf2, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xc9, 0xab, 0xff, 0xc6, 0x6b, 0x18, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xcb, 0x76, 0x29, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xe9, 0xc6, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf4, 0xff, 0xe4, 0xb8, 0x91, 0xff, 0xc9, 0x73, 0x23, 0xff, 0xc9, 0x72, 0x23, 0xff, 0xcb, 0x77, 0x29, 0xff, 0xc9, 0x73, 0x26, 0xfb, 0xd6, 0x7c, 0x29, 0xff, 0xcf, 0x78, 0x28, 0xcc, 0xe9, 0x7f, 0x2a, 0x0c, 0xff, 0x7f, 0x00, 0x02, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x76, 0x24, 0x1c, 0xd1, 0x79, 0x27, 0xd9, 0xd6, 0x7c, 0x29, 0xff, 0xc8, 0x73, 0x26, 0xfb, 0xca, 0x76, 0x28, 0xff, 0xca, 0x76, 0x29, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xcf, 0x81, 0x39, 0xff, 0xe4, 0xb8, 0x90, 0xff, 0xf8, 0xec, 0xe2, 0xff, 0xe8, 0xc4, 0xa2, 0xff, 0xc6, 0x6c, 0x19, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc6, 0x6c, 0x18, 0xff, 0xea, 0xca, 0xab, 0xff, 0xfb, 0xf4, 0xef, 0xff, 0xe8, 0xc3, 0xa0, 0xff, 0xd1, 0x88, 0x45, 0xff, 0xc6, 0x6b, 0x18, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x76, 0x29, 0xff, 0xc8, 0x73, 0x26, 0xfb, 0xd6, 0x7c, 0x29, 0xff, 0xd1, 0x79, 0x27, 0xd9, 0xd1, 0x76, 0x24, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xca, 0x7b, 0x2b, 0x1d, 0xd2, 0x7a, 0x28, 0xca, 0xd9, 0x7e, 0x2a, 0xff, 0xc9, 0x74, 0x26, 0xfc, 0xc9, 0x74, 0x27, 0xfd, 0xcb, 0x77, 0x2a, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xc6, 0x6b, 0x17, 0xff, 0xcc, 0x7b, 0x30, 0xff, 0xcc, 0x7c, 0x31, 0xff, 0xc9, 0x74, 0x25, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x28, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xcf, 0x81, 0x3a, 0xff, 0xcf, 0x81, 0x3a, 0xff, 0xc6, 0x6b, 0x18, 0xff, 0xc8, 0x70, 0x20, 0xff, 0xcb, 0x77, 0x2a, 0xff, 0xc9, 0x74, 0x27, 0xfd, 0xc9, 0x74, 0x26, 0xfc, 0xd9, 0x7e, 0x2a, 0xff, 0xd2, 0x7a, 0x28, 0xca, 0xca, 0x7b, 0x2b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x75, 0x27, 0x0d, 0xd3, 0x7a, 0x28, 0x9e, 0xd6, 0x7c, 0x29, 0xff, 0xd1, 0x79, 0x28, 0xff, 0xc9, 0x74, 0x26, 0xfc, 0xc9, 0x75, 0x28, 0xfd, 0xcb, 0x77, 0x2b, 0xfe, 0xc9, 0x74, 0x25, 0xff, 0xc9, 0x73, 0x24, 0xff, 0xca, 0x75, 0x28, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x28, 0xff, 0xc9, 0x72, 0x23, 0xff, 0xc9, 0x72, 0x22, 0xff, 0xcb, 0x77, 0x2a, 0xfe, 0xc9, 0x75, 0x28, 0xfd, 0xc9, 0x74, 0x26, 0xfc, 0xd1, 0x79, 0x28, 0xff, 0xd6, 0x7c, 0x29, 0xff, 0xd3, 0x7a, 0x28, 0x9e, 0xc4, 0x75, 0x27, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x7a, 0x27, 0x53, 0xd2, 0x7a, 0x29, 0xd3, 0xd8, 0x7d, 0x2a, 0xff, 0xd4, 0x7b, 0x29, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x74, 0x27, 0xfd, 0xc9, 0x74, 0x27, 0xfd, 0xc9, 0x74, 0x27, 0xfe, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xc9, 0x74, 0x27, 0xfe, 0xc9, 0x75, 0x28, 0xfd, 0xc9, 0x74, 0x28, 0xfd, 0xca, 0x75, 0x27, 0xff, 0xd4, 0x7b, 0x29, 0xff, 0xd8, 0x7e, 0x2a, 0xff, 0xd3, 0x7a, 0x29, 0xd3, 0xd3, 0x7a, 0x27, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0xff, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xda, 0x91, 0x24, 0x07, 0xd6, 0x7b, 0x28, 0x5f, 0xd1, 0x78, 0x27, 0xc0, 0xce, 0x77, 0x28, 0xf8, 0xd4, 0x7b, 0x29, 0xff, 0xd3, 0x7a, 0x29, 0xff, 0xce, 0x78, 0x28, 0xff, 0xcb, 0x76, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xca, 0x75, 0x27, 0xff, 0xcb, 0x76, 0x27, 0xff, 0xce, 0x78, 0x28, 0xff, 0xd3, 0x7a, 0x29, 0xff, 0xd4, 0x7b, 0x29, 0xff, 0xce, 0x77, 0x28, 0xf8, 0xd1, 0x78, 0x27, 0xc0, 0xd4, 0x7a, 0x27, 0x60, 0xbf, 0x7f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x02, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x7c, 0x29, 0x31, 0xd1, 0x79, 0x29, 0x76, 0xcf, 0x77, 0x28, 0xb1, 0xcf, 0x77, 0x27, 0xda, 0xcb, 0x76, 0x27, 0xf4, 0xc9, 0x75, 0x27, 0xfe, 0xc9, 0x75, 0x27, 0xfe, 0xcb, 0x76, 0x27, 0xf4, 0xce, 0x77, 0x27, 0xdb, 0xcf, 0x77, 0x28, 0xb1, 0xd1, 0x79, 0x29, 0x76, 0xd6, 0x7a, 0x28, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_image_dsc_t img_usdc_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_usdc_logo_data),
-    .data = img_usdc_logo_data,
-};
-
-// usdt.png -> 36x36 ARGB8888
-static const uint8_t img_usdt_logo_data[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x99, 0xb5, 0x52, 0x50, 0x9f, 0xba, 0x56, 0xab, 0x97, 0xb1, 0x51, 0xa5, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x98, 0xb2, 0x52, 0xa7, 0x97, 0xb1, 0x51, 0xa5, 0x9f, 0xba, 0x56, 0xab, 0x99, 0xb5, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7f, 0x7f, 0x7f, 0x02, 0x9f, 0xbf, 0x5f, 0x08, 0x97, 0xb1, 0x50, 0xdd, 0xa4, 0xc0, 0x58, 0xff, 0x9d, 0xb8, 0x54, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9e, 0xba, 0x55, 0xff, 0x9d, 0xb8, 0x54, 0xff, 0xa4, 0xc0, 0x58, 0xff, 0x96, 0xb1, 0x50, 0xdd, 0x9f, 0xbf, 0x5f, 0x08, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb2, 0x52, 0x5d, 0x9e, 0xba, 0x55, 0xff, 0x94, 0xae, 0x4f, 0xf9, 0x94, 0xaf, 0x4f, 0xfc, 0x95, 0xaf, 0x50, 0xfc, 0x96, 0xb0, 0x52, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x95, 0xb0, 0x51, 0xfc, 0x96, 0xb0, 0x52, 0xfc, 0x95, 0xaf, 0x50, 0xfc, 0x94, 0xaf, 0x4f, 0xfc, 0x94, 0xae, 0x4f, 0xf9, 0x9e, 0xba, 0x55, 0xff, 0x96, 0xb2, 0x52, 0x5d, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x02, 0x7f, 0xbf, 0x3f, 0x04, 0x96, 0xb0, 0x50, 0xd0, 0x9b, 0xb6, 0x53, 0xfe, 0x95, 0xae, 0x4f, 0xfd, 0x96, 0xaf, 0x51, 0xff, 0x91, 0xac, 0x4a, 0xff, 0x8e, 0xaa, 0x44, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x44, 0xff, 0x91, 0xac, 0x4a, 0xff, 0x96, 0xaf, 0x51, 0xff, 0x95, 0xae, 0x4f, 0xfd, 0x9b, 0xb6, 0x53, 0xfe, 0x96, 0xb0, 0x50, 0xd0, 0x7f, 0xbf, 0x3f, 0x04, 0x7f, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xb3, 0x51, 0x51, 0x9e, 0xb9, 0x55, 0xff, 0x94, 0xae, 0x4f, 0xfd, 0x96, 0xb0, 0x51, 0xff, 0x92, 0xad, 0x4c, 0xff, 0xaa, 0xbf, 0x73, 0xff, 0xbe, 0xce, 0x94, 0xff, 0xbc, 0xcd, 0x91, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbd, 0xcd, 0x92, 0xff, 0xbc, 0xcd, 0x91, 0xff, 0xbe, 0xce, 0x94, 0xff, 0xab, 0xc0, 0x74, 0xff, 0x92, 0xad, 0x4c, 0xff, 0x96, 0xb0, 0x51, 0xff, 0x94, 0xae, 0x4f, 0xfd, 0x9e, 0xb9, 0x55, 0xff, 0x9a, 0xb3, 0x51, 0x51, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0x96, 0xb1, 0x51, 0xc6, 0x9c, 0xb7, 0x54, 0xff, 0x94, 0xaf, 0x4f, 0xfc, 0x97, 0xb0, 0x53, 0xff, 0x8e, 0xa9, 0x43, 0xff, 0xcf, 0xdc, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xdd, 0xb4, 0xff, 0x8e, 0xa9, 0x43, 0xff, 0x97, 0xb0, 0x53, 0xff, 0x94, 0xaf, 0x4f, 0xfc, 0x9c, 0xb7, 0x54, 0xff, 0x96, 0xb1, 0x51, 0xc6, 0x7f, 0x7f, 0x00, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xb5, 0x51, 0x45, 0x9c, 0xb7, 0x53, 0xff, 0x95, 0xae, 0x4f, 0xfd, 0x95, 0xaf, 0x50, 0xff, 0x97, 0xb0, 0x53, 0xff, 0x8e, 0xa9, 0x44, 0xff, 0xcb, 0xd8, 0xa9, 0xff, 0xfc, 0xfd, 0xfb, 0xff, 0xfb, 0xfc, 0xf8, 0xff, 0xfc, 0xfd, 0xfb, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfc, 0xfd, 0xfb, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfc, 0xfd, 0xfb, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfc, 0xfd, 0xfb, 0xff, 0xfb, 0xfc, 0xf8, 0xff, 0xfc, 0xfd, 0xfb, 0xff, 0xcd, 0xd9, 0xac, 0xff, 0x8e, 0xa9, 0x44, 0xff, 0x97, 0xb0, 0x53, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xae, 0x4f, 0xfd, 0x9c, 0xb7, 0x53, 0xff, 0x97, 0xb5, 0x51, 0x45, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb0, 0x50, 0xbc, 0x9d, 0xb8, 0x54, 0xff, 0x94, 0xaf, 0x4f, 0xfc, 0x95, 0xaf, 0x50, 0xff, 0x97, 0xb0, 0x53, 0xff, 0x8e, 0xa9, 0x43, 0xff, 0xcf, 0xdb, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xdc, 0xb2, 0xff, 0x8e, 0xa9, 0x43, 0xff, 0x97, 0xb0, 0x53, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xaf, 0x4f, 0xfc, 0x9d, 0xb8, 0x54, 0xff, 0x96, 0xb0, 0x50, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x99, 0xb2, 0x50, 0x3c, 0x9a, 0xb5, 0x53, 0xfe, 0x95, 0xaf, 0x4f, 0xfd, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x97, 0xb0, 0x52, 0xff, 0x90, 0xaa, 0x47, 0xff, 0xbf, 0xcf, 0x96, 0xff, 0xe7, 0xed, 0xd6, 0xff, 0xe4, 0xeb, 0xd3, 0xff, 0xe5, 0xec, 0xd5, 0xff, 0xe6, 0xec, 0xd5, 0xff, 0xe4, 0xeb, 0xd3, 0xff, 0xec, 0xf1, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xf1, 0xe1, 0xff, 0xe4, 0xeb, 0xd2, 0xff, 0xe6, 0xec, 0xd5, 0xff, 0xe5, 0xec, 0xd5, 0xff, 0xe4, 0xeb, 0xd3, 0xff, 0xe7, 0xed, 0xd6, 0xff, 0xc0, 0xd0, 0x98, 0xff, 0x90, 0xaa, 0x47, 0xff, 0x97, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x4f, 0xfd, 0x9a, 0xb5, 0x53, 0xfe, 0x99, 0xb2, 0x50, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03,
-    0x55, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb0, 0x50, 0xb2, 0x9e, 0xb9, 0x55, 0xff, 0x94, 0xaf, 0x4f, 0xfc, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x93, 0xae, 0x4d, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x92, 0xad, 0x4c, 0xff, 0x93, 0xad, 0x4c, 0xff, 0x94, 0xae, 0x4e, 0xff, 0x8d, 0xa9, 0x42, 0xff, 0xb0, 0xc3, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xc4, 0x7e, 0xff, 0x8d, 0xa9, 0x42, 0xff, 0x94, 0xae, 0x4e, 0xff, 0x93, 0xad, 0x4c, 0xff, 0x92, 0xad, 0x4c, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x93, 0xae, 0x4d, 0xff, 0x95, 0xaf, 0x51, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xaf, 0x4f, 0xfc, 0x9e, 0xb9, 0x55, 0xff, 0x96, 0xb0, 0x50, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0x55, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x9a, 0xb4, 0x55, 0x30, 0x99, 0xb5, 0x52, 0xfc, 0x95, 0xaf, 0x50, 0xfd, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x51, 0xff, 0x94, 0xae, 0x4e, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x91, 0xac, 0x4a, 0xff, 0x92, 0xad, 0x4c, 0xff, 0x8b, 0xa8, 0x40, 0xff, 0xaf, 0xc2, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xc4, 0x7d, 0xff, 0x8b, 0xa7, 0x40, 0xff, 0x92, 0xad, 0x4c, 0xff, 0x91, 0xac, 0x4a, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x94, 0xae, 0x4e, 0xff, 0x95, 0xaf, 0x51, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xfd, 0x99, 0xb5, 0x52, 0xfc, 0x9a, 0xb4, 0x55, 0x30, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x97, 0xb1, 0x51, 0xa2, 0x9f, 0xbb, 0x56, 0xff, 0x94, 0xae, 0x4f, 0xfc, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x51, 0xff, 0x94, 0xae, 0x4f, 0xff, 0x8f, 0xab, 0x46, 0xff, 0x94, 0xaf, 0x4f, 0xff, 0x9d, 0xb5, 0x5d, 0xff, 0xa5, 0xbb, 0x69, 0xff, 0xaa, 0xbf, 0x73, 0xff, 0xb0, 0xc3, 0x7d, 0xff, 0xae, 0xc2, 0x79, 0xff, 0xc8, 0xd5, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xd6, 0xa6, 0xff, 0xae, 0xc2, 0x79, 0xff, 0xb0, 0xc3, 0x7d, 0xff, 0xaa, 0xbf, 0x74, 0xff, 0xa4, 0xbb, 0x6a, 0xff, 0x9d, 0xb5, 0x5d, 0xff, 0x95, 0xaf, 0x4f, 0xff, 0x8f, 0xab, 0x46, 0xff, 0x94, 0xae, 0x4f, 0xff, 0x96, 0xb0, 0x51, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xae, 0x4f, 0xfc, 0x9f, 0xbb, 0x56, 0xff, 0x97, 0xb1, 0x51, 0xa2, 0x00, 0x00, 0x00, 0x00,
-    0x99, 0xb8, 0x52, 0x28, 0x97, 0xb3, 0x51, 0xf5, 0x95, 0xb0, 0x51, 0xfe, 0x95, 0xaf, 0x50, 0xfe, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x51, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x97, 0xb0, 0x53, 0xff, 0xb7, 0xc9, 0x88, 0xff, 0xb9, 0xca, 0x8c, 0xff, 0xb4, 0xc6, 0x82, 0xff, 0xad, 0xc1, 0x78, 0xff, 0xa7, 0xbd, 0x6e, 0xff, 0xa3, 0xba, 0x68, 0xff, 0x99, 0xb2, 0x58, 0xff, 0xb6, 0xc8, 0x87, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xb8, 0xc9, 0x8a, 0xff, 0x99, 0xb2, 0x57, 0xff, 0xa4, 0xba, 0x68, 0xff, 0xa7, 0xbd, 0x6e, 0xff, 0xad, 0xc1, 0x78, 0xff, 0xb4, 0xc6, 0x83, 0xff, 0xb9, 0xcb, 0x8c, 0xff, 0xb7, 0xc9, 0x88, 0xff, 0x97, 0xb0, 0x52, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x96, 0xaf, 0x51, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xfe, 0x95, 0xb0, 0x51, 0xfe, 0x97, 0xb3, 0x52, 0xf5, 0x99, 0xb8, 0x52, 0x28,
-    0x97, 0xb2, 0x51, 0xaa, 0x9b, 0xb6, 0x53, 0xfe, 0x95, 0xae, 0x4f, 0xfd, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xaf, 0x51, 0xff, 0x93, 0xad, 0x4c, 0xff, 0x9f, 0xb6, 0x60, 0xff, 0xe6, 0xec, 0xd6, 0xff, 0xa8, 0xbd, 0x6f, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x90, 0xab, 0x48, 0xff, 0x91, 0xac, 0x4a, 0xff, 0x92, 0xad, 0x4c, 0xff, 0x94, 0xaf, 0x4f, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0xb2, 0xc5, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xc6, 0x83, 0xff, 0x8e, 0xaa, 0x44, 0xff, 0x94, 0xaf, 0x4f, 0xff, 0x92, 0xad, 0x4c, 0xff, 0x91, 0xac, 0x4a, 0xff, 0x90, 0xab, 0x48, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0xa8, 0xbd, 0x70, 0xff, 0xe6, 0xec, 0xd6, 0xff, 0x9f, 0xb6, 0x60, 0xff, 0x93, 0xad, 0x4c, 0xff, 0x96, 0xaf, 0x51, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xae, 0x4f, 0xfd, 0x9b, 0xb6, 0x53, 0xfe, 0x98, 0xb3, 0x51, 0xa9,
-    0x97, 0xb1, 0x50, 0xe2, 0x9b, 0xb7, 0x53, 0xff, 0x94, 0xae, 0x4f, 0xfc, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x51, 0xff, 0x93, 0xae, 0x4d, 0xff, 0x9d, 0xb6, 0x5e, 0xff, 0xea, 0xef, 0xdb, 0xff, 0xd1, 0xdc, 0xb3, 0xff, 0xac, 0xc0, 0x75, 0xff, 0x9b, 0xb4, 0x5a, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x88, 0xa5, 0x3b, 0xff, 0xa6, 0xbc, 0x6c, 0xff, 0xee, 0xf2, 0xe3, 0xff, 0xee, 0xf2, 0xe4, 0xff, 0xee, 0xf3, 0xe4, 0xff, 0xee, 0xf2, 0xe3, 0xff, 0xa8, 0xbd, 0x6f, 0xff, 0x88, 0xa5, 0x3a, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x9b, 0xb4, 0x5a, 0xff, 0xac, 0xc0, 0x75, 0xff, 0xd1, 0xdc, 0xb4, 0xff, 0xe9, 0xef, 0xdc, 0xff, 0x9d, 0xb5, 0x5e, 0xff, 0x93, 0xae, 0x4d, 0xff, 0x95, 0xaf, 0x51, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xae, 0x4f, 0xfc, 0x9b, 0xb7, 0x53, 0xff, 0x96, 0xb0, 0x50, 0xe3,
-    0x9b, 0xb8, 0x55, 0x24, 0x98, 0xb4, 0x51, 0xd4, 0x9e, 0xb9, 0x55, 0xff, 0x94, 0xae, 0x4f, 0xfb, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x51, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x95, 0xaf, 0x50, 0xff, 0xbc, 0xcd, 0x91, 0xff, 0xd5, 0xdf, 0xb9, 0xff, 0xda, 0xe4, 0xc3, 0xff, 0xd8, 0xe1, 0xbe, 0xff, 0xd1, 0xdc, 0xb3, 0xff, 0xc9, 0xd6, 0xa5, 0xff, 0xc2, 0xd1, 0x9a, 0xff, 0xbc, 0xcc, 0x90, 0xff, 0xb6, 0xc8, 0x87, 0xff, 0xb6, 0xc8, 0x87, 0xff, 0xb6, 0xc8, 0x87, 0xff, 0xb6, 0xc8, 0x87, 0xff, 0xbc, 0xcc, 0x90, 0xff, 0xc2, 0xd1, 0x9b, 0xff, 0xc9, 0xd6, 0xa5, 0xff, 0xd1, 0xdc, 0xb3, 0xff, 0xd8, 0xe1, 0xbe, 0xff, 0xdb, 0xe4, 0xc3, 0xff, 0xd4, 0xdf, 0xb9, 0xff, 0xbc, 0xcd, 0x91, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x92, 0xad, 0x4b, 0xff, 0x96, 0xaf, 0x51, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xae, 0x4f, 0xfb, 0x9e, 0xb9, 0x55, 0xff, 0x99, 0xb3, 0x51, 0xd5, 0x97, 0xb3, 0x52, 0x25,
-    0x00, 0x00, 0x00, 0x00, 0x93, 0xb0, 0x4e, 0x1a, 0x9c, 0xb6, 0x53, 0xcf, 0x9e, 0xba, 0x55, 0xff, 0x94, 0xad, 0x50, 0xfb, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xaf, 0x51, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x8d, 0xa9, 0x43, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x98, 0xb1, 0x54, 0xff, 0xa4, 0xba, 0x69, 0xff, 0xb0, 0xc3, 0x7d, 0xff, 0xbb, 0xcc, 0x8f, 0xff, 0xbf, 0xce, 0x95, 0xff, 0xd7, 0xe1, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xe2, 0xbe, 0xff, 0xbf, 0xce, 0x94, 0xff, 0xbc, 0xcc, 0x8f, 0xff, 0xb0, 0xc3, 0x7c, 0xff, 0xa4, 0xba, 0x69, 0xff, 0x98, 0xb1, 0x54, 0xff, 0x8e, 0xaa, 0x45, 0xff, 0x8d, 0xa9, 0x43, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xaf, 0x51, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xad, 0x50, 0xfb, 0x9e, 0xb9, 0x55, 0xff, 0x9c, 0xb6, 0x53, 0xcf, 0x93, 0xb0, 0x4e, 0x1a, 0x00, 0x00, 0x00, 0x00,
-    0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x99, 0xb2, 0x4c, 0x14, 0x9b, 0xb5, 0x53, 0xc7, 0x9e, 0xba, 0x55, 0xff, 0x94, 0xad, 0x4f, 0xfb, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x94, 0xae, 0x4f, 0xff, 0x91, 0xac, 0x4a, 0xff, 0x8f, 0xaa, 0x46, 0xff, 0x8e, 0xaa, 0x46, 0xff, 0x86, 0xa4, 0x38, 0xff, 0xab, 0xbf, 0x74, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xad, 0xc1, 0x76, 0xff, 0x86, 0xa4, 0x38, 0xff, 0x8f, 0xaa, 0x46, 0xff, 0x8f, 0xaa, 0x46, 0xff, 0x91, 0xac, 0x4a, 0xff, 0x94, 0xae, 0x4f, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xad, 0x4f, 0xfb, 0x9e, 0xba, 0x55, 0xff, 0x9a, 0xb6, 0x52, 0xc8, 0x99, 0xb2, 0x4c, 0x14, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xaf, 0x4f, 0x10, 0x9a, 0xb6, 0x53, 0xc1, 0x9f, 0xba, 0x55, 0xff, 0x94, 0xae, 0x50, 0xfb, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xaf, 0x51, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x97, 0xb1, 0x54, 0xff, 0x91, 0xac, 0x49, 0xff, 0xb2, 0xc5, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xc7, 0x83, 0xff, 0x91, 0xac, 0x49, 0xff, 0x97, 0xb1, 0x54, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x96, 0xaf, 0x51, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xae, 0x50, 0xfb, 0x9f, 0xba, 0x55, 0xff, 0x9a, 0xb6, 0x53, 0xc1, 0x8f, 0xaf, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x94, 0xaa, 0x55, 0x0c, 0x98, 0xb4, 0x51, 0xbb, 0x9f, 0xbb, 0x56, 0xff, 0x94, 0xad, 0x50, 0xfb, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x8f, 0xab, 0x46, 0xff, 0xb1, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xc6, 0x81, 0xff, 0x8f, 0xab, 0x46, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xad, 0x50, 0xfb, 0x9f, 0xbb, 0x56, 0xff, 0x9a, 0xb4, 0x53, 0xbb, 0x94, 0xaa, 0x55, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xaa, 0x55, 0x09, 0x99, 0xb3, 0x51, 0xb3, 0xa0, 0xbc, 0x56, 0xff, 0x94, 0xaf, 0x4f, 0xfa, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x8f, 0xab, 0x46, 0xff, 0xb1, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xc6, 0x81, 0xff, 0x8f, 0xab, 0x46, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xaf, 0x4f, 0xfa, 0xa0, 0xbc, 0x56, 0xff, 0x99, 0xb2, 0x52, 0xb4, 0x8d, 0xaa, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x99, 0xcc, 0x66, 0x05, 0x99, 0xb4, 0x52, 0xaa, 0xa0, 0xbc, 0x56, 0xff, 0x94, 0xae, 0x50, 0xfb, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x8f, 0xab, 0x46, 0xff, 0xb1, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xc6, 0x81, 0xff, 0x8f, 0xab, 0x46, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x94, 0xae, 0x50, 0xfb, 0xa0, 0xbc, 0x56, 0xff, 0x99, 0xb5, 0x52, 0xaa, 0x99, 0xcc, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0x01, 0x99, 0xb4, 0x52, 0xa1, 0xa0, 0xbc, 0x56, 0xff, 0x95, 0xae, 0x50, 0xfb, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x8f, 0xab, 0x46, 0xff, 0xb1, 0xc4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xc6, 0x81, 0xff, 0x8f, 0xab, 0x46, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xae, 0x50, 0xfb, 0xa1, 0xbc, 0x56, 0xff, 0x99, 0xb4, 0x52, 0xa1, 0xff, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x01, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x02, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x99, 0xb4, 0x52, 0x97, 0xa0, 0xbc, 0x56, 0xff, 0x95, 0xae, 0x50, 0xfb, 0x95, 0xaf, 0x50, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x8f, 0xab, 0x46, 0xff, 0xb1, 0xc4, 0x7f, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xb3, 0xc6, 0x81, 0xff, 0x8f, 0xab, 0x46, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x50, 0xff, 0x95, 0xae, 0x50, 0xfb, 0xa0, 0xbc, 0x56, 0xff, 0x9b, 0xb4, 0x52, 0x97, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xb5, 0x52, 0x8e, 0xa1, 0xbc, 0x56, 0xff, 0x95, 0xaf, 0x50, 0xfb, 0x96, 0xb0, 0x52, 0xff, 0x8f, 0xab, 0x46, 0xff, 0xb2, 0xc5, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xc7, 0x83, 0xff, 0x8f, 0xab, 0x46, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x50, 0xfb, 0xa1, 0xbc, 0x56, 0xff, 0x9a, 0xb5, 0x52, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xb3, 0x53, 0x87, 0x9f, 0xbb, 0x56, 0xff, 0x96, 0xb0, 0x51, 0xfb, 0x93, 0xad, 0x4d, 0xfe, 0x9c, 0xb4, 0x5c, 0xff, 0xb0, 0xc4, 0x7c, 0xff, 0xaf, 0xc3, 0x7b, 0xff, 0xaf, 0xc3, 0x7a, 0xff, 0xb0, 0xc4, 0x7d, 0xff, 0x9d, 0xb5, 0x5c, 0xff, 0x93, 0xad, 0x4d, 0xfe, 0x96, 0xb0, 0x51, 0xfb, 0x9f, 0xbb, 0x56, 0xff, 0x9a, 0xb3, 0x53, 0x87, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x98, 0xb2, 0x52, 0x7f, 0x9f, 0xba, 0x55, 0xff, 0x95, 0xb0, 0x50, 0xfc, 0x93, 0xad, 0x4d, 0xfe, 0x90, 0xab, 0x47, 0xff, 0x90, 0xab, 0x47, 0xff, 0x90, 0xab, 0x47, 0xff, 0x90, 0xab, 0x47, 0xff, 0x93, 0xad, 0x4d, 0xfe, 0x95, 0xb0, 0x50, 0xfc, 0x9f, 0xba, 0x55, 0xff, 0x98, 0xb2, 0x52, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x98, 0xb1, 0x51, 0x77, 0x9e, 0xba, 0x54, 0xff, 0x96, 0xb0, 0x50, 0xfc, 0x95, 0xaf, 0x52, 0xfe, 0x96, 0xb0, 0x52, 0xff, 0x96, 0xb0, 0x52, 0xff, 0x95, 0xaf, 0x52, 0xfe, 0x96, 0xb0, 0x50, 0xfc, 0x9e, 0xba, 0x55, 0xff, 0x98, 0xb1, 0x51, 0x77, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7f, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x98, 0xb1, 0x51, 0x6d, 0x9d, 0xb8, 0x54, 0xff, 0x96, 0xb0, 0x50, 0xfd, 0x94, 0xae, 0x50, 0xfe, 0x94, 0xae, 0x50, 0xfe, 0x96, 0xb0, 0x50, 0xfd, 0x9d, 0xb8, 0x54, 0xff, 0x98, 0xb1, 0x51, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xb1, 0x52, 0x63, 0x9b, 0xb6, 0x53, 0xff, 0x96, 0xb0, 0x50, 0xfd, 0x96, 0xb0, 0x50, 0xfd, 0x9c, 0xb6, 0x53, 0xff, 0x9a, 0xb4, 0x52, 0x63, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xb4, 0x53, 0x59, 0x9b, 0xb6, 0x53, 0xff, 0x9b, 0xb6, 0x53, 0xff, 0x9a, 0xb4, 0x53, 0x59, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xb5, 0x52, 0x57, 0x9b, 0xb5, 0x52, 0x57, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xbf, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0xaa, 0xaa, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_image_dsc_t img_usdt_logo = {
-    .header = {
-        .magic = LV_IMAGE_HEADER_MAGIC,
-        .cf = LV_COLOR_FORMAT_ARGB8888,
-        .w = 36,
-        .h = 36,
-        .stride = 144,
-    },
-    .data_size = sizeof(img_usdt_logo_data),
-    .data = img_usdt_logo_data,
-};
-
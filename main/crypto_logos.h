@@ -1,20 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2025-2026 Bruce
- * SPDX-License-Identifier: CC-BY-NC-4.0
- */
-
-#pragma once
-
-#include "lvgl.h"
-
-extern const lv_image_dsc_t img_bitcoin_logo;
-extern const lv_image_dsc_t img_ethereum_logo;
-extern const lv_image_dsc_t img_paxg_logo;
-extern const lv_image_dsc_t img_chainbase_logo;
-extern const lv_image_dsc_t img_sui_logo;
-extern const lv_image_dsc_t img_doge_logo;
-extern const lv_image_dsc_t img_solana_logo;
-extern const lv_image_dsc_t img_tron_logo;
-extern const lv_image_dsc_t img_usdc_logo;
-extern const lv_image_dsc_t img_usdt_logo;
-
@@ -0,0 +1,239 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "disp_stats.h"
+
+#include "esp_lvgl_port.h"
+#include "esp_timer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define WINDOW_US     (10 * 1000 * 1000)   // on-screen time per window
+#define HIST_BUCKETS  17                   // bucket k counts values < 2^k
+
+typedef struct {
+    int64_t  span_us;             // time the screen was shown
+    uint32_t frames;
+    uint32_t areas;
+    uint64_t px;
+    uint32_t render_max_us;
+    uint32_t flush_max_us;
+    uint32_t px_max;
+    uint16_t render[HIST_BUCKETS];
+    uint16_t flush[HIST_BUCKETS];
+    uint16_t px_hist[HIST_BUCKETS];
+} window_t;
+
+// Two windows per screen: the current one and the one before, so a
+// summary always covers between one and two windows of frames
+typedef struct {
+    window_t cur;
+    window_t prev;
+} screen_stats_t;
+
+static const char *const s_names[DISP_SCREEN_COUNT] = { "boot", "main", "info", "setup" };
+
+// Written only from LVGL's display events, i.e. with the LVGL lock held
+static screen_stats_t s_stats[DISP_SCREEN_COUNT];
+static disp_screen_t  s_screen = DISP_SCREEN_BOOT;
+static int64_t        s_mark_us;          // s_screen's time is booked up to here
+
+// Frame in progress
+static uint32_t s_areas;
+static uint32_t s_px;
+static int64_t  s_render_us;
+static int64_t  s_flush_us;
+static int64_t  s_render_t0;
+static int64_t  s_render_flush;           // s_flush_us at s_render_t0
+static int64_t  s_flush_t0;
+
+static int bucket(uint32_t v)
+{
+    int b = v ? 32 - __builtin_clz(v) : 0;
+    return b < HIST_BUCKETS ? b : HIST_BUCKETS - 1;
+}
+
+static void book_span(int64_t now)
+{
+    s_stats[s_screen].cur.span_us += now - s_mark_us;
+    s_mark_us = now;
+}
+
+static void record_frame(void)
+{
+    screen_stats_t *st = &s_stats[s_screen];
+    if (st->cur.span_us >= WINDOW_US) {
+        st->prev = st->cur;
+        memset(&st->cur, 0, sizeof(st->cur));
+    }
+
+    window_t *w = &st->cur;
+    uint32_t render = (uint32_t)s_render_us;
+    uint32_t flush = (uint32_t)s_flush_us;
+    w->frames++;
+    w->areas += s_areas;
+    w->px += s_px;
+    w->render[bucket(render)]++;
+    w->flush[bucket(flush)]++;
+    w->px_hist[bucket(s_px)]++;
+    if (render > w->render_max_us) w->render_max_us = render;
+    if (flush > w->flush_max_us) w->flush_max_us = flush;
+    if (s_px > w->px_max) w->px_max = s_px;
+}
+
+static void disp_event_cb(lv_event_t *e)
+{
+    int64_t now = esp_timer_get_time();
+
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_INVALIDATE_AREA:
+        s_areas++;                      // before the frame that draws it
+        break;
+    case LV_EVENT_REFR_START:
+        book_span(now);
+        break;
+    case LV_EVENT_RENDER_START:
+        s_render_t0 = now;
+        s_render_flush = s_flush_us;
+        break;
+    case LV_EVENT_RENDER_READY:
+        // Flushes of finished chunks happen while rendering: not counted
+        s_render_us += now - s_render_t0 - (s_flush_us - s_render_flush);
+        break;
+    case LV_EVENT_FLUSH_START:          // byte swap + queueing the SPI DMA
+        s_px += lv_area_get_size(lv_event_get_param(e));
+        s_flush_t0 = now;
+        break;
+    case LV_EVENT_FLUSH_WAIT_START:     // buffer still being sent
+        s_flush_t0 = now;
+        break;
+    case LV_EVENT_FLUSH_FINISH:
+    case LV_EVENT_FLUSH_WAIT_FINISH:
+        s_flush_us += now - s_flush_t0;
+        break;
+    case LV_EVENT_REFR_READY:
+        if (!s_px) break;               // nothing was drawn
+        record_frame();
+        s_areas = 0;
+        s_px = 0;
+        s_render_us = 0;
+        s_flush_us = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+void disp_stats_init(lv_display_t *disp)
+{
+    s_mark_us = esp_timer_get_time();
+    lv_display_add_event_cb(disp, disp_event_cb, LV_EVENT_ALL, NULL);
+}
+
+void disp_stats_set_screen(disp_screen_t screen)
+{
+    if (screen == s_screen || screen >= DISP_SCREEN_COUNT) return;
+    book_span(esp_timer_get_time());
+    s_screen = screen;
+}
+
+// ── Summaries ──────────────────────────────────────────────────────
+static void merge(window_t *m, const screen_stats_t *st)
+{
+    *m = st->cur;
+    const window_t *p = &st->prev;
+    m->span_us += p->span_us;
+    m->frames += p->frames;
+    m->areas += p->areas;
+    m->px += p->px;
+    if (p->render_max_us > m->render_max_us) m->render_max_us = p->render_max_us;
+    if (p->flush_max_us > m->flush_max_us) m->flush_max_us = p->flush_max_us;
+    if (p->px_max > m->px_max) m->px_max = p->px_max;
+    for (int k = 0; k < HIST_BUCKETS; k++) {
+        m->render[k] += p->render[k];
+        m->flush[k] += p->flush[k];
+        m->px_hist[k] += p->px_hist[k];
+    }
+}
+
+/* Upper bound of the bucket holding the 95th percentile; the maximum
+ * when that is the open-ended last bucket. */
+static uint32_t p95(const uint16_t *hist, uint32_t frames, uint32_t max)
+{
+    uint32_t need = (frames * 95 + 99) / 100, n = 0;
+    for (int k = 0; k < HIST_BUCKETS - 1; k++) {
+        n += hist[k];
+        if (n >= need) return k ? 1u << k : 0;
+    }
+    return max;
+}
+
+static bool summarize(const window_t *m, disp_stats_summary_t *out)
+{
+    if (!m->frames) return false;
+    int64_t span = m->span_us > 0 ? m->span_us : 1;
+    *out = (disp_stats_summary_t) {
+        .frames = m->frames,
+        .fps_x10 = (uint32_t)(m->frames * 10000000LL / span),
+        .areas_x10 = m->areas * 10 / m->frames,
+        .px_per_frame = (uint32_t)(m->px / m->frames),
+        .spi_bytes_per_s = (uint32_t)(m->px * sizeof(uint16_t) * 1000000LL / span),
+        .render_p95_us = p95(m->render, m->frames, m->render_max_us),
+        .flush_p95_us = p95(m->flush, m->frames, m->flush_max_us),
+    };
+    return true;
+}
+
+bool disp_stats_get(disp_screen_t screen, disp_stats_summary_t *out)
+{
+    if (screen >= DISP_SCREEN_COUNT) return false;
+    if (screen == s_screen) book_span(esp_timer_get_time());
+    window_t m;
+    merge(&m, &s_stats[screen]);
+    return summarize(&m, out);
+}
+
+static void print_hist(const char *name, const uint16_t *hist, uint32_t max)
+{
+    printf("    %-9s", name);
+    for (int k = 0; k < HIST_BUCKETS; k++) {
+        if (!hist[k]) continue;
+        if (k == HIST_BUCKETS - 1) {
+            printf(" >=%lu:%u", 1UL << (k - 1), (unsigned)hist[k]);
+        } else {
+            printf(" <%lu:%u", 1UL << k, (unsigned)hist[k]);
+        }
+    }
+    printf("  (max %lu)\n", (unsigned long)max);
+}
+
+void disp_stats_dump(void)
+{
+    screen_stats_t copy[DISP_SCREEN_COUNT];
+    if (!lvgl_port_lock(100)) return;
+    book_span(esp_timer_get_time());
+    memcpy(copy, s_stats, sizeof(copy));
+    lvgl_port_unlock();
+
+    printf("Display pipeline, last 10-20 s shown per screen:\n");
+    for (int i = 0; i < DISP_SCREEN_COUNT; i++) {
+        window_t m;
+        disp_stats_summary_t s;
+        merge(&m, &copy[i]);
+        if (!summarize(&m, &s)) continue;
+
+        printf("  %-5s %lu frames, %lu.%lu fps, %lu.%lu areas/frame, %lu px/frame, "
+               "%lu KB/s SPI, render p95 %lu us, flush p95 %lu us\n",
+               s_names[i], (unsigned long)s.frames,
+               (unsigned long)(s.fps_x10 / 10), (unsigned long)(s.fps_x10 % 10),
+               (unsigned long)(s.areas_x10 / 10), (unsigned long)(s.areas_x10 % 10),
+               (unsigned long)s.px_per_frame, (unsigned long)(s.spi_bytes_per_s / 1024),
+               (unsigned long)s.render_p95_us, (unsigned long)s.flush_p95_us);
+        print_hist("render us", m.render, m.render_max_us);
+        print_hist("flush us", m.flush, m.flush_max_us);
+        print_hist("px", m.px_hist, m.px_max);
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "lvgl.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Per-frame cost of the display pipeline, from LVGL's display events:
+ * invalidated areas, pixels rendered (and so bytes sent over SPI),
+ * render time and flush time (the port's flush callback plus waiting
+ * for the SPI DMA). Frames are booked to the screen being shown and
+ * kept as log2 histograms over the last 10-20 s of that screen.
+ */
+
+typedef enum {
+    DISP_SCREEN_BOOT,
+    DISP_SCREEN_MAIN,
+    DISP_SCREEN_INFO,
+    DISP_SCREEN_SETUP,
+    DISP_SCREEN_COUNT,
+} disp_screen_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t fps_x10;             // frames per second on that screen, x10
+    uint32_t areas_x10;           // invalidated areas per frame, x10
+    uint32_t px_per_frame;        // pixels rendered and sent
+    uint32_t spi_bytes_per_s;
+    uint32_t render_p95_us;       // upper bound of the 95th percentile bucket
+    uint32_t flush_p95_us;
+} disp_stats_summary_t;
+
+/** Start recording; call once after the display is added. */
+void disp_stats_init(lv_display_t *disp);
+
+/** Book the following frames to screen. Call with the LVGL lock held. */
+void disp_stats_set_screen(disp_screen_t screen);
+
+/**
+ * Summary of a screen's recent frames; false if it has none. Call with
+ * the LVGL lock held.
+ */
+bool disp_stats_get(disp_screen_t screen, disp_stats_summary_t *out);
+
+/**
+ * Print every screen's summary and histograms to the console. Takes
+ * the LVGL lock only to copy the counters; call without it.
+ */
+void disp_stats_dump(void);
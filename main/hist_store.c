@@ -0,0 +1,399 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "hist_store.h"
+#include "price_series.h"
+#include "token_config.h"
+
+#include "esp_partition.h"
+#include "esp_crc.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include <string.h>
+
+static const char *TAG = "hist_store";
+
+// ── Layout ─────────────────────────────────────────────────────────
+// The partition is a circular log of 4 KB sectors. Each sector starts
+// with a header carrying a sequence number; records follow back to back
+// until the next one does not fit. Writing moves to the sector after
+// the newest, erasing the oldest data, so every sector is erased once
+// per trip around the partition. A record is one price_series chunk
+// and is written with a single flash write; its CRC covers header and
+// payload, so a record torn by a power cut fails the check at boot and
+// closes its sector.
+#define HIST_PART_SUBTYPE  0x41
+#define HIST_SECTOR        4096
+#define HIST_MAGIC         0x54534948   // "HIST"
+#define HIST_VERSION       1
+#define HIST_FLUSH_MS      (30 * 60 * 1000)
+#define HIST_CHUNKS        3            // per token, between flushes
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;                   // increases with every sector opened
+    uint16_t version;
+    uint16_t interval_s;
+    uint32_t crc;                   // over the fields above
+} hist_sector_t;
+
+typedef struct {
+    uint16_t used;                  // payload bytes, 0xFFFF = erased: end of log
+    uint16_t count;                 // samples
+    uint32_t crc;                   // over the rest of the header and the payload
+    char     symbol[8];
+    int64_t  start_s;
+    int64_t  base;
+    int64_t  quantum;
+} hist_rec_t;
+
+#define REC_MAX  (sizeof(hist_rec_t) + SERIES_CHUNK_DATA)
+
+// Records are sealed at every flush, so one never spans more than a
+// flush period; queries start that far before the requested time
+#define REC_SPAN_S  (HIST_FLUSH_MS / 1000 + HIST_STORE_INTERVAL_S)
+
+// ── Flash state (s_flash_mux) ──────────────────────────────────────
+static const esp_partition_t *s_part;
+static SemaphoreHandle_t s_flash_mux;
+static int      s_sectors;
+static int      s_head;             // sector being written
+static int      s_used;             // valid sectors, ending at s_head
+static uint32_t s_seq;              // sequence number of s_head
+static uint32_t s_off;              // write offset in s_head
+
+// ── Buffered samples (s_lock) ──────────────────────────────────────
+typedef struct {
+    char           symbol[8];       // "" = free
+    price_series_t series;
+    series_chunk_t chunk[HIST_CHUNKS];
+} hist_buf_t;
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static hist_buf_t s_buf[MAX_TOKENS];
+static TaskHandle_t s_task;
+
+static uint32_t sector_crc(const hist_sector_t *h)
+{
+    return esp_crc32_le(0, (const uint8_t *)h, offsetof(hist_sector_t, crc));
+}
+
+/* CRC of used, count, everything after crc, and the payload. */
+static uint32_t rec_crc(const hist_rec_t *r, const uint8_t *data)
+{
+    uint32_t crc = esp_crc32_le(0, (const uint8_t *)r, offsetof(hist_rec_t, crc));
+    crc = esp_crc32_le(crc, (const uint8_t *)r->symbol, sizeof(*r) - offsetof(hist_rec_t, symbol));
+    return esp_crc32_le(crc, data, r->used);
+}
+
+static size_t sector_base(int sector)
+{
+    return (size_t)sector * HIST_SECTOR;
+}
+
+static bool read_sector(int sector, hist_sector_t *h)
+{
+    if (esp_partition_read(s_part, sector_base(sector), h, sizeof(*h)) != ESP_OK) return false;
+    return h->magic == HIST_MAGIC && h->version == HIST_VERSION &&
+           h->interval_s == HIST_STORE_INTERVAL_S && h->crc == sector_crc(h);
+}
+
+/* Read and check the record at off. Returns its size, 0 at the end of
+ * the sector's log, -1 if it is torn. */
+static int read_record(int sector, uint32_t off, hist_rec_t *r, uint8_t *data)
+{
+    if (off + sizeof(*r) > HIST_SECTOR) return 0;
+    if (esp_partition_read(s_part, sector_base(sector) + off, r, sizeof(*r)) != ESP_OK) return -1;
+    if (r->used == 0xFFFF) return 0;
+    if (r->used > SERIES_CHUNK_DATA || off + sizeof(*r) + r->used > HIST_SECTOR) return -1;
+    if (esp_partition_read(s_part, sector_base(sector) + off + sizeof(*r), data, r->used) != ESP_OK ||
+        rec_crc(r, data) != r->crc) {
+        return -1;
+    }
+    return sizeof(*r) + r->used;
+}
+
+// ── Mount / recovery ───────────────────────────────────────────────
+static bool mount(void)
+{
+    const esp_partition_t *part =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA, HIST_PART_SUBTYPE, "history");
+    if (!part || part->size < 2 * HIST_SECTOR) {
+        ESP_LOGW(TAG, "No history partition");
+        return false;
+    }
+    s_part = part;
+    s_sectors = part->size / HIST_SECTOR;
+
+    // Newest valid sector
+    int64_t t0 = esp_timer_get_time();
+    hist_sector_t h;
+    s_head = -1;
+    for (int i = 0; i < s_sectors; i++) {
+        if (!read_sector(i, &h)) continue;
+        if (s_head < 0 || (int32_t)(h.seq - s_seq) > 0) {
+            s_head = i;
+            s_seq = h.seq;
+        }
+    }
+    if (s_head < 0) {
+        // Empty: the first write opens sector 0
+        s_head = s_sectors - 1;
+        s_used = 0;
+        s_seq = 0;
+        s_off = HIST_SECTOR;
+        ESP_LOGI(TAG, "Empty, %d sectors", s_sectors);
+        return true;
+    }
+
+    // Valid sectors run backwards from the head with consecutive numbers
+    s_used = 1;
+    while (s_used < s_sectors) {
+        int prev = (s_head - s_used + s_sectors) % s_sectors;
+        if (!read_sector(prev, &h) || h.seq != s_seq - s_used) break;
+        s_used++;
+    }
+
+    // Write position: after the last intact record of the head sector
+    hist_rec_t r;
+    uint8_t data[SERIES_CHUNK_DATA];
+    int n;
+    s_off = sizeof(hist_sector_t);
+    while ((n = read_record(s_head, s_off, &r, data)) > 0) s_off += n;
+    if (n < 0) {
+        ESP_LOGW(TAG, "Torn record in sector %d at %lu, sector closed", s_head, (unsigned long)s_off);
+        s_off = HIST_SECTOR;
+    }
+
+    ESP_LOGI(TAG, "Mounted in %lld ms: %d/%d sectors, head %d at %lu",
+             (esp_timer_get_time() - t0) / 1000, s_used, s_sectors, s_head, (unsigned long)s_off);
+    return true;
+}
+
+// ── Writing (flush task) ───────────────────────────────────────────
+/* Erase the sector after the head and make it the head. */
+static bool open_sector(void)
+{
+    int next = (s_head + 1) % s_sectors;
+
+    // The erase disables the flash cache for tens of ms, which stalls
+    // every task running from flash, LVGL included: a frame in progress
+    // finishes that much later. That cannot be avoided, only kept rare:
+    // it happens once per 4 KB of history (every few hours) on this
+    // lowest-priority task, which holds no lock another task waits on.
+    esp_err_t err = esp_partition_erase_range(s_part, sector_base(next), HIST_SECTOR);
+    if (err == ESP_OK && s_used == s_sectors) s_used--;   // the oldest sector is gone
+
+    hist_sector_t h = {
+        .magic = HIST_MAGIC,
+        .seq = s_seq + 1,
+        .version = HIST_VERSION,
+        .interval_s = HIST_STORE_INTERVAL_S,
+    };
+    h.crc = sector_crc(&h);
+    if (err == ESP_OK) err = esp_partition_write(s_part, sector_base(next), &h, sizeof(h));
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Opening sector %d failed: %s", next, esp_err_to_name(err));
+        return false;
+    }
+
+    s_head = next;
+    s_seq++;
+    s_off = sizeof(h);
+    s_used++;
+    return true;
+}
+
+static bool write_record(const char *symbol, int64_t quantum, const series_chunk_t *c)
+{
+    static uint8_t rec[REC_MAX];
+    hist_rec_t *r = (hist_rec_t *)rec;
+    memset(r, 0, sizeof(*r));
+    r->used = c->used;
+    r->count = c->count;
+    memcpy(r->symbol, symbol, sizeof(r->symbol));
+    r->start_s = c->start_s;
+    r->base = c->base;
+    r->quantum = quantum;
+    memcpy(rec + sizeof(*r), c->data, c->used);
+    r->crc = rec_crc(r, c->data);
+
+    size_t len = sizeof(*r) + c->used;
+    if (s_off + len > HIST_SECTOR && !open_sector()) return false;
+    esp_err_t err = esp_partition_write(s_part, sector_base(s_head) + s_off, rec, len);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Write failed: %s", esp_err_to_name(err));
+        s_off = HIST_SECTOR;        // the tail may be half written
+        return false;
+    }
+    s_off += len;
+    return true;
+}
+
+void hist_store_flush(void)
+{
+    if (!s_part) return;
+
+    static hist_buf_t b;            // one token at a time, off the stack
+    int records = 0;
+    int64_t t0 = esp_timer_get_time();
+
+    xSemaphoreTake(s_flash_mux, portMAX_DELAY);
+    for (int i = 0; i < MAX_TOKENS; i++) {
+        // Take the token's chunks and seal them: the next sample starts
+        // a new record
+        taskENTER_CRITICAL(&s_lock);
+        b = s_buf[i];
+        price_series_reset(&s_buf[i].series);
+        taskEXIT_CRITICAL(&s_lock);
+
+        for (int k = 0; k < b.series.len; k++) {
+            const series_chunk_t *c = &b.chunk[(b.series.first + k) % HIST_CHUNKS];
+            if (c->count && write_record(b.symbol, b.series.quantum, c)) records++;
+        }
+    }
+    xSemaphoreGive(s_flash_mux);
+
+    if (records) {
+        ESP_LOGI(TAG, "Wrote %d records in %lld ms, sector %d at %lu", records,
+                 (esp_timer_get_time() - t0) / 1000, s_head, (unsigned long)s_off);
+    }
+}
+
+static void hist_task(void *arg)
+{
+    (void)arg;
+    while (1) {
+        // Periodic, or early when a token's buffer is about to wrap
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(HIST_FLUSH_MS));
+        hist_store_flush();
+    }
+}
+
+void hist_store_start(void)
+{
+    if (s_part || !mount()) return;
+    s_flash_mux = xSemaphoreCreateMutex();
+    // Lowest priority, like the snapshot: flash work waits for idle time
+    xTaskCreate(hist_task, "hist_store", 3072, NULL, 1, &s_task);
+}
+
+// ── Appending (any task) ───────────────────────────────────────────
+void hist_store_append(const char *symbol, int64_t ts_s, price_t p)
+{
+    if (!s_task) return;
+
+    bool wake = false;
+    taskENTER_CRITICAL(&s_lock);
+    hist_buf_t *b = NULL;
+    hist_buf_t *spare = NULL;
+    for (int i = 0; i < MAX_TOKENS; i++) {
+        if (strncmp(s_buf[i].symbol, symbol, sizeof(s_buf[i].symbol)) == 0) {
+            b = &s_buf[i];
+            break;
+        }
+        // A free slot, or one a removed token left empty
+        if (!spare && (!s_buf[i].symbol[0] || !s_buf[i].series.len)) spare = &s_buf[i];
+    }
+    if (!b && spare) {
+        b = spare;
+        strlcpy(b->symbol, symbol, sizeof(b->symbol));
+        price_series_init(&b->series, b->chunk, HIST_CHUNKS, HIST_STORE_INTERVAL_S);
+    }
+    if (b) {
+        price_series_append(&b->series, ts_s, p);
+        wake = b->series.len >= HIST_CHUNKS - 1;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (wake) xTaskNotifyGive(s_task);
+}
+
+// ── Queries ────────────────────────────────────────────────────────
+static int ring_sector(int i)
+{
+    return (s_head - s_used + 1 + i + s_sectors) % s_sectors;
+}
+
+/* Start time of the first record of the i-th oldest sector, or
+ * INT64_MAX if it has none. */
+static int64_t sector_first_s(int i)
+{
+    hist_rec_t r;
+    if (esp_partition_read(s_part, sector_base(ring_sector(i)) + sizeof(hist_sector_t),
+                           &r, sizeof(r)) != ESP_OK || r.used == 0xFFFF) {
+        return INT64_MAX;
+    }
+    return r.start_s;
+}
+
+int hist_store_query(const char *symbol, int64_t from_s, int64_t to_s,
+                     hist_store_cb_t cb, void *ctx)
+{
+    if (!s_part || !s_flash_mux) return 0;
+
+    xSemaphoreTake(s_flash_mux, portMAX_DELAY);
+
+    // Sectors are in time order: binary search for the last one that
+    // starts before any record reaching from_s can
+    int64_t edge = from_s - REC_SPAN_S;
+    int lo = 0, hi = s_used - 1, first = 0;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (sector_first_s(mid) <= edge) {
+            first = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    static hist_rec_t r;
+    static series_chunk_t c;
+    int samples = 0;
+    bool more = true;
+    for (int i = first; more && i < s_used; i++) {
+        int sector = ring_sector(i);
+        uint32_t off = sizeof(hist_sector_t);
+        int n;
+        while (more && (n = read_record(sector, off, &r, c.data)) > 0) {
+            off += n;
+            if (r.start_s >= to_s + REC_SPAN_S) {
+                more = false;       // the log has passed the range
+                break;
+            }
+            if (strncmp(r.symbol, symbol, sizeof(r.symbol)) != 0) continue;
+            if (r.start_s + (int64_t)r.count * HIST_STORE_INTERVAL_S <= from_s) continue;
+
+            // Decode the record as a one-chunk series
+            c.start_s = r.start_s;
+            c.base = r.base;
+            c.count = r.count;
+            c.used = r.used;
+            price_series_t s = {
+                .chunk = &c, .nchunks = 1, .len = 1,
+                .interval_s = HIST_STORE_INTERVAL_S, .quantum = r.quantum,
+            };
+            series_reader_t rd;
+            int64_t ts;
+            price_t p;
+            price_series_seek(&rd, &s, from_s);
+            while (price_series_next(&rd, &ts, &p) && ts < to_s) {
+                samples++;
+                if (!cb(ts, p, ctx)) {
+                    more = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    xSemaphoreGive(s_flash_mux);
+    return samples;
+}
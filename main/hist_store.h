@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "price.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Per-token 1-minute closes on the "history" flash partition, kept
+ * across power cycles: an append-only log of compressed records that
+ * wraps around the partition, dropping the oldest sector.
+ *
+ * Appends only touch RAM. A low-priority task writes the buffered
+ * records every 30 minutes, so at most that much is lost on a power
+ * cut; a record torn by one is detected by its CRC at boot.
+ */
+
+#define HIST_STORE_INTERVAL_S  60
+
+/**
+ * Called for each sample of a query, oldest first. Return false to stop.
+ */
+typedef bool (*hist_store_cb_t)(int64_t ts_s, price_t p, void *ctx);
+
+/**
+ * Mount the partition, recover the write position and start the flush
+ * task. Without the partition, appends and queries do nothing.
+ */
+void hist_store_start(void);
+
+/**
+ * Buffer the close of the minute starting at ts_s.
+ */
+void hist_store_append(const char *symbol, int64_t ts_s, price_t p);
+
+/**
+ * Stream the stored samples of symbol in [from_s, to_s) to cb, reading
+ * the flash record by record. Samples still buffered in RAM are not
+ * included. Returns the number of samples passed to cb.
+ */
+int hist_store_query(const char *symbol, int64_t from_s, int64_t to_s,
+                     hist_store_cb_t cb, void *ctx);
+
+/**
+ * Write every buffered sample now.
+ */
+void hist_store_flush(void);
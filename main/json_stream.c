@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "json_stream.h"
+
+#include <string.h>
+
+enum {
+    ST_IDLE,    // between tokens
+    ST_STR,     // inside "..."
+    ST_LIT,     // number / true / false / null
+};
+
+void json_stream_init(json_stream_t *js, js_handler_t handler, void *ctx)
+{
+    memset(js, 0, sizeof(*js));
+    js->handler = handler;
+    js->ctx = ctx;
+}
+
+static inline bool top_is_obj(const json_stream_t *js)
+{
+    return js->depth > 0 && js->depth <= 32 &&
+           (js->obj_mask & (1u << (js->depth - 1)));
+}
+
+static inline void value_done(json_stream_t *js)
+{
+    if (js->depth > 0 && js->depth <= JS_MAX_DEPTH) {
+        js->index[js->depth - 1]++;
+    }
+}
+
+static void push(json_stream_t *js, bool is_obj)
+{
+    if (js->depth < JS_MAX_DEPTH) {
+        js->index[js->depth] = 0;
+    }
+    if (js->depth < 32) {
+        if (is_obj) js->obj_mask |= 1u << js->depth;
+        else        js->obj_mask &= ~(1u << js->depth);
+    }
+    js->depth++;
+    js->expect_key = is_obj;
+    js->handler(js, is_obj ? JS_EV_OBJ_BEGIN : JS_EV_ARR_BEGIN, NULL, 0);
+}
+
+static void pop(json_stream_t *js, bool is_obj)
+{
+    if (js->depth <= 0) return;   // unbalanced — ignore
+    js->handler(js, is_obj ? JS_EV_OBJ_END : JS_EV_ARR_END, NULL, 0);
+    js->depth--;
+    js->expect_key = false;
+    value_done(js);
+}
+
+static void emit_token(json_stream_t *js, bool is_key)
+{
+    js->tok[js->tok_len] = '\0';
+    js->handler(js, is_key ? JS_EV_KEY : JS_EV_VALUE, js->tok, js->tok_len);
+    if (!is_key) value_done(js);
+}
+
+static inline void append(json_stream_t *js, char c)
+{
+    if (js->tok_len < JS_TOK_MAX - 1) js->tok[js->tok_len++] = c;
+}
+
+static inline bool is_lit_char(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+           (c >= 'A' && c <= 'Z') || c == '-' || c == '+' || c == '.';
+}
+
+void json_stream_feed(json_stream_t *js, const char *data, int len)
+{
+    for (int i = 0; i < len; i++) {
+        char c = data[i];
+
+        if (js->state == ST_STR) {
+            if (js->esc) {
+                js->esc = false;
+                append(js, c);
+            } else if (c == '\\') {
+                js->esc = true;
+            } else if (c == '"') {
+                js->state = ST_IDLE;
+                emit_token(js, js->expect_key);
+            } else {
+                append(js, c);
+            }
+            continue;
+        }
+
+        if (js->state == ST_LIT) {
+            if (is_lit_char(c)) {
+                append(js, c);
+                continue;
+            }
+            js->state = ST_IDLE;
+            emit_token(js, false);
+            // fall through: c is a delimiter
+        }
+
+        switch (c) {
+        case '{': push(js, true);  break;
+        case '[': push(js, false); break;
+        case '}': pop(js, true);   break;
+        case ']': pop(js, false);  break;
+        case '"':
+            js->state = ST_STR;
+            js->tok_len = 0;
+            break;
+        case ':':
+            js->expect_key = false;
+            break;
+        case ',':
+            js->expect_key = top_is_obj(js);
+            break;
+        case ' ': case '\t': case '\r': case '\n':
+            break;
+        default:
+            js->state = ST_LIT;
+            js->tok_len = 0;
+            append(js, c);
+            break;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Minimal SAX-style JSON tokenizer.
+ * Bytes are fed as they arrive (any chunking); the handler is called for
+ * each structural event with the current nesting depth available in
+ * js->depth and the element position in js->index[js->depth - 1].
+ * No heap, no response buffer — only one scalar token is held at a time.
+ */
+
+#define JS_MAX_DEPTH  8
+#define JS_TOK_MAX    40      // longest scalar kept (longer ones are truncated)
+
+typedef enum {
+    JS_EV_OBJ_BEGIN,   // after push: depth is the new object's depth
+    JS_EV_OBJ_END,     // before pop: depth is still the object's depth
+    JS_EV_ARR_BEGIN,
+    JS_EV_ARR_END,
+    JS_EV_KEY,         // object member name
+    JS_EV_VALUE,       // string, number or literal (quotes stripped)
+} js_event_t;
+
+typedef struct json_stream json_stream_t;
+
+typedef void (*js_handler_t)(json_stream_t *js, js_event_t ev,
+                             const char *tok, int len);
+
+struct json_stream {
+    js_handler_t handler;
+    void        *ctx;                   // handler-owned state
+    int          depth;                 // number of open containers
+    uint16_t     index[JS_MAX_DEPTH];   // element index in each open container
+    uint32_t     obj_mask;              // bit d set → container at depth d+1 is an object
+    uint8_t      state;
+    bool         expect_key;
+    bool         esc;
+    int          tok_len;
+    char         tok[JS_TOK_MAX];
+};
+
+/**
+ * Reset the tokenizer and bind a handler.
+ */
+void json_stream_init(json_stream_t *js, js_handler_t handler, void *ctx);
+
+/**
+ * Feed the next chunk of the document.
+ */
+void json_stream_feed(json_stream_t *js, const char *data, int len);
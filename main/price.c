@@ -0,0 +1,258 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "price.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+static const int64_t s_pow10[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+};
+
+// Both paths are built when benchmarking, only the active one otherwise
+#if PRICE_FIXED_POINT || defined(PRICE_BENCH)
+#define HAVE_FX 1
+#endif
+#if !PRICE_FIXED_POINT || defined(PRICE_BENCH)
+#define HAVE_DBL 1
+#endif
+
+// ── Fixed-point path (int64, exponent -8) ──────────────────────────
+#ifdef HAVE_FX
+static int64_t fx_parse(const char *str)
+{
+    const char *s = str;
+    bool neg = false;
+    if (*s == '-' || *s == '+') neg = (*s++ == '-');
+
+    int64_t whole = 0;
+    while (*s >= '0' && *s <= '9') whole = whole * 10 + (*s++ - '0');
+
+    int64_t frac = 0;
+    int n = 0;
+    if (*s == '.') {
+        s++;
+        while (*s >= '0' && *s <= '9') {
+            if (n < PRICE_DECIMALS) {
+                frac = frac * 10 + (*s - '0');
+                n++;
+            } else if (n == PRICE_DECIMALS) {
+                if (*s >= '5') frac++;        // round on the first dropped digit
+                n++;
+            }
+            s++;
+        }
+    }
+    if (*s == 'e' || *s == 'E') {
+        // Exponent notation is not used by Gate.io; convert the slow way
+        return (int64_t)(strtod(str, NULL) * PRICE_SCALE);
+    }
+    if (n > PRICE_DECIMALS) n = PRICE_DECIMALS;
+
+    int64_t v = whole * PRICE_SCALE + frac * s_pow10[PRICE_DECIMALS - n];
+    return neg ? -v : v;
+}
+
+static void fx_split(int64_t p, int decimals, int64_t *whole, int32_t *frac)
+{
+    int64_t q = s_pow10[PRICE_DECIMALS - decimals];
+    int64_t r = (p + q / 2) / q;
+    *whole = r / s_pow10[decimals];
+    *frac = (int32_t)(r % s_pow10[decimals]);
+}
+
+static int32_t fx_map(int64_t p, int64_t lo, int64_t range, int32_t out_range)
+{
+    if (range <= 0) return out_range / 2;
+    return (int32_t)((p - lo) * out_range / range);
+}
+
+#endif
+
+// ── Double path ────────────────────────────────────────────────────
+#ifdef HAVE_DBL
+static double dbl_parse(const char *s)
+{
+    return atof(s);
+}
+
+#if !PRICE_FIXED_POINT
+static void dbl_split(double p, int decimals, int64_t *whole, int32_t *frac)
+{
+    int64_t r = (int64_t)(p * (double)s_pow10[decimals] + 0.5);
+    *whole = r / s_pow10[decimals];
+    *frac = (int32_t)(r % s_pow10[decimals]);
+}
+#endif
+
+static int32_t dbl_map(double p, double lo, double range, int32_t out_range)
+{
+    if (range <= 0) return out_range / 2;
+    return (int32_t)((p - lo) / range * out_range);
+}
+
+#endif
+
+// ── Public API ─────────────────────────────────────────────────────
+#if PRICE_FIXED_POINT
+
+price_t price_parse(const char *s)
+{
+    return fx_parse(s);
+}
+
+void price_split(price_t p, int decimals, int64_t *whole, int32_t *frac)
+{
+    fx_split(p, decimals, whole, frac);
+}
+
+int32_t price_map(price_t p, price_t lo, price_t range, int32_t out_range)
+{
+    return fx_map(p, lo, range, out_range);
+}
+
+int32_t price_to_units(price_t p, int32_t scale)
+{
+    return (int32_t)(p / (PRICE_SCALE / scale));
+}
+
+price_t price_from_units(int32_t v, int32_t scale)
+{
+    return (price_t)v * (PRICE_SCALE / scale);
+}
+
+#else
+
+price_t price_parse(const char *s)
+{
+    return dbl_parse(s);
+}
+
+void price_split(price_t p, int decimals, int64_t *whole, int32_t *frac)
+{
+    dbl_split(p, decimals, whole, frac);
+}
+
+int32_t price_map(price_t p, price_t lo, price_t range, int32_t out_range)
+{
+    return dbl_map(p, lo, range, out_range);
+}
+
+int32_t price_to_units(price_t p, int32_t scale)
+{
+    return (int32_t)(p * scale);
+}
+
+price_t price_from_units(int32_t v, int32_t scale)
+{
+    return (double)v / (double)scale;
+}
+
+#endif
+
+// ── Benchmark (-DPRICE_BENCH) ──────────────────────────────────────
+#ifdef PRICE_BENCH
+
+#include "esp_timer.h"
+
+#include <stdio.h>
+
+#define BENCH_ROUNDS   200
+#define BENCH_POINTS   48      // one chart rebuild (CHART_POINTS)
+#define BENCH_RANGE    10000   // CHART_INT_RANGE
+
+static const char *TAG = "price_bench";
+
+static const char *const s_quotes[] = {
+    "67012.35", "3456.789", "0.5823", "0.00001234", "142.07", "1.0001",
+};
+#define N_QUOTES (int)(sizeof(s_quotes) / sizeof(s_quotes[0]))
+
+static volatile int32_t s_sink;    // keeps results alive
+
+static int64_t ns_per_op(int64_t t0, int ops)
+{
+    return (esp_timer_get_time() - t0) * 1000 / ops;
+}
+
+void price_bench_run(void)
+{
+    int64_t fx[BENCH_POINTS];
+    double  db[BENCH_POINTS];
+    char buf[24];
+    int64_t t0;
+
+    // Parse
+    t0 = esp_timer_get_time();
+    for (int r = 0; r < BENCH_ROUNDS; r++)
+        for (int i = 0; i < BENCH_POINTS; i++) fx[i] = fx_parse(s_quotes[i % N_QUOTES]);
+    int64_t parse_fx = ns_per_op(t0, BENCH_ROUNDS * BENCH_POINTS);
+
+    t0 = esp_timer_get_time();
+    for (int r = 0; r < BENCH_ROUNDS; r++)
+        for (int i = 0; i < BENCH_POINTS; i++) db[i] = dbl_parse(s_quotes[i % N_QUOTES]);
+    int64_t parse_db = ns_per_op(t0, BENCH_ROUNDS * BENCH_POINTS);
+
+    // A realistic series: one quote with small moves
+    for (int i = 0; i < BENCH_POINTS; i++) {
+        fx[i] = fx_parse(s_quotes[0]) + (int64_t)((i * 7919) % 300 - 150) * PRICE_SCALE;
+        db[i] = (double)fx[i] / PRICE_SCALE;
+    }
+
+    // Chart rebuild: bounds, padding, map every point
+    t0 = esp_timer_get_time();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        int64_t lo = fx[0], hi = fx[0];
+        for (int i = 1; i < BENCH_POINTS; i++) {
+            if (fx[i] < lo) lo = fx[i];
+            if (fx[i] > hi) hi = fx[i];
+        }
+        int64_t pad = (hi - lo) / 4;
+        lo -= pad;
+        for (int i = 0; i < BENCH_POINTS; i++)
+            s_sink = fx_map(fx[i], lo, hi + pad - lo, BENCH_RANGE);
+    }
+    int64_t chart_fx = ns_per_op(t0, BENCH_ROUNDS);
+
+    t0 = esp_timer_get_time();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        double lo = db[0], hi = db[0];
+        for (int i = 1; i < BENCH_POINTS; i++) {
+            if (db[i] < lo) lo = db[i];
+            if (db[i] > hi) hi = db[i];
+        }
+        double pad = (hi - lo) * 0.25;
+        lo -= pad;
+        for (int i = 0; i < BENCH_POINTS; i++)
+            s_sink = dbl_map(db[i], lo, hi + pad - lo, BENCH_RANGE);
+    }
+    int64_t chart_db = ns_per_op(t0, BENCH_ROUNDS);
+
+    // Format "$67,012.35"-style: integer split vs printf("%.2f")
+    t0 = esp_timer_get_time();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        int64_t w;
+        int32_t f;
+        fx_split(fx[r % BENCH_POINTS], 2, &w, &f);
+        s_sink = snprintf(buf, sizeof(buf), "$%lld.%02ld", (long long)w, (long)f);
+    }
+    int64_t fmt_fx = ns_per_op(t0, BENCH_ROUNDS);
+
+    t0 = esp_timer_get_time();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        s_sink = snprintf(buf, sizeof(buf), "$%.2f", db[r % BENCH_POINTS]);
+    }
+    int64_t fmt_db = ns_per_op(t0, BENCH_ROUNDS);
+
+    // printf, not ESP_LOGI: the default log level (WARN) compiles INFO out
+    printf("%s: parse:         fixed %6lld ns   double %6lld ns\n", TAG, parse_fx, parse_db);
+    printf("%s: chart rebuild: fixed %6lld ns   double %6lld ns (%d points)\n",
+           TAG, chart_fx, chart_db, BENCH_POINTS);
+    printf("%s: format:        fixed %6lld ns   double %6lld ns\n", TAG, fmt_fx, fmt_db);
+    printf("%s: active path: %s\n", TAG, PRICE_FIXED_POINT ? "fixed" : "double");
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "sdkconfig.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Price representation, chosen at build time.
+ * The ESP32-C6 has no FPU, so every double operation there is a soft-float
+ * library call. On that target prices are scaled integers (int64 mantissa,
+ * fixed exponent -8) from JSON decode through chart mapping and formatting.
+ * Other targets keep double. Override with -DPRICE_FIXED_POINT=0/1.
+ */
+#ifndef PRICE_FIXED_POINT
+#if defined(CONFIG_IDF_TARGET_ESP32C6)
+#define PRICE_FIXED_POINT 1
+#else
+#define PRICE_FIXED_POINT 0
+#endif
+#endif
+
+#define PRICE_DECIMALS   8
+#define PRICE_SCALE      100000000LL          // 10^PRICE_DECIMALS
+
+#if PRICE_FIXED_POINT
+typedef int64_t price_t;                      // units of 1e-8
+#define PRICE_LIT(x)     ((price_t)((x) * PRICE_SCALE))   // constants only
+#else
+typedef double price_t;
+#define PRICE_LIT(x)     ((price_t)(x))
+#endif
+
+#define PRICE_ONE        PRICE_LIT(1)
+
+/**
+ * Parse a decimal string ("67012.3", "-1.25", "0.00001234").
+ * Digits beyond PRICE_DECIMALS are rounded.
+ */
+price_t price_parse(const char *s);
+
+/**
+ * Round a non-negative price to `decimals` places (0–8) and split it
+ * into its integer and fractional digits.
+ */
+void price_split(price_t p, int decimals, int64_t *whole, int32_t *frac);
+
+/**
+ * Map p from [lo, lo + range] onto [0, out_range].
+ */
+int32_t price_map(price_t p, price_t lo, price_t range, int32_t out_range);
+
+/**
+ * p * scale, truncated (scale is a power of ten ≤ 10^8).
+ */
+int32_t price_to_units(price_t p, int32_t scale);
+
+/**
+ * Inverse of price_to_units().
+ */
+price_t price_from_units(int32_t v, int32_t scale);
+
+#ifdef PRICE_BENCH
+/**
+ * Time parse, chart mapping and formatting on the fixed-point and the
+ * double path and log the per-call cost. Build with -DPRICE_BENCH.
+ */
+void price_bench_run(void);
+#endif
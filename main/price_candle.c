@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "price_candle.h"
+
+void candle_agg_init(candle_agg_t *a, int32_t interval_s)
+{
+    a->interval_s = interval_s;
+    a->open = false;
+}
+
+bool candle_agg_flush(candle_agg_t *a, int64_t now_s, candle_t *closed)
+{
+    if (!a->open || now_s < a->cur.start_s + a->interval_s) return false;
+    *closed = a->cur;
+    a->open = false;
+    return true;
+}
+
+void candle_merge(candle_t *into, const candle_t *c)
+{
+    if (c->high > into->high) into->high = c->high;
+    if (c->low < into->low)   into->low = c->low;
+    into->close = c->close;
+    into->ticks += c->ticks;
+}
+
+bool candle_agg_merge(candle_agg_t *a, const candle_t *part, candle_t *closed)
+{
+    int64_t start = candle_start(part->start_s, a->interval_s);
+    bool done = false;
+
+    if (a->open) {
+        if (start < a->cur.start_s) return false;   // late ticks
+        if (start == a->cur.start_s) {
+            candle_merge(&a->cur, part);
+            return false;
+        }
+        *closed = a->cur;
+        done = true;
+    }
+
+    a->cur = *part;
+    a->cur.start_s = start;
+    a->open = true;
+    return done;
+}
+
+bool candle_agg_tick(candle_agg_t *a, int64_t ts_s, price_t price, candle_t *closed)
+{
+    int64_t start = candle_start(ts_s, a->interval_s);
+    bool done = false;
+
+    if (a->open) {
+        if (start < a->cur.start_s) return false;   // late tick
+        if (start == a->cur.start_s) {
+            if (price > a->cur.high) a->cur.high = price;
+            if (price < a->cur.low)  a->cur.low = price;
+            a->cur.close = price;
+            a->cur.ticks++;
+            return false;
+        }
+        *closed = a->cur;
+        done = true;
+    }
+
+    a->cur = (candle_t){
+        .start_s = start,
+        .open = price, .high = price, .low = price, .close = price,
+        .ticks = 1,
+    };
+    a->open = true;
+    return done;
+}
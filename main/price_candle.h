@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "price.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * OHLC candle aggregation from individual ticks. Intervals are aligned
+ * to the epoch like Gate.io candles, so a candle built here covers the
+ * same span as the exchange's candle with the same start time.
+ * No ESP-IDF dependencies.
+ */
+
+typedef struct {
+    int64_t start_s;            // interval start (epoch s)
+    price_t open;
+    price_t high;
+    price_t low;
+    price_t close;
+    uint32_t ticks;             // ticks aggregated
+} candle_t;
+
+typedef struct {
+    int32_t  interval_s;
+    bool     open;              // cur holds a candle
+    candle_t cur;
+} candle_agg_t;
+
+/**
+ * Start with no open candle.
+ */
+void candle_agg_init(candle_agg_t *a, int32_t interval_s);
+
+/**
+ * Add a tick at ts_s. When it belongs to a later interval than the open
+ * candle, that candle is closed into *closed and true is returned; the
+ * tick then opens the next one. Ticks older than the open candle are
+ * ignored.
+ */
+bool candle_agg_tick(candle_agg_t *a, int64_t ts_s, price_t price, candle_t *closed);
+
+/**
+ * Add a partial candle (ticks of a shorter interval that divides this
+ * one) like candle_agg_tick() adds a tick: it closes the open candle
+ * into *closed and returns true when it belongs to a later interval.
+ */
+bool candle_agg_merge(candle_agg_t *a, const candle_t *part, candle_t *closed);
+
+/**
+ * Fold the later candle c into *into; both cover the same interval.
+ */
+void candle_merge(candle_t *into, const candle_t *c);
+
+/**
+ * Close the open candle into *closed if now_s is past its interval.
+ */
+bool candle_agg_flush(candle_agg_t *a, int64_t now_s, candle_t *closed);
+
+/**
+ * Start of the interval containing ts_s.
+ */
+static inline int64_t candle_start(int64_t ts_s, int32_t interval_s)
+{
+    int64_t r = ts_s % interval_s;
+    return ts_s - (r < 0 ? r + interval_s : r);
+}
@@ -8,82 +8,159 @@
 #include "ui_internal.h"
 #include "token_config.h"
 #include "homekit.h"
+#include "price_internal.h"
+#include "rate_limit.h"
+#include "price_candle.h"
+#include "hist_store.h"
 
 #include "esp_http_client.h"
 #include "esp_tls.h"
 #include "esp_crt_bundle.h"
 #include "esp_log.h"
-#include "cJSON.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 #include "esp_timer.h"
+#include "esp_system.h"
 
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
 
 static const char *TAG = "price_fetch";
 
-#define MAX_RESP_LEN          1024
-#define MAX_HIST_RESP_LEN     10240
 #define TICKER_TIMEOUT_MS     3000
 #define HISTORY_TIMEOUT_MS    10000
+#define BATCH_TIMEOUT_MS      10000
 #define MAX_RETRIES           2
 
+// ── Batched tickers ────────────────────────────────────────────────
+// One unfiltered /spot/tickers request replaces N per-pair requests.
+// The body is several hundred KB, so it is filtered as it streams in:
+// only the members of tracked pairs are decoded.
+#define BATCH_MIN_PAIRS       2       // fewer pairs → per-pair requests
+
 // ── Polling intervals ──────────────────────────────────────────────
 #define FOCUS_POLL_MS          10000   // focused token: 10s
 #define BG_POLL_MS             600000  // background tokens: 10min
 #define FOCUS_SWITCH_DELAY_MS  3000    // delay after switching focus
-#define LOOP_TICK_MS           2000    // main loop step: 2s
+#define CATCHUP_MIN_DUE        3       // this many overdue at once → one batch
+
+// ── Connection pool / background worker ───────────────────────────
+#define BG_QUEUE_LEN           (MAX_TOKENS + 4)
+#define HIST_RETRY_MS          30000   // rescan for unloaded charts after failures
+#define FG_IDLE_WARM_MS        30000   // focus switch after this idle → re-warm
+#define JITTER_REPORT_N        30      // log focus-refresh jitter every N polls
 
 
 // ── Price alert: surge/crash detection for focused coin ─────────────
-#define ALERT_SURGE_PCT    5.0   // +5% 24h change → surge
-#define ALERT_CRASH_PCT   -5.0   // -5% 24h change → crash
-#define ALERT_RESET_PCT    3.0   // must come back within ±3% to re-arm
+#define ALERT_SURGE_PCT    PRICE_LIT(5)    // +5% 24h change → surge
+#define ALERT_CRASH_PCT    PRICE_LIT(-5)   // -5% 24h change → crash
+#define ALERT_RESET_PCT    PRICE_LIT(3)    // must come back within ±3% to re-arm
 
+// Called from the price task, the background worker and the push
+// client: the armed flags are updated under s_alert_lock, so one
+// crossing sends one press
+static portMUX_TYPE s_alert_lock = portMUX_INITIALIZER_UNLOCKED;
 static bool s_surge_sent;
 static bool s_crash_sent;
 
-static void check_price_alert(int idx, double change_pct)
+static void check_price_alert(int idx, price_t change_pct)
 {
     if (idx != s_focus_idx) return;
 
+    bool surge = false, crash = false;
+    taskENTER_CRITICAL(&s_alert_lock);
     if (!s_surge_sent && change_pct >= ALERT_SURGE_PCT) {
-        s_surge_sent = true;
-        homekit_send_switch_press();
-        ESP_LOGW(TAG, "SURGE alert: %s %.1f%%", g_crypto[idx].symbol, change_pct);
+        s_surge_sent = surge = true;
     } else if (s_surge_sent && change_pct < ALERT_RESET_PCT) {
         s_surge_sent = false;
     }
 
     if (!s_crash_sent && change_pct <= ALERT_CRASH_PCT) {
-        s_crash_sent = true;
-        homekit_send_switch_double_press();
-        ESP_LOGW(TAG, "CRASH alert: %s %.1f%%", g_crypto[idx].symbol, change_pct);
+        s_crash_sent = crash = true;
     } else if (s_crash_sent && change_pct > -ALERT_RESET_PCT) {
         s_crash_sent = false;
     }
+    taskEXIT_CRITICAL(&s_alert_lock);
+    if (!surge && !crash) return;
+
+    char pct[16];
+    format_change(pct, sizeof(pct), change_pct);
+    if (surge) {
+        homekit_send_switch_press();
+        ESP_LOGW(TAG, "SURGE alert: %s %s", g_crypto[idx].symbol, pct);
+    }
+    if (crash) {
+        homekit_send_switch_double_press();
+        ESP_LOGW(TAG, "CRASH alert: %s %s", g_crypto[idx].symbol, pct);
+    }
 }
 
-static esp_http_client_handle_t s_client;
+// ── Streaming response sink ────────────────────────────────────────
+// Response bodies are never buffered: each HTTP_EVENT_ON_DATA chunk goes
+// straight through json_stream, whose handler decodes the fields it needs.
+typedef struct {
+    json_stream_t js;
+    int64_t  parse_us;     // time spent tokenizing this response
+    uint32_t bytes;        // response body size
+    uint32_t heap_start;   // free heap when the request started
+    uint32_t heap_min;     // lowest free heap seen while receiving
+    rl_headers_t hdr;      // rate-limit headers of this response
+    int64_t  connected_us; // HTTP_EVENT_ON_CONNECTED time, 0 = connection reused
+} resp_sink_t;
 
+// Two keep-alive connections: the foreground one only ever fetches the
+// focused token (price task); the background one serves sweeps, other
+// tokens and candlesticks (background worker). A focus fetch never waits
+// behind a batch or a candle download. Each has its own response state.
+//
+// esp_http_client gives no access to the TLS session, so an abbreviated
+// (resumed) handshake is not possible: every new connection is a full
+// handshake with bundle verification. The cheapest handshake is the one
+// that never happens — the connection is only dropped on transport
+// errors, and the handle itself is kept for the life of the task.
 typedef struct {
-    char *buf;
-    int   len;
-    int   cap;
-} resp_buf_t;
+    const char *name;
+    esp_http_client_handle_t client;
+    resp_sink_t sink;
+    ticker_ctx_t tick;     // decoded tickers of the last response
+    int64_t  last_used_ms;
+    uint32_t handshakes;   // requests that had to open a new connection
+    uint32_t reused;       // requests served on the kept-alive connection
+    int64_t  hs_us_sum;    // connect + TLS handshake time, summed
+    int64_t  hs_us_max;
+    int64_t  rl_retry_ms;  // the limiter refused the last request: retry after this
+} http_conn_t;
 
-static char s_resp_buf[MAX_RESP_LEN];
-static resp_buf_t s_resp = { .buf = s_resp_buf, .len = 0, .cap = MAX_RESP_LEN };
+static http_conn_t s_fg_conn = { .name = "foreground" };
+static http_conn_t s_bg_conn = { .name = "background" };
+
+/* Take a rate-limit token for a request on c. The limiter never waits;
+ * on refusal c->rl_retry_ms tells the caller when to come back. */
+static bool conn_acquire(http_conn_t *c, rl_endpoint_t ep)
+{
+    return rate_limit_acquire(ep, &c->rl_retry_ms);
+}
 
 static esp_err_t http_event_handler(esp_http_client_event_t *evt)
 {
-    resp_buf_t *resp = (resp_buf_t *)evt->user_data;
+    resp_sink_t *sink = (resp_sink_t *)evt->user_data;
     switch (evt->event_id) {
+    case HTTP_EVENT_ON_CONNECTED:
+        sink->connected_us = esp_timer_get_time();
+        break;
+    case HTTP_EVENT_ON_HEADER:
+        rate_limit_note_header(&sink->hdr, evt->header_key, evt->header_value);
+        break;
     case HTTP_EVENT_ON_DATA:
-        if (resp->len + evt->data_len < resp->cap - 1) {
-            memcpy(resp->buf + resp->len, evt->data, evt->data_len);
-            resp->len += evt->data_len;
+        if (esp_http_client_get_status_code(evt->client) == 200) {
+            int64_t t0 = esp_timer_get_time();
+            json_stream_feed(&sink->js, (const char *)evt->data, evt->data_len);
+            sink->bytes += evt->data_len;
+            sink->parse_us += esp_timer_get_time() - t0;
+            uint32_t heap = esp_get_free_heap_size();
+            if (heap < sink->heap_min) sink->heap_min = heap;
         }
         break;
     default:
@@ -92,74 +169,180 @@ static esp_err_t http_event_handler(esp_http_client_event_t *evt)
     return ESP_OK;
 }
 
-static bool parse_ticker(int idx, const char *pair, const char *json)
+static void sink_begin(http_conn_t *c, js_handler_t handler, void *ctx)
 {
-    cJSON *root = cJSON_Parse(json);
-    if (!root) return false;
+    json_stream_init(&c->sink.js, handler, ctx);
+    c->sink.parse_us = 0;
+    c->sink.bytes = 0;
+    c->sink.heap_start = esp_get_free_heap_size();
+    c->sink.heap_min = c->sink.heap_start;
+    rate_limit_headers_clear(&c->sink.hdr);
+}
 
-    bool ok = false;
-    cJSON *item = cJSON_IsArray(root) ? cJSON_GetArrayItem(root, 0) : root;
-
-    if (item) {
-        cJSON *j_last = cJSON_GetObjectItem(item, "last");
-        cJSON *j_chg  = cJSON_GetObjectItem(item, "change_percentage");
-        cJSON *j_high = cJSON_GetObjectItem(item, "high_24h");
-        cJSON *j_low  = cJSON_GetObjectItem(item, "low_24h");
-
-        const char *s_last = j_last ? cJSON_GetStringValue(j_last) : NULL;
-        const char *s_chg  = j_chg  ? cJSON_GetStringValue(j_chg)  : NULL;
-        const char *s_high = j_high ? cJSON_GetStringValue(j_high) : NULL;
-        const char *s_low  = j_low  ? cJSON_GetStringValue(j_low)  : NULL;
-
-        if (s_last && s_chg) {
-            double chg = atof(s_chg);
-            ui_update_price(idx, atof(s_last), chg,
-                            s_high ? atof(s_high) : 0, s_low ? atof(s_low) : 0);
-            check_price_alert(idx, chg);
-            ok = true;
+static void sink_report(const http_conn_t *c, const char *what)
+{
+    ESP_LOGI(TAG, "%s: %lu B parsed in %lld us, peak heap +%lu B", what,
+             (unsigned long)c->sink.bytes, c->sink.parse_us,
+             (unsigned long)(c->sink.heap_start - c->sink.heap_min));
+}
+
+// ── Ticker decoding ────────────────────────────────────────────────
+// Handles the single-pair and the unfiltered /spot/tickers response as
+// well as WebSocket pushes: flat ticker objects at ctx->obj_depth, each
+// decoded member by member as it streams.
+enum { TK_OTHER, TK_PAIR, TK_LAST, TK_CHG, TK_HIGH, TK_LOW };
+
+#define TF_LAST  (1 << TK_LAST)
+#define TF_CHG   (1 << TK_CHG)
+
+static int find_pair(const char *pair)
+{
+    for (int i = 0; i < g_active_count; i++) {
+        if (g_crypto[i].pair && strcmp(g_crypto[i].pair, pair) == 0) return i;
+    }
+    return -1;
+}
+
+static int ticker_key(const char *k)
+{
+    if (strcmp(k, "currency_pair") == 0)     return TK_PAIR;
+    if (strcmp(k, "last") == 0)              return TK_LAST;
+    if (strcmp(k, "change_percentage") == 0) return TK_CHG;
+    if (strcmp(k, "high_24h") == 0)          return TK_HIGH;
+    if (strcmp(k, "low_24h") == 0)           return TK_LOW;
+    return TK_OTHER;
+}
+
+void ticker_handler(json_stream_t *js, js_event_t ev, const char *tok, int len)
+{
+    (void)len;
+    ticker_ctx_t *t = (ticker_ctx_t *)js->ctx;
+    if (js->depth != t->obj_depth) return;
+
+    switch (ev) {
+    case JS_EV_OBJ_BEGIN:
+        t->idx = -1;
+        t->pair_seen = false;
+        t->fields = 0;
+        t->key = TK_OTHER;
+        memset(&t->cur, 0, sizeof(t->cur));
+        break;
+
+    case JS_EV_KEY:
+        t->key = ticker_key(tok);
+        break;
+
+    case JS_EV_VALUE:
+        if (t->key == TK_PAIR) {
+            t->idx = find_pair(tok);
+            t->pair_seen = true;
+        } else if (t->key != TK_OTHER && (t->idx >= 0 || !t->pair_seen)) {
+            // Untracked pairs are skipped once their name is known
+            price_t v = price_parse(tok);
+            switch (t->key) {
+            case TK_LAST: t->cur.last       = v; break;
+            case TK_CHG:  t->cur.change_pct = v; break;
+            case TK_HIGH: t->cur.high_24h   = v; break;
+            case TK_LOW:  t->cur.low_24h    = v; break;
+            }
+            t->fields |= 1 << t->key;
         }
+        t->key = TK_OTHER;
+        break;
+
+    case JS_EV_OBJ_END:
+        if (t->idx >= 0 && (t->fields & (TF_LAST | TF_CHG)) == (TF_LAST | TF_CHG)) {
+            t->quote[t->idx] = t->cur;
+            t->found |= 1u << t->idx;
+        }
+        break;
+
+    default:
+        break;
     }
-    cJSON_Delete(root);
-    return ok;
 }
 
-static bool ensure_client(int timeout_ms)
+void ticker_ctx_begin(ticker_ctx_t *t, int obj_depth)
+{
+    memset(t, 0, sizeof(*t));
+    t->obj_depth = obj_depth;
+    t->idx = -1;
+}
+
+static void ticker_begin(http_conn_t *c)
+{
+    ticker_ctx_begin(&c->tick, 2);    // [ {ticker}, ... ]
+    sink_begin(c, ticker_handler, &c->tick);
+}
+
+void apply_ticker(int idx, const ticker_t *t)
 {
-    if (s_client) {
-        esp_http_client_set_timeout_ms(s_client, timeout_ms);
+    ui_update_price(idx, t->last, t->change_pct, t->high_24h, t->low_24h);
+    check_price_alert(idx, t->change_pct);
+}
+
+static bool ensure_client(http_conn_t *c, int timeout_ms)
+{
+    if (c->client) {
+        esp_http_client_set_timeout_ms(c->client, timeout_ms);
         return true;
     }
     esp_http_client_config_t cfg = {
         .url = "https://api.gateio.ws/api/v4/spot/tickers",
         .event_handler = http_event_handler,
-        .user_data = &s_resp,
+        .user_data = &c->sink,
         .crt_bundle_attach = esp_crt_bundle_attach,
         .timeout_ms = timeout_ms,
         .keep_alive_enable = true,
     };
-    s_client = esp_http_client_init(&cfg);
-    if (!s_client) {
+    c->client = esp_http_client_init(&cfg);
+    if (!c->client) {
         ESP_LOGE(TAG, "Failed to init HTTP client");
         return false;
     }
     return true;
 }
 
-static void reset_client(void)
+/* Drop a broken connection; the handle stays and reconnects on the
+ * next request. */
+static void reset_client(http_conn_t *c)
+{
+    if (c->client) esp_http_client_close(c->client);
+}
+
+/* Perform the prepared request, report its outcome to the limiter and
+ * account for the connection it used. */
+static esp_err_t perform(http_conn_t *c, rl_endpoint_t ep, int *status)
 {
-    if (s_client) {
-        esp_http_client_close(s_client);
-        esp_http_client_cleanup(s_client);
-        s_client = NULL;
+    c->sink.connected_us = 0;
+    int64_t t0 = esp_timer_get_time();
+    esp_err_t err = esp_http_client_perform(c->client);
+    *status = esp_http_client_get_status_code(c->client);
+    c->last_used_ms = esp_timer_get_time() / 1000;
+    rate_limit_on_response(ep, err == ESP_OK ? *status : 0, &c->sink.hdr);
+
+    if (c->sink.connected_us) {
+        int64_t hs = c->sink.connected_us - t0;
+        c->handshakes++;
+        c->hs_us_sum += hs;
+        if (hs > c->hs_us_max) c->hs_us_max = hs;
+        ESP_LOGI(TAG, "%s: new connection, handshake %lld ms "
+                 "(avg %lld, max %lld; %lu new / %lu reused)",
+                 c->name, hs / 1000, c->hs_us_sum / c->handshakes / 1000,
+                 c->hs_us_max / 1000, (unsigned long)c->handshakes,
+                 (unsigned long)c->reused);
+    } else if (err == ESP_OK) {
+        c->reused++;
     }
+    return err;
 }
 
-static bool fetch_ticker(int idx)
+static bool fetch_ticker(http_conn_t *c, int idx)
 {
     const char *pair = g_crypto[idx].pair;
     if (!pair) {
         // Stablecoin with no trading pair — report $1.00
-        ui_update_price(idx, 1.0, 0.0, 1.0, 1.0);
+        ui_update_price(idx, PRICE_ONE, 0, PRICE_ONE, PRICE_ONE);
         return true;
     }
 
@@ -167,93 +350,436 @@ static bool fetch_ticker(int idx)
     snprintf(url, sizeof(url), "https://api.gateio.ws/api/v4/spot/tickers?currency_pair=%s", pair);
 
     for (int retry = 0; retry <= MAX_RETRIES; retry++) {
-        if (!ensure_client(TICKER_TIMEOUT_MS)) return false;
-        esp_http_client_set_url(s_client, url);
-        s_resp.len = 0;
+        if (!conn_acquire(c, RL_EP_TICKER)) return false;
+        if (!ensure_client(c, TICKER_TIMEOUT_MS)) {
+            rate_limit_cancel(RL_EP_TICKER);
+            return false;
+        }
+        esp_http_client_set_url(c->client, url);
+        ticker_begin(c);
 
-        esp_err_t err = esp_http_client_perform(s_client);
-        int status = esp_http_client_get_status_code(s_client);
+        int status;
+        esp_err_t err = perform(c, RL_EP_TICKER, &status);
 
         if (err == ESP_OK && status == 200) {
-            s_resp.buf[s_resp.len] = '\0';
-            return parse_ticker(idx, pair, s_resp.buf);
+            sink_report(c, pair);
+            if (!(c->tick.found & (1u << idx))) return false;
+            apply_ticker(idx, &c->tick.quote[idx]);
+            return true;
         }
 
-        if (status == 429) {
-            ESP_LOGW(TAG, "Rate limited (429), backoff...");
-            vTaskDelay(pdMS_TO_TICKS(5000));
-        } else {
-            ESP_LOGW(TAG, "Fetch %s failed (err=%d, status=%d), retry %d", pair, err, status, retry);
-            reset_client();
-            vTaskDelay(pdMS_TO_TICKS(1000));
-        }
+        // 429: the limiter now holds every request until Retry-After
+        if (status == 429) return false;
+
+        ESP_LOGW(TAG, "Fetch %s failed (err=%d, status=%d), retry %d", pair, err, status, retry);
+        if (err != ESP_OK) reset_client(c);
+        vTaskDelay(pdMS_TO_TICKS(1000));
     }
     return false;
 }
 
+/* Fetch every active ticker in one request.
+ * Returns true if all tracked pairs were found; pairs missing from a
+ * successful response fall back to fetch_ticker(). */
+static bool fetch_all_tickers(void)
+{
+    int64_t t0 = esp_timer_get_time();
+    uint32_t want = 0;
+    bool ok = false;
+
+    for (int i = 0; i < g_active_count; i++) {
+        if (g_crypto[i].pair) want |= 1u << i;
+    }
+
+    for (int retry = 0; retry <= MAX_RETRIES; retry++) {
+        if (!conn_acquire(&s_bg_conn, RL_EP_BATCH)) break;
+        if (!ensure_client(&s_bg_conn, BATCH_TIMEOUT_MS)) {
+            rate_limit_cancel(RL_EP_BATCH);
+            break;
+        }
+        esp_http_client_set_url(s_bg_conn.client, "https://api.gateio.ws/api/v4/spot/tickers");
+
+        ticker_begin(&s_bg_conn);
+        int status;
+        esp_err_t err = perform(&s_bg_conn, RL_EP_BATCH, &status);
+
+        if (err == ESP_OK && status == 200) {
+            sink_report(&s_bg_conn, "Batch");
+            ok = true;
+            break;
+        }
+
+        if (status == 429) break;
+
+        ESP_LOGW(TAG, "Batch fetch failed (err=%d, status=%d), retry %d", err, status, retry);
+        if (err != ESP_OK) reset_client(&s_bg_conn);
+        vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+
+    // Apply the whole batch before any fallback: fetch_ticker() reuses
+    // s_bg_conn and clears its parsed quotes
+    uint32_t found = ok ? s_bg_conn.tick.found : 0;
+    for (int i = 0; i < g_active_count; i++) {
+        if (!g_crypto[i].pair) {
+            ui_update_price(i, PRICE_ONE, 0, PRICE_ONE, PRICE_ONE);
+        } else if (found & (1u << i)) {
+            apply_ticker(i, &s_bg_conn.tick.quote[i]);
+        }
+    }
+    for (int i = 0; ok && i < g_active_count; i++) {
+        if (g_crypto[i].pair && !(found & (1u << i))) {
+            fetch_ticker(&s_bg_conn, i);   // delisted/renamed pair — ask for it directly
+        }
+    }
+
+    ESP_LOGI(TAG, "Batch tickers: %d/%d pairs in %lld ms",
+             __builtin_popcount(found), __builtin_popcount(want),
+             (esp_timer_get_time() - t0) / 1000);
+    return found == want;
+}
+
+/* Refresh every active token, batched when there are enough pairs. */
+static void fetch_all(void)
+{
+    int pairs = 0;
+    for (int i = 0; i < g_active_count; i++) {
+        if (g_crypto[i].pair) pairs++;
+    }
+
+    if (pairs >= BATCH_MIN_PAIRS) {
+        fetch_all_tickers();
+    } else {
+        for (int i = 0; i < g_active_count; i++) fetch_ticker(&s_bg_conn, i);
+    }
+}
+
 // ── Focus-aware polling state ──────────────────────────────────────
+// The fetch times are written by the price task, the background worker
+// and the push client, the focus switch time by the UI; an int64 store
+// is two word stores on the C6, so all go through s_fetch_lock
+static portMUX_TYPE s_fetch_lock = portMUX_INITIALIZER_UNLOCKED;
 static int64_t s_last_fetch_ms[MAX_TOKENS];      // per-token last fetch time
 static volatile int s_pending_focus = -1;         // pending focus idx (-1=none)
-static volatile int64_t s_focus_change_ms = 0;    // timestamp of last focus switch
+static int64_t s_focus_change_ms = 0;             // timestamp of last focus switch
+static int64_t s_retry_ms[MAX_TOKENS];            // refused by the limiter: due again, 0 = none
+
+static int64_t fetch_ms_get(int idx)
+{
+    taskENTER_CRITICAL(&s_fetch_lock);
+    int64_t ms = s_last_fetch_ms[idx];
+    taskEXIT_CRITICAL(&s_fetch_lock);
+    return ms;
+}
+
+/* Set idx's fetch time, or every token's with idx -1. */
+static void fetch_ms_set(int idx, int64_t ms)
+{
+    taskENTER_CRITICAL(&s_fetch_lock);
+    for (int i = 0; i < g_active_count; i++) {
+        if (idx < 0 || i == idx) s_last_fetch_ms[i] = ms;
+    }
+    taskEXIT_CRITICAL(&s_fetch_lock);
+}
+
+static int64_t focus_change_ms(void)
+{
+    taskENTER_CRITICAL(&s_fetch_lock);
+    int64_t ms = s_focus_change_ms;
+    taskEXIT_CRITICAL(&s_fetch_lock);
+    return ms;
+}
+
+void price_fetch_note_push(int idx)
+{
+    if (idx >= 0 && idx < g_active_count) {
+        fetch_ms_set(idx, esp_timer_get_time() / 1000);
+    }
+}
+
+// ── Focus-refresh jitter: actual vs FOCUS_POLL_MS between focus polls ──
+static struct {
+    int      idx;          // token the previous poll was for
+    int64_t  last_ms;
+    uint32_t n;
+    int64_t  sum_abs_ms;
+    int64_t  max_abs_ms;
+} s_jitter = { .idx = -1 };
+
+static void record_focus_poll(int idx, int64_t now)
+{
+    if (idx == s_jitter.idx) {
+        int64_t dev = (now - s_jitter.last_ms) - FOCUS_POLL_MS;
+        if (dev < 0) dev = -dev;
+        s_jitter.sum_abs_ms += dev;
+        if (dev > s_jitter.max_abs_ms) s_jitter.max_abs_ms = dev;
+        if (++s_jitter.n >= JITTER_REPORT_N) {
+            ESP_LOGI(TAG, "Focus refresh jitter over %lu polls: avg %lld ms, max %lld ms",
+                     (unsigned long)s_jitter.n, s_jitter.sum_abs_ms / s_jitter.n,
+                     s_jitter.max_abs_ms);
+            s_jitter.n = 0;
+            s_jitter.sum_abs_ms = 0;
+            s_jitter.max_abs_ms = 0;
+        }
+    }
+    s_jitter.idx = idx;
+    s_jitter.last_ms = now;
+}
+
+// ── Background worker ──────────────────────────────────────────────
+// Owns the background connection. The price task hands it background
+// tickers and catch-up sweeps; price_fetch_prioritize_chart() hands it
+// charts and the UI hands it timeframe downloads. A periodic rescan
+// picks up charts that failed or were dropped.
+typedef enum { JOB_CHART, JOB_TICKER, JOB_SWEEP, JOB_TF } bg_job_kind_t;
+
+typedef struct {
+    uint8_t kind;          // bg_job_kind_t
+    int8_t  idx;           // token, -1 for JOB_SWEEP
+    uint8_t tf;            // chart_tf_t for JOB_TF
+} bg_job_t;
 
-// ── Background chart history loading ────────────────────────────────
 static volatile int s_chart_priority = -1;      // user-requested coin, or -1
 static bool s_chart_loaded[MAX_TOKENS];          // per-coin loaded flag
+static QueueHandle_t s_bg_queue;
+
+static void bg_submit_job(bg_job_t job, bool front)
+{
+    if (!s_bg_queue) return;
+    BaseType_t ok = front ? xQueueSendToFront(s_bg_queue, &job, 0)
+                          : xQueueSend(s_bg_queue, &job, 0);
+    if (ok != pdTRUE) ESP_LOGW(TAG, "Background queue full, job %d dropped", job.kind);
+}
+
+static void bg_submit(bg_job_kind_t kind, int idx, bool front)
+{
+    bg_submit_job((bg_job_t){ .kind = kind, .idx = idx }, front);
+}
+
+// ── Candlestick decoding ───────────────────────────────────────────
+// [[t, quote_vol, close, high, low, open, base_vol, closed], ...]
+#define CANDLE_TS_IDX    0
+#define CANDLE_CLOSE_IDX 2
+
+typedef struct {
+    int    count;
+    int64_t first_ts, last_ts;       // start times of the first/last candle
+    price_t close[TF_MAX_CANDLES];
+} candle_ctx_t;
 
-// Static buffers for chart history — reused across calls, avoids heap fragmentation
-static char   s_hist_buf[MAX_HIST_RESP_LEN];
-static double s_hist_prices[CHART_POINTS];
+static candle_ctx_t s_candles;
+
+static void candle_handler(json_stream_t *js, js_event_t ev, const char *tok, int len)
+{
+    (void)len;
+    candle_ctx_t *c = (candle_ctx_t *)js->ctx;
+    if (js->depth != 2 || c->count >= TF_MAX_CANDLES) return;
+
+    switch (ev) {
+    case JS_EV_ARR_BEGIN:
+        c->close[c->count] = 0;
+        break;
+    case JS_EV_VALUE:
+        if (js->index[1] == CANDLE_TS_IDX) {
+            c->last_ts = strtoll(tok, NULL, 10);
+            if (c->count == 0) c->first_ts = c->last_ts;
+        } else if (js->index[1] == CANDLE_CLOSE_IDX) {
+            c->close[c->count] = price_parse(tok);
+        }
+        break;
+    case JS_EV_ARR_END:
+        c->count++;
+        break;
+    default:
+        break;
+    }
+}
+
+// ── Incremental history ────────────────────────────────────────────
+// Charts hold closed candles only: fetched from Gate or built from ticks
+// by the UI's candle aggregator. A chart that already holds some (earlier
+// load or warm-boot snapshot) only asks for the candles after its newest
+// one; a full reload is left for gaps longer than the chart.
+
+// Copy of the history being backfilled (background worker only)
+static price_hist_t s_hist;
+static int64_t s_hist_ts;
+
+/* First candle start to request for idx, 0 = full reload. Takes the
+ * copy of idx's history that merge_backfill() uses. */
+static int64_t backfill_from(int idx, int64_t now_s)
+{
+    s_hist_ts = crypto_get_hist(idx, &s_hist);
+    if (s_hist_ts <= 0 || s_hist.count == 0) return 0;
+    if (now_s < s_hist_ts) return 0;   // clock not synced yet
+    if (now_s - s_hist_ts >= (int64_t)(CHART_POINTS - 1) * CANDLE_INTERVAL_S) return 0;
+    return s_hist_ts + CANDLE_INTERVAL_S;
+}
+
+/* Whether idx's chart misses a closed candle: none stored, newest one
+ * more than a bucket behind, or no synced clock to tell. */
+static bool chart_behind(int idx, int64_t now_s)
+{
+    int64_t ts = crypto_get_candle_ts(idx);
+    return ts <= 0 || now_s < ts || now_s >= ts + 2 * CANDLE_INTERVAL_S;
+}
+
+/* Stored candles older than the first fetched one, followed by the
+ * fetched ones (newest CHART_POINTS). Returns the number written. */
+static int merge_backfill(price_t *out)
+{
+    int candles = s_hist.count;
+    int fetched = s_candles.count < CHART_POINTS ? s_candles.count : CHART_POINTS;
+    int keep = candles;
+    if (s_candles.first_ts <= s_hist_ts) {
+        keep -= (int)((s_hist_ts - s_candles.first_ts) / CANDLE_INTERVAL_S) + 1;
+    }
+    if (keep > CHART_POINTS - fetched) keep = CHART_POINTS - fetched;
+    if (keep < 0) keep = 0;
+
+    int n = 0;
+    for (int i = candles - keep; i < candles; i++) out[n++] = price_hist_at(&s_hist, i);
+    for (int i = s_candles.count - fetched; i < s_candles.count; i++) out[n++] = s_candles.close[i];
+    return n;
+}
+
+/* GET a candlestick URL into s_candles, with one retry. */
+static bool fetch_candles(const char *pair, const char *url)
+{
+    for (int retry = 0; retry <= 1; retry++) {
+        if (!conn_acquire(&s_bg_conn, RL_EP_CANDLES)) return false;
+        if (!ensure_client(&s_bg_conn, HISTORY_TIMEOUT_MS)) {
+            rate_limit_cancel(RL_EP_CANDLES);
+            return false;
+        }
+        esp_http_client_set_url(s_bg_conn.client, url);
+        s_candles.count = 0;
+        sink_begin(&s_bg_conn, candle_handler, &s_candles);
+
+        int status;
+        esp_err_t err = perform(&s_bg_conn, RL_EP_CANDLES, &status);
+
+        if (err == ESP_OK && status == 200) {
+            sink_report(&s_bg_conn, pair);
+            return true;
+        }
+        if (status == 429) return false;
+
+        ESP_LOGW(TAG, "History %s failed (err=%d, status=%d), retry %d",
+                 pair, err, status, retry);
+        if (err != ESP_OK) reset_client(&s_bg_conn);
+        vTaskDelay(pdMS_TO_TICKS(500));
+    }
+    return false;
+}
 
 static bool fetch_one_history(int idx)
 {
     const char *pair = g_crypto[idx].pair;
     if (!pair) return true;  // stablecoin, no chart needed
 
-    resp_buf_t saved = s_resp;
-    s_resp = (resp_buf_t){ .buf = s_hist_buf, .len = 0, .cap = MAX_HIST_RESP_LEN };
+    int64_t now_s = time(NULL);
+    int64_t from = backfill_from(idx, now_s);
+    if (from && now_s < from + CANDLE_INTERVAL_S) return true;   // no closed candle missing
 
-    bool ok = false;
-    for (int retry = 0; retry <= 1; retry++) {
-        if (!ensure_client(HISTORY_TIMEOUT_MS)) break;
-        char url[160];
+    char url[192];
+    if (from) {
+        // Gate rejects limit together with from/to
+        snprintf(url, sizeof(url),
+                 "https://api.gateio.ws/api/v4/spot/candlesticks?"
+                 "currency_pair=%s&interval=30m&from=%lld&to=%lld",
+                 pair, (long long)from, (long long)now_s);
+    } else {
         snprintf(url, sizeof(url),
                  "https://api.gateio.ws/api/v4/spot/candlesticks?"
                  "currency_pair=%s&interval=30m&limit=%d",
                  pair, CHART_POINTS);
-        esp_http_client_set_url(s_client, url);
-        s_resp.len = 0;
+    }
+    if (!fetch_candles(pair, url)) return false;
 
-        esp_err_t err = esp_http_client_perform(s_client);
-        int status = esp_http_client_get_status_code(s_client);
+    // The newest candle is still open; the aggregator closes it
+    if (s_candles.count > 0 && s_candles.last_ts + CANDLE_INTERVAL_S > now_s) {
+        s_candles.count--;
+        s_candles.last_ts -= CANDLE_INTERVAL_S;
+    }
+    // Nothing closed since the newest candle: the chart is current
+    if (s_candles.count == 0) return from != 0;
 
-        if (err == ESP_OK && status == 200) {
-            s_resp.buf[s_resp.len] = '\0';
-            cJSON *root = cJSON_Parse(s_resp.buf);
-            if (root && cJSON_IsArray(root)) {
-                int n = cJSON_GetArraySize(root);
-                if (n > CHART_POINTS) n = CHART_POINTS;
-                for (int j = 0; j < n; j++) {
-                    cJSON *candle = cJSON_GetArrayItem(root, j);
-                    if (!candle) continue;
-                    cJSON *close = cJSON_GetArrayItem(candle, 2);
-                    const char *s_close = close ? cJSON_GetStringValue(close) : NULL;
-                    s_hist_prices[j] = s_close ? atof(s_close) : 0;
-                }
-                ui_set_chart_history(idx, s_hist_prices, n);
-                ok = true;
-            }
-            cJSON_Delete(root);
-            if (ok) break;
-        } else {
-            ESP_LOGW(TAG, "History %s failed (err=%d, status=%d), retry %d",
-                     pair, err, status, retry);
-            reset_client();
-            vTaskDelay(pdMS_TO_TICKS(500));
-        }
+    price_t merged[CHART_POINTS];
+    const price_t *closes = s_candles.close;
+    int n = s_candles.count;
+    if (from) {
+        n = merge_backfill(merged);
+        closes = merged;
+        ESP_LOGI(TAG, "History %s: %d new candles merged", pair, s_candles.count);
     }
+    ui_set_chart_history(idx, closes, n, s_candles.last_ts);
+    return true;
+}
+
+// Stored minutes bucketed into a timeframe's candles (last close wins)
+typedef struct {
+    int64_t  from_s;
+    int32_t  interval_s;
+    int      n;
+    price_t *close;                 // 0 = no sample in the bucket yet
+} tf_buckets_t;
 
-    s_resp = saved;
-    return ok;
+static bool bucket_sample(int64_t ts_s, price_t p, void *ctx)
+{
+    tf_buckets_t *b = ctx;
+    int i = (int)((ts_s - b->from_s) / b->interval_s);
+    if (i >= 0 && i < b->n) b->close[i] = p;
+    return true;
+}
+
+/* Build tf's candles from the flash history when it covers nearly the
+ * whole span, saving the download. */
+static bool tf_from_store(int idx, int tf)
+{
+    const chart_tf_info_t *info = &g_chart_tf[tf];
+    time_t now;
+    time(&now);
+
+    int64_t to = candle_start(now, info->interval_s);
+    tf_buckets_t b = {
+        .from_s = to - (int64_t)info->candles * info->interval_s,
+        .interval_s = info->interval_s,
+        .n = info->candles,
+        .close = s_candles.close,
+    };
+    memset(b.close, 0, b.n * sizeof(b.close[0]));
+    hist_store_query(g_crypto[idx].symbol, b.from_s, to, bucket_sample, &b);
+
+    // Skip leading empty buckets, carry the last close over inner gaps
+    int first = 0, filled = 0;
+    while (first < b.n && b.close[first] == 0) first++;
+    for (int i = first; i < b.n; i++) {
+        if (b.close[i] != 0) filled++;
+        else b.close[i] = b.close[i - 1];
+    }
+    if (filled < b.n * 9 / 10) return false;
+
+    ESP_LOGI(TAG, "%s chart for idx=%d from flash history (%d/%d candles)",
+             info->label, idx, filled, b.n);
+    ui_set_tf_history(idx, tf, &b.close[first], b.n - first);
+    return true;
+}
+
+/* Download a whole timeframe for the UI to decimate and cache. */
+static void fetch_tf_history(int idx, int tf)
+{
+    const char *pair = g_crypto[idx].pair;
+    if (!pair || tf <= TF_1D || tf >= TF_COUNT) return;
+    if (tf_from_store(idx, tf)) return;
+
+    char url[160];
+    snprintf(url, sizeof(url),
+             "https://api.gateio.ws/api/v4/spot/candlesticks?"
+             "currency_pair=%s&interval=%s&limit=%d",
+             pair, g_chart_tf[tf].interval, g_chart_tf[tf].candles);
+    if (fetch_candles(pair, url) && s_candles.count > 0) {
+        ui_set_tf_history(idx, tf, s_candles.close, s_candles.count);
+    }
 }
 
 /* Pick next coin whose chart is not yet loaded.
@@ -269,53 +795,302 @@ static int pick_next_chart(void)
     return -1;  // all loaded
 }
 
+// ── Deadline scheduler ─────────────────────────────────────────────
+// Min-heap of per-token next-due times, owned by the price task. The
+// task sleeps until the earliest deadline or a notification; pushes only
+// bump s_last_fetch_ms and are noticed when the deadline comes up.
+typedef struct {
+    int64_t due_ms;
+    int     idx;
+} sched_ent_t;
+
+static sched_ent_t s_heap[MAX_TOKENS];
+static int s_heap_n;
+static int s_heap_pos[MAX_TOKENS];               // token → heap slot
+static TaskHandle_t s_price_task;
+static int s_debounce_idx = -1;                  // focus token awaiting its switch fetch
+
+static void heap_swap(int a, int b)
+{
+    sched_ent_t t = s_heap[a];
+    s_heap[a] = s_heap[b];
+    s_heap[b] = t;
+    s_heap_pos[s_heap[a].idx] = a;
+    s_heap_pos[s_heap[b].idx] = b;
+}
+
+static void heap_down(int i)
+{
+    while (1) {
+        int l = 2 * i + 1, r = l + 1, m = i;
+        if (l < s_heap_n && s_heap[l].due_ms < s_heap[m].due_ms) m = l;
+        if (r < s_heap_n && s_heap[r].due_ms < s_heap[m].due_ms) m = r;
+        if (m == i) break;
+        heap_swap(i, m);
+        i = m;
+    }
+}
+
+static void heap_up(int i)
+{
+    while (i > 0 && s_heap[(i - 1) / 2].due_ms > s_heap[i].due_ms) {
+        heap_swap(i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+/* Set a token's deadline (every active token is always in the heap). */
+static void sched_set(int idx, int64_t due_ms)
+{
+    int i = s_heap_pos[idx];
+    int64_t was = s_heap[i].due_ms;
+    s_heap[i].due_ms = due_ms;
+    if (due_ms < was) heap_up(i);
+    else              heap_down(i);
+}
+
+/* Re-arm the tokens whose background fetch the limiter refused. */
+static void sched_take_retries(void)
+{
+    for (int i = 0; i < s_heap_n; i++) {
+        taskENTER_CRITICAL(&s_fetch_lock);
+        int64_t due = s_retry_ms[i];
+        s_retry_ms[i] = 0;
+        taskEXIT_CRITICAL(&s_fetch_lock);
+        if (due) sched_set(i, due);
+    }
+}
+
+static inline int64_t poll_period(int idx)
+{
+    return idx == s_focus_idx ? FOCUS_POLL_MS : BG_POLL_MS;
+}
+
+/* Reschedule everything from a common fetch time: the focused token one
+ * focus period out, background tokens spread evenly over BG_POLL_MS so
+ * their polls do not bunch up. */
+static void sched_spread(int64_t now)
+{
+    int focus = s_focus_idx;
+    int nbg = g_active_count - 1;
+    int k = 0;
+
+    s_heap_n = 0;
+    for (int i = 0; i < g_active_count; i++) {
+        int64_t due = (i == focus)
+                    ? now + FOCUS_POLL_MS
+                    : now + (int64_t)BG_POLL_MS * ++k / (nbg > 0 ? nbg : 1);
+        s_heap[s_heap_n] = (sched_ent_t){ .due_ms = due, .idx = i };
+        s_heap_pos[i] = s_heap_n++;
+    }
+    for (int i = s_heap_n / 2; i >= 0; i--) heap_down(i);
+}
+
+/* Open a connection ahead of need with the cheapest endpoint, so the
+ * next real request skips the handshake. */
+static void warm_up(http_conn_t *c)
+{
+    if (!conn_acquire(c, RL_EP_TICKER)) return;
+    if (!ensure_client(c, TICKER_TIMEOUT_MS)) {
+        rate_limit_cancel(RL_EP_TICKER);
+        return;
+    }
+    esp_http_client_set_url(c->client, "https://api.gateio.ws/api/v4/spot/time");
+    ticker_begin(c);                  // nothing to decode, response is ignored
+    int status;
+    if (perform(c, RL_EP_TICKER, &status) != ESP_OK) reset_client(c);
+}
+
+static int count_due(int64_t now)
+{
+    int n = 0;
+    for (int i = 0; i < s_heap_n; i++) {
+        if (s_heap[i].due_ms <= now) n++;
+    }
+    return n;
+}
+
 static void price_fetch_task(void *arg)
 {
     (void)arg;
 
-    while (1) {
-        int64_t now = esp_timer_get_time() / 1000;
+    if (s_fg_conn.handshakes == 0) warm_up(&s_fg_conn);
 
-        // 1. Check pending focus switch (3s delay expired & still current focus)
+    while (1) {
+        // 1. Focus switch: the new token is due after the debounce
         int pf = s_pending_focus;
         if (pf >= 0) {
-            if (pf != s_focus_idx) {
-                s_pending_focus = -1;   // switched away, cancel
-            } else if (now - s_focus_change_ms >= FOCUS_SWITCH_DELAY_MS) {
-                fetch_ticker(pf);
-                s_last_fetch_ms[pf] = now;
-                s_pending_focus = -1;
-                ESP_LOGI(TAG, "Focus switch fetch: %s", g_crypto[pf].symbol);
+            s_pending_focus = -1;
+            if (pf == s_focus_idx && pf < g_active_count) {
+                s_debounce_idx = pf;
+                sched_set(pf, focus_change_ms() + FOCUS_SWITCH_DELAY_MS);
+                // Use the debounce window to reopen an idle connection
+                int64_t t = esp_timer_get_time() / 1000;
+                if (t - s_fg_conn.last_used_ms > FG_IDLE_WARM_MS) warm_up(&s_fg_conn);
             }
         }
+        sched_take_retries();
 
-        // 2. Load one pending chart per cycle
-        int ci = pick_next_chart();
-        if (ci >= 0) {
-            if (fetch_one_history(ci)) {
-                s_chart_loaded[ci] = true;
-                ESP_LOGI(TAG, "Chart loaded: %s", g_crypto[ci].symbol);
-            }
+        // 2. Sleep until the earliest deadline or a notification
+        int64_t now = esp_timer_get_time() / 1000;
+        if (s_heap_n == 0) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        if (s_heap[0].due_ms > now) {
+            int64_t wait = s_heap[0].due_ms - now;
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait) + 1);
+            continue;
+        }
+
+        // 3. Many tokens due together (boot, WiFi/socket outage): one batch
+        if (count_due(now) >= CATCHUP_MIN_DUE) {
+            bg_submit(JOB_SWEEP, -1, false);
+            s_debounce_idx = -1;
+            sched_spread(now);
+            continue;
+        }
+
+        // 4. Earliest token: fetch unless a push refreshed it meanwhile
+        int idx = s_heap[0].idx;
+        int64_t fetched = fetch_ms_get(idx);
+        int64_t fresh_until = fetched + poll_period(idx);
+        bool debounced = (idx == s_debounce_idx && idx == s_focus_idx);
+        if (debounced) s_debounce_idx = -1;
+
+        if (debounced ? fetched >= focus_change_ms()
+                      : fresh_until > now) {
+            sched_set(idx, fresh_until);   // pushed meanwhile — still fresh
+            continue;
         }
 
-        // 3. Focused token: poll every FOCUS_POLL_MS
-        int focus = s_focus_idx;
-        if (now - s_last_fetch_ms[focus] >= FOCUS_POLL_MS) {
-            fetch_ticker(focus);
-            s_last_fetch_ms[focus] = now;
+        // Other tokens go to the background connection
+        if (idx != s_focus_idx) {
+            bg_submit(JOB_TICKER, idx, false);
+            sched_set(idx, now + BG_POLL_MS);
+            continue;
         }
 
-        // 4. Background tokens: poll every BG_POLL_MS, max 1 per loop
-        for (int i = 0; i < g_active_count; i++) {
-            if (i == focus) continue;
-            if (now - s_last_fetch_ms[i] >= BG_POLL_MS) {
-                fetch_ticker(i);
-                s_last_fetch_ms[i] = now;
-                break;   // only 1 background token per loop
+        record_focus_poll(idx, now);
+        s_fg_conn.rl_retry_ms = 0;
+        bool ok = fetch_ticker(&s_fg_conn, idx);
+        now = esp_timer_get_time() / 1000;
+        int64_t next = poll_period(idx);
+        if (ok) {
+            fetch_ms_set(idx, now);
+        } else if (s_fg_conn.rl_retry_ms) {
+            next = s_fg_conn.rl_retry_ms;      // refused: retry when a token is due
+        } else {
+            // Failed, or throttled since: not before the limiter allows it
+            int64_t hold = rate_limit_delay_ms(RL_EP_TICKER);
+            if (hold > next) next = hold;
+        }
+        sched_set(idx, now + next);
+        if (debounced) ESP_LOGI(TAG, "Focus switch fetch: %s", g_crypto[idx].symbol);
+    }
+}
+
+static bool load_chart(int idx)
+{
+    if (idx < 0 || idx >= g_active_count || s_chart_loaded[idx]) return true;
+    if (!fetch_one_history(idx)) return false;
+    s_chart_loaded[idx] = true;
+    ESP_LOGI(TAG, "Chart loaded: %s", g_crypto[idx].symbol);
+    return true;
+}
+
+/* Hand a ticker the limiter refused back to the price task, which owns
+ * the deadlines: idx (every token with -1) is due again in retry_ms. */
+static void sched_hand_back(int idx, int64_t retry_ms)
+{
+    int64_t due = esp_timer_get_time() / 1000 + retry_ms;
+    taskENTER_CRITICAL(&s_fetch_lock);
+    for (int i = 0; i < g_active_count; i++) {
+        if (idx < 0 || i == idx) s_retry_ms[i] = due;
+    }
+    taskEXIT_CRITICAL(&s_fetch_lock);
+    if (s_price_task) xTaskNotifyGive(s_price_task);
+}
+
+static void bg_task(void *arg)
+{
+    (void)arg;
+    TickType_t wait = 0;
+    bg_job_t tf_retry = { .idx = -1 };   // timeframe download the limiter refused
+    int64_t tf_retry_ms = 0;
+
+    if (s_bg_conn.handshakes == 0) warm_up(&s_bg_conn);
+
+    while (1) {
+        bg_job_t job;
+        TickType_t t = wait;
+        int64_t now = esp_timer_get_time() / 1000;
+        if (tf_retry.idx >= 0) {
+            TickType_t left = tf_retry_ms > now ? pdMS_TO_TICKS(tf_retry_ms - now) + 1 : 0;
+            if (left < t) t = left;
+        }
+        if (xQueueReceive(s_bg_queue, &job, t) != pdTRUE) {
+            int idx = pick_next_chart();
+            if (tf_retry.idx >= 0 && esp_timer_get_time() / 1000 >= tf_retry_ms) {
+                job = tf_retry;
+            } else if (idx < 0) {
+                wait = portMAX_DELAY;   // all loaded — sleep until asked
+                continue;
+            } else {
+                job = (bg_job_t){ .kind = JOB_CHART, .idx = idx };
             }
         }
 
-        vTaskDelay(pdMS_TO_TICKS(LOOP_TICK_MS));
+        s_bg_conn.rl_retry_ms = 0;
+        switch (job.kind) {
+        case JOB_SWEEP: {
+            fetch_all();
+            if (s_bg_conn.rl_retry_ms) {
+                // Refused: every token comes due again and the price task
+                // sends a new sweep
+                sched_hand_back(-1, s_bg_conn.rl_retry_ms);
+                break;
+            }
+            fetch_ms_set(-1, esp_timer_get_time() / 1000);
+            // Boot or back from an outage: top up the charts that missed
+            // a candle (cheap, see backfill_from()); a short outage within
+            // one bucket costs no candle request at all
+            int64_t now_s = time(NULL);
+            for (int i = 0; i < g_active_count; i++) {
+                if (chart_behind(i, now_s)) s_chart_loaded[i] = false;
+            }
+            wait = 0;
+            break;
+        }
+        case JOB_TICKER:
+            if (job.idx >= 0 && job.idx < g_active_count) {
+                fetch_ticker(&s_bg_conn, job.idx);
+                if (s_bg_conn.rl_retry_ms) sched_hand_back(job.idx, s_bg_conn.rl_retry_ms);
+                else fetch_ms_set(job.idx, esp_timer_get_time() / 1000);
+            }
+            break;
+        case JOB_TF:
+            tf_retry.idx = -1;
+            if (job.idx >= 0 && job.idx < g_active_count) {
+                fetch_tf_history(job.idx, job.tf);
+                if (s_bg_conn.rl_retry_ms) {
+                    // Only the latest refused timeframe is kept: it is the one on screen
+                    tf_retry = job;
+                    tf_retry_ms = esp_timer_get_time() / 1000 + s_bg_conn.rl_retry_ms;
+                }
+            }
+            break;
+        case JOB_CHART:
+            if (load_chart(job.idx)) {
+                wait = 0;
+            } else if (s_bg_conn.rl_retry_ms) {
+                wait = pdMS_TO_TICKS(s_bg_conn.rl_retry_ms) + 1;   // refused: next token
+            } else {
+                int64_t hold = rate_limit_delay_ms(RL_EP_CANDLES);
+                wait = pdMS_TO_TICKS(hold > HIST_RETRY_MS ? hold : HIST_RETRY_MS);
+            }
+            break;
+        }
     }
 }
 
@@ -323,23 +1098,46 @@ void price_fetch_prioritize_chart(int idx)
 {
     if (idx >= 0 && idx < g_active_count) {
         s_chart_priority = idx;
+        // Front of the queue; if it is full, the rescan still gets there
+        if (!s_chart_loaded[idx]) bg_submit(JOB_CHART, idx, true);
+    }
+}
+
+void price_fetch_reload_chart(int idx)
+{
+    if (idx >= 0 && idx < g_active_count) {
+        s_chart_loaded[idx] = false;
+        bg_submit(JOB_CHART, idx, false);
+    }
+}
+
+void price_fetch_timeframe(int idx, int tf)
+{
+    if (idx >= 0 && idx < g_active_count) {
+        // Front of the queue: the user is looking at an empty chart
+        bg_submit_job((bg_job_t){ .kind = JOB_TF, .idx = idx, .tf = tf }, true);
     }
 }
 
 void price_fetch_on_focus_change(int new_idx)
 {
+    int64_t now = esp_timer_get_time() / 1000;
+    taskENTER_CRITICAL(&s_fetch_lock);
+    s_focus_change_ms = now;
+    taskEXIT_CRITICAL(&s_fetch_lock);
     s_pending_focus = new_idx;
-    s_focus_change_ms = esp_timer_get_time() / 1000;
+    if (s_price_task) xTaskNotifyGive(s_price_task);
 }
 
 void price_fetch_first(void)
 {
     /* Fetch all current prices */
-    for (int i = 0; i < g_active_count; i++) fetch_ticker(i);
+    fetch_all();
 
-    /* Record fetch time so background task doesn't re-fetch immediately */
+    /* Record fetch time and spread the first deadlines */
     int64_t now = esp_timer_get_time() / 1000;
-    for (int i = 0; i < g_active_count; i++) s_last_fetch_ms[i] = now;
+    fetch_ms_set(-1, now);
+    sched_spread(now);
 
     /* Pre-load charts for first 2 tokens so UI enters with chart ready */
     for (int i = 0; i < 2 && i < g_active_count; i++) {
@@ -352,5 +1150,21 @@ void price_fetch_first(void)
 
 void price_fetch_start(void)
 {
-    xTaskCreate(price_fetch_task, "price", 6144, NULL, 4, NULL);
+    s_bg_queue = xQueueCreate(BG_QUEUE_LEN, sizeof(bg_job_t));
+
+    // No boot fetch (warm boot from a snapshot, or WiFi was down): refresh
+    // every token first, ahead of any chart download
+    if (s_heap_n == 0) {
+        bg_submit(JOB_SWEEP, -1, false);
+        sched_spread(esp_timer_get_time() / 1000);
+    }
+
+    int prio = s_chart_priority;
+    if (prio >= 0) bg_submit(JOB_CHART, prio, false);
+    xTaskCreate(price_fetch_task, "price", 6144, NULL, 4, &s_price_task);
+    xTaskCreate(bg_task, "price_bg", 6144, NULL, 3, NULL);
+
+    // Push feed on top of polling: every pushed tick postpones that
+    // token's next REST poll, so REST only runs when the socket is down.
+    price_ws_start();
 }
@@ -7,7 +7,8 @@
 
 /**
  * Start the background task that fetches live crypto prices
- * from the Gate.io API every 10 seconds.
+ * from the Gate.io API every 10 seconds, plus the WebSocket push
+ * feed that postpones polls while it delivers ticks.
  * Call after WiFi is connected.
  */
 /**
@@ -21,6 +22,18 @@
  */
 void price_fetch_prioritize_chart(int idx);
 
+/**
+ * idx's chart is missing candles (no ticks for whole intervals):
+ * backfill it from Gate.io in the background.
+ */
+void price_fetch_reload_chart(int idx);
+
+/**
+ * Download the candles of chart timeframe tf (chart_tf_t) for idx in
+ * the background; the result goes to ui_set_tf_history().
+ */
+void price_fetch_timeframe(int idx, int tf);
+
 /**
  * Notify price_fetch that the focused token changed.
  * After a 3s delay, the new token will be fetched immediately.
@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "price_hist.h"
+
+#include <string.h>
+
+static inline int dq_pos(const hist_deque_t *q, int i)
+{
+    int p = q->head + i;
+    return p >= PRICE_HIST_LEN ? p - PRICE_HIST_LEN : p;
+}
+
+static inline uint8_t dq_back(const hist_deque_t *q)
+{
+    return q->slot[dq_pos(q, q->len - 1)];
+}
+
+static inline void dq_pop_front(hist_deque_t *q)
+{
+    q->head = (uint8_t)dq_pos(q, 1);
+    q->len--;
+}
+
+static inline void dq_push_back(hist_deque_t *q, uint8_t slot)
+{
+    q->slot[dq_pos(q, q->len)] = slot;
+    q->len++;
+}
+
+void price_hist_reset(price_hist_t *h)
+{
+    memset(h, 0, sizeof(*h));
+}
+
+void price_hist_push(price_hist_t *h, price_t v)
+{
+    uint8_t slot = h->next;
+
+    // The value about to be overwritten leaves the window
+    if (h->count == PRICE_HIST_LEN) {
+        if (h->min_q.len && h->min_q.slot[h->min_q.head] == slot) dq_pop_front(&h->min_q);
+        if (h->max_q.len && h->max_q.slot[h->max_q.head] == slot) dq_pop_front(&h->max_q);
+    } else {
+        h->count++;
+    }
+
+    h->v[slot] = v;
+    h->next = (slot + 1 == PRICE_HIST_LEN) ? 0 : slot + 1;
+
+    // Older values that can never be the extreme again are dropped
+    while (h->min_q.len && h->v[dq_back(&h->min_q)] >= v) h->min_q.len--;
+    dq_push_back(&h->min_q, slot);
+    while (h->max_q.len && h->v[dq_back(&h->max_q)] <= v) h->max_q.len--;
+    dq_push_back(&h->max_q, slot);
+}
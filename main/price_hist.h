@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "price.h"
+
+#include <stdint.h>
+
+/*
+ * Fixed-size price history: a ring buffer with O(1) append and a
+ * sliding-window min/max kept by two monotonic deques of ring slots.
+ */
+
+#define PRICE_HIST_LEN  48
+
+typedef struct {
+    uint8_t slot[PRICE_HIST_LEN];   // ring slots, values monotonic front → back
+    uint8_t head;                   // front position in slot[]
+    uint8_t len;
+} hist_deque_t;
+
+typedef struct {
+    price_t      v[PRICE_HIST_LEN];
+    uint8_t      next;              // slot the next value goes to
+    uint8_t      count;             // valid values (≤ PRICE_HIST_LEN)
+    hist_deque_t min_q;             // increasing: front is the window minimum
+    hist_deque_t max_q;             // decreasing: front is the window maximum
+} price_hist_t;
+
+/**
+ * Empty the history.
+ */
+void price_hist_reset(price_hist_t *h);
+
+/**
+ * Append a value, dropping the oldest once full. Amortized O(1).
+ */
+void price_hist_push(price_hist_t *h, price_t v);
+
+/**
+ * i-th value in chronological order (0 = oldest, count-1 = newest).
+ */
+static inline price_t price_hist_at(const price_hist_t *h, int i)
+{
+    int slot = h->next - h->count + i;
+    if (slot < 0) slot += PRICE_HIST_LEN;
+    return h->v[slot];
+}
+
+/**
+ * Window minimum / maximum. Only valid when count > 0.
+ */
+static inline price_t price_hist_min(const price_hist_t *h)
+{
+    return h->v[h->min_q.slot[h->min_q.head]];
+}
+
+static inline price_t price_hist_max(const price_hist_t *h)
+{
+    return h->v[h->max_q.slot[h->max_q.head]];
+}
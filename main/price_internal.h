@@ -0,0 +1,43 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "json_stream.h"
+#include "token_config.h"
+#include "price.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ── Decoded ticker (shared by REST polling and the WebSocket feed) ──
+typedef struct {
+    price_t last;
+    price_t change_pct;
+    price_t high_24h;
+    price_t low_24h;
+} ticker_t;
+
+typedef struct {
+    int       obj_depth;          // nesting depth of ticker objects
+    int       key;                // member being read
+    int       idx;                // g_crypto index of current object, -1 = untracked
+    bool      pair_seen;
+    uint8_t   fields;             // members decoded so far in current object
+    ticker_t  cur;
+    uint32_t  found;              // bit i set → quote[i] is complete
+    ticker_t  quote[MAX_TOKENS];
+} ticker_ctx_t;
+
+// ── price_fetch.c ──────────────────────────────────────────────────
+void ticker_ctx_begin(ticker_ctx_t *t, int obj_depth);
+void ticker_handler(json_stream_t *js, js_event_t ev, const char *tok, int len);
+void apply_ticker(int idx, const ticker_t *t);
+
+/* A pushed update arrived for idx — postpones its next REST poll. */
+void price_fetch_note_push(int idx);
+
+// ── price_ws.c ─────────────────────────────────────────────────────
+void price_ws_start(void);
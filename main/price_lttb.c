@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "price_lttb.h"
+
+#include <string.h>
+
+/* First input index of bucket b; buckets split in[1..n-1). */
+static inline int bucket_start(int b, int n, int buckets)
+{
+    return 1 + (int)((int64_t)b * (n - 2) / buckets);
+}
+
+int price_lttb(const price_t *in, int n, price_t *out, int out_n)
+{
+    if (n <= out_n || out_n < 3) {
+        if (n > out_n) n = out_n;
+        memcpy(out, in, n * sizeof(*in));
+        return n;
+    }
+
+    int buckets = out_n - 2;
+    int a = 0;                        // point picked from the previous bucket
+    out[0] = in[0];
+
+    for (int b = 0; b < buckets; b++) {
+        int lo = bucket_start(b, n, buckets);
+        int hi = bucket_start(b + 1, n, buckets);
+
+        // Next bucket's centroid, kept as sums: scaling every area in
+        // this bucket by the same count does not change the winner
+        int nlo = hi;
+        int nhi = (b + 1 < buckets) ? bucket_start(b + 2, n, buckets) : n;
+        int cnt = nhi - nlo;
+        int64_t cx = 0;
+        price_t cy = 0;
+        for (int i = nlo; i < nhi; i++) {
+            cx += i;
+            cy += in[i];
+        }
+
+        int best = lo;
+        price_t best_area = -1;
+        for (int i = lo; i < hi; i++) {
+            price_t area = (price_t)((int64_t)a * cnt - cx) * (in[i] - in[a]) -
+                           (price_t)(a - i) * (cy - in[a] * cnt);
+            if (area < 0) area = -area;
+            if (area > best_area) {
+                best_area = area;
+                best = i;
+            }
+        }
+        out[b + 1] = in[best];
+        a = best;
+    }
+
+    out[out_n - 1] = in[n - 1];
+    return out_n;
+}
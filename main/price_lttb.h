@@ -0,0 +1,21 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "price.h"
+
+/*
+ * Largest-Triangle-Three-Buckets downsampling of an evenly spaced
+ * series: keeps the first and last points and, from each bucket in
+ * between, the point spanning the largest triangle with its neighbours.
+ * Peaks and troughs survive; cost is O(n).
+ */
+
+/**
+ * Downsample in[0..n) to at most out_n points (out_n ≥ 3) in out[].
+ * Series that already fit are copied. Returns the number written.
+ */
+int price_lttb(const price_t *in, int n, price_t *out, int out_n);
@@ -0,0 +1,287 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "price_series.h"
+
+#include <math.h>
+#include <string.h>
+
+#define SIG_LIMIT  10000000LL           // quantized values keep 7 digits
+
+// ── Price units ────────────────────────────────────────────────────
+static int64_t to_units(price_t p)
+{
+#if PRICE_FIXED_POINT
+    return p;
+#else
+    return llround(p * PRICE_SCALE);
+#endif
+}
+
+static price_t from_units(int64_t u)
+{
+#if PRICE_FIXED_POINT
+    return u;
+#else
+    return (double)u / PRICE_SCALE;
+#endif
+}
+
+/* Largest power of ten that leaves 7 significant digits of u. */
+static int64_t pick_quantum(int64_t u)
+{
+    if (u < 0) u = -u;
+    int64_t q = 1;
+    while (u / q >= SIG_LIMIT) q *= 10;
+    return q;
+}
+
+static int64_t quantize(int64_t u, int64_t q)
+{
+    return (u >= 0 ? u + q / 2 : u - q / 2) / q;
+}
+
+// ── Zigzag varint ──────────────────────────────────────────────────
+static uint64_t zigzag(int64_t v)
+{
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static int64_t unzigzag(uint64_t z)
+{
+    return (int64_t)(z >> 1) ^ -(int64_t)(z & 1);
+}
+
+static int varint_len(uint64_t z)
+{
+    int n = 1;
+    while (z >= 0x80) {
+        z >>= 7;
+        n++;
+    }
+    return n;
+}
+
+static void varint_put(uint8_t *p, uint64_t z)
+{
+    while (z >= 0x80) {
+        *p++ = (uint8_t)z | 0x80;
+        z >>= 7;
+    }
+    *p = (uint8_t)z;
+}
+
+static uint64_t varint_get(const uint8_t *data, uint16_t *pos)
+{
+    uint64_t z = 0;
+    int shift = 0;
+    uint8_t b;
+    do {
+        b = data[(*pos)++];
+        z |= (uint64_t)(b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    return z;
+}
+
+// ── Series ─────────────────────────────────────────────────────────
+static series_chunk_t *chunk_at(const price_series_t *s, int i)
+{
+    return &s->chunk[(s->first + i) % s->nchunks];
+}
+
+void price_series_init(price_series_t *s, series_chunk_t *chunks, int nchunks,
+                       int32_t interval_s)
+{
+    s->chunk = chunks;
+    s->nchunks = (uint8_t)nchunks;
+    s->interval_s = interval_s;
+    price_series_reset(s);
+}
+
+void price_series_reset(price_series_t *s)
+{
+    s->first = 0;
+    s->len = 0;
+    s->quantum = 0;
+    s->last = 0;
+    s->next_s = 0;
+}
+
+/* Open a chunk after the newest, dropping the oldest when all are used. */
+static series_chunk_t *chunk_open(price_series_t *s, int64_t ts_s, int64_t q)
+{
+    if (s->len == s->nchunks) {
+        s->first = (s->first + 1) % s->nchunks;
+        s->len--;
+    }
+    series_chunk_t *c = chunk_at(s, s->len++);
+    c->start_s = ts_s;
+    c->base = q;
+    c->count = 0;
+    c->used = 0;
+    return c;
+}
+
+bool price_series_append(price_series_t *s, int64_t ts_s, price_t p)
+{
+    if (!s->nchunks) return false;
+    if (s->len && ts_s < s->next_s) return false;
+
+    int64_t u = to_units(p);
+    if (!s->quantum) s->quantum = pick_quantum(u);
+    int64_t q = quantize(u, s->quantum);
+
+    series_chunk_t *c = s->len ? chunk_at(s, s->len - 1) : NULL;
+    uint64_t z = zigzag(q - s->last);
+    int n = varint_len(z);
+    if (!c || ts_s != s->next_s || c->used + n > SERIES_CHUNK_DATA || c->count == UINT16_MAX) {
+        c = chunk_open(s, ts_s, q);
+        z = 0;                          // first delta is against base
+        n = 1;
+    }
+
+    varint_put(&c->data[c->used], z);
+    c->used += n;
+    c->count++;
+    s->last = q;
+    s->next_s = ts_s + s->interval_s;
+    return true;
+}
+
+int price_series_count(const price_series_t *s)
+{
+    int n = 0;
+    for (int i = 0; i < s->len; i++) n += chunk_at(s, i)->count;
+    return n;
+}
+
+size_t price_series_bytes(const price_series_t *s)
+{
+    size_t n = 0;
+    for (int i = 0; i < s->len; i++) {
+        n += offsetof(series_chunk_t, data) + chunk_at(s, i)->used;
+    }
+    return n;
+}
+
+// ── Reader ─────────────────────────────────────────────────────────
+// A reader is invalidated by the next append.
+
+void price_series_seek(series_reader_t *r, const price_series_t *s, int64_t from_s)
+{
+    r->s = s;
+    r->c = 0;
+    r->i = 0;
+    r->pos = 0;
+
+    // Whole chunks that end before from_s
+    while (r->c < s->len) {
+        const series_chunk_t *ch = chunk_at(s, r->c);
+        if (ch->start_s + (int64_t)ch->count * s->interval_s > from_s) break;
+        r->c++;
+    }
+    if (r->c == s->len) return;
+
+    const series_chunk_t *ch = chunk_at(s, r->c);
+    r->v = ch->base;
+    int64_t skip = (from_s - ch->start_s + s->interval_s - 1) / s->interval_s;
+    for (; r->i < skip; r->i++) r->v += unzigzag(varint_get(ch->data, &r->pos));
+}
+
+bool price_series_next(series_reader_t *r, int64_t *ts_s, price_t *p)
+{
+    const price_series_t *s = r->s;
+    while (r->c < s->len) {
+        const series_chunk_t *ch = chunk_at(s, r->c);
+        if (r->i < ch->count) {
+            r->v += unzigzag(varint_get(ch->data, &r->pos));
+            *ts_s = ch->start_s + (int64_t)r->i * s->interval_s;
+            *p = from_units(r->v * s->quantum);
+            r->i++;
+            return true;
+        }
+        r->c++;
+        r->i = 0;
+        r->pos = 0;
+        if (r->c < s->len) r->v = chunk_at(s, r->c)->base;
+    }
+    return false;
+}
+
+// ── Benchmark (-DPRICE_BENCH) ──────────────────────────────────────
+#ifdef PRICE_BENCH
+
+#include "esp_timer.h"
+
+#include <stdio.h>
+
+#define BENCH_SAMPLES  1440            // one day of 1-minute closes
+#define BENCH_CHUNKS   24
+
+static const char *TAG = "series_bench";
+
+static series_chunk_t s_bench_chunks[BENCH_CHUNKS];
+static price_t s_bench_raw[BENCH_SAMPLES];
+static volatile int64_t s_sink;
+
+/* Random walk with steps of up to ±0.1% (a busy minute). */
+static void bench_walk(price_t start)
+{
+    uint32_t seed = 12345;
+    int64_t u = to_units(start);
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int32_t permille = (int32_t)((seed >> 16) % 2001) - 1000;   // ±1000 → ±0.1%
+        u += u / 1000 * permille / 1000;
+        s_bench_raw[i] = from_units(u);
+    }
+}
+
+void price_series_bench_run(void)
+{
+    static const struct { const char *name; price_t start; } cases[] = {
+        { "BTC", PRICE_LIT(67012.35) },
+        { "ADA", PRICE_LIT(0.5823) },
+        { "PEPE", PRICE_LIT(0.00001234) },
+    };
+
+    price_series_t s;
+    price_series_init(&s, s_bench_chunks, BENCH_CHUNKS, 60);
+
+    for (size_t k = 0; k < sizeof(cases) / sizeof(cases[0]); k++) {
+        bench_walk(cases[k].start);
+        price_series_reset(&s);
+
+        int64_t t0 = esp_timer_get_time();
+        for (int i = 0; i < BENCH_SAMPLES; i++) price_series_append(&s, (int64_t)i * 60, s_bench_raw[i]);
+        int64_t enc_ns = (esp_timer_get_time() - t0) * 1000 / BENCH_SAMPLES;
+
+        series_reader_t r;
+        int64_t ts;
+        price_t p, acc = 0;
+        t0 = esp_timer_get_time();
+        price_series_seek(&r, &s, 0);
+        while (price_series_next(&r, &ts, &p)) acc += p;
+        int64_t dec_ns = (esp_timer_get_time() - t0) * 1000 / BENCH_SAMPLES;
+        s_sink = (int64_t)acc;
+
+        acc = 0;
+        t0 = esp_timer_get_time();
+        for (int i = 0; i < BENCH_SAMPLES; i++) acc += s_bench_raw[i];
+        int64_t raw_ns = (esp_timer_get_time() - t0) * 1000 / BENCH_SAMPLES;
+        s_sink = (int64_t)acc;
+
+        size_t bytes = price_series_bytes(&s);
+        int n = price_series_count(&s);
+        printf("%s: %-4s %d samples: %u B (%d.%02d B/sample, raw %u B)\n",
+               TAG, cases[k].name, n, (unsigned)bytes, (int)(bytes / n),
+               (int)(bytes * 100 / n % 100), (unsigned)(BENCH_SAMPLES * sizeof(price_t)));
+        printf("%s:      encode %lld ns, decode %lld ns, array read %lld ns per sample\n",
+               TAG, enc_ns, dec_ns, raw_ns);
+    }
+}
+
+#endif
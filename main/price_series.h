@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "price.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Compressed price series at a fixed interval, for history far longer
+ * than the 48-point chart ring.
+ *
+ * Samples are rounded to 7 significant digits (the quantum is picked
+ * from the first sample: 0.01 for 67012.35, 1e-10 for 0.00001234) and
+ * stored as zigzag varint deltas, so a typical 1-minute move takes one
+ * or two bytes instead of eight. Timestamps are implicit: a chunk holds
+ * consecutive intervals from its start time, and a gap starts a new
+ * chunk. Chunks live in caller storage and form a ring — when all are
+ * used the oldest is dropped. No ESP-IDF dependencies.
+ */
+
+#define SERIES_CHUNK_DATA  232
+
+typedef struct {
+    int64_t  start_s;               // time of the first sample
+    int64_t  base;                  // quantized value before the first delta
+    uint16_t count;                 // samples
+    uint16_t used;                  // bytes of data[] in use
+    uint8_t  data[SERIES_CHUNK_DATA];
+} series_chunk_t;                   // 256 bytes
+
+typedef struct {
+    series_chunk_t *chunk;          // caller storage
+    uint8_t  nchunks;
+    uint8_t  first;                 // oldest chunk
+    uint8_t  len;                   // chunks in use
+    int32_t  interval_s;
+    int64_t  quantum;               // price units (1e-8) per step, 0 = empty
+    int64_t  last;                  // newest sample, quantized
+    int64_t  next_s;                // time that continues the newest chunk
+} price_series_t;
+
+typedef struct {
+    const price_series_t *s;
+    int      c;                     // chunks read (0 … len)
+    int      i;                     // samples read in the current chunk
+    uint16_t pos;
+    int64_t  v;
+} series_reader_t;
+
+/**
+ * Use nchunks (≤ 255) chunks of storage; the series starts empty.
+ */
+void price_series_init(price_series_t *s, series_chunk_t *chunks, int nchunks,
+                       int32_t interval_s);
+
+/**
+ * Drop every sample.
+ */
+void price_series_reset(price_series_t *s);
+
+/**
+ * Append the sample of the interval starting at ts_s. Samples at or
+ * before the newest are ignored (returns false).
+ */
+bool price_series_append(price_series_t *s, int64_t ts_s, price_t p);
+
+/**
+ * Samples held.
+ */
+int price_series_count(const price_series_t *s);
+
+/**
+ * Storage in use, chunk headers included.
+ */
+size_t price_series_bytes(const price_series_t *s);
+
+/**
+ * Position a reader at the first sample at or after from_s.
+ */
+void price_series_seek(series_reader_t *r, const price_series_t *s, int64_t from_s);
+
+/**
+ * Decode the next sample; false at the end.
+ */
+bool price_series_next(series_reader_t *r, int64_t *ts_s, price_t *p);
+
+#ifdef PRICE_BENCH
+/**
+ * Encode a day of 1-minute samples, log bytes per sample and decode
+ * cost against a plain price_t array. Build with -DPRICE_BENCH.
+ */
+void price_series_bench_run(void);
+#endif
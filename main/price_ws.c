@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "price_internal.h"
+#include "ui_internal.h"
+
+#include "esp_websocket_client.h"
+#include "esp_crt_bundle.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <time.h>
+
+static const char *TAG = "price_ws";
+
+// Gate.io v4 push feed. Override at build time via -DPRICE_WS_URI=...,
+// e.g. with the ws:// URI of tools/ws_replay.py replaying a capture
+#ifndef PRICE_WS_URI
+#define PRICE_WS_URI          "wss://api.gateio.ws/ws/v4/"
+#endif
+#define WS_RECONNECT_MS       10000
+#define WS_LATENCY_REPORT_N   100      // log latency stats every N ticks
+
+static esp_websocket_client_handle_t s_ws;
+
+// ── Frame decoding ─────────────────────────────────────────────────
+// {"time":..,"time_ms":..,"channel":"spot.tickers","event":"update",
+//  "result":{"currency_pair":"BTC_USDT","last":"..",...}}
+// Top-level members are read here; the result object is handed to the
+// shared ticker decoder.
+typedef struct {
+    json_stream_t js;
+    ticker_ctx_t  tick;
+    int           key;        // WK_* of the top-level member being read
+    bool          is_update;
+    int64_t       time_ms;    // server send time
+} ws_frame_t;
+
+enum { WK_OTHER, WK_EVENT, WK_TIME_MS };
+
+static ws_frame_t s_frame;
+
+// Tick latency (server time_ms → decoded here), reset every report
+static struct {
+    uint32_t n;
+    int64_t  sum_ms;
+    int64_t  min_ms;
+    int64_t  max_ms;
+} s_lat;
+
+static void record_latency(int64_t server_ms)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    if (tv.tv_sec < 1700000000) return;   // clock not synced yet
+    int64_t lat = (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000 - server_ms;
+
+    if (s_lat.n == 0 || lat < s_lat.min_ms) s_lat.min_ms = lat;
+    if (s_lat.n == 0 || lat > s_lat.max_ms) s_lat.max_ms = lat;
+    s_lat.sum_ms += lat;
+    if (++s_lat.n >= WS_LATENCY_REPORT_N) {
+        ESP_LOGI(TAG, "Tick latency over %lu ticks: avg %lld ms, min %lld, max %lld",
+                 (unsigned long)s_lat.n, s_lat.sum_ms / s_lat.n,
+                 s_lat.min_ms, s_lat.max_ms);
+        memset(&s_lat, 0, sizeof(s_lat));
+    }
+}
+
+static void frame_handler(json_stream_t *js, js_event_t ev, const char *tok, int len)
+{
+    ws_frame_t *f = (ws_frame_t *)js->ctx;
+
+    if (js->depth == 1) {
+        switch (ev) {
+        case JS_EV_KEY:
+            f->key = strcmp(tok, "event") == 0   ? WK_EVENT
+                   : strcmp(tok, "time_ms") == 0 ? WK_TIME_MS
+                   : WK_OTHER;
+            return;
+        case JS_EV_VALUE:
+            if (f->key == WK_EVENT)   f->is_update = (strcmp(tok, "update") == 0);
+            if (f->key == WK_TIME_MS) f->time_ms = strtoll(tok, NULL, 10);
+            f->key = WK_OTHER;
+            return;
+        case JS_EV_OBJ_END:
+            if (!f->is_update || !f->tick.found) return;
+            for (int i = 0; i < g_active_count; i++) {
+                if (f->tick.found & (1u << i)) {
+                    apply_ticker(i, &f->tick.quote[i]);
+                    price_fetch_note_push(i);
+                }
+            }
+            if (f->time_ms > 0) record_latency(f->time_ms);
+            return;
+        default:
+            return;
+        }
+    }
+
+    // Ticker fields live in "result" (depth 2)
+    f->key = WK_OTHER;
+    ticker_handler(&f->js, ev, tok, len);
+}
+
+static void frame_begin(void)
+{
+    ticker_ctx_begin(&s_frame.tick, 2);
+    json_stream_init(&s_frame.js, frame_handler, &s_frame);
+    s_frame.key = WK_OTHER;
+    s_frame.is_update = false;
+    s_frame.time_ms = 0;
+}
+
+// ── Subscription ───────────────────────────────────────────────────
+static void subscribe_all(void)
+{
+    char msg[256];
+    time_t now;
+    time(&now);
+    int n = snprintf(msg, sizeof(msg),
+                     "{\"time\":%lld,\"channel\":\"spot.tickers\","
+                     "\"event\":\"subscribe\",\"payload\":[", (long long)now);
+    bool first = true;
+    for (int i = 0; i < g_active_count && n < (int)sizeof(msg); i++) {
+        if (!g_crypto[i].pair) continue;
+        n += snprintf(msg + n, sizeof(msg) - n, "%s\"%s\"",
+                      first ? "" : ",", g_crypto[i].pair);
+        first = false;
+    }
+    if (first || n >= (int)sizeof(msg) - 3) return;   // nothing to subscribe
+    n += snprintf(msg + n, sizeof(msg) - n, "]}");
+
+    if (esp_websocket_client_send_text(s_ws, msg, n, pdMS_TO_TICKS(2000)) < 0) {
+        ESP_LOGW(TAG, "Subscribe send failed");
+    } else {
+        ESP_LOGI(TAG, "Subscribed spot.tickers (%d bytes)", n);
+    }
+}
+
+static void ws_event_handler(void *arg, esp_event_base_t base,
+                             int32_t event_id, void *event_data)
+{
+    (void)arg;
+    (void)base;
+    esp_websocket_event_data_t *d = (esp_websocket_event_data_t *)event_data;
+
+    switch (event_id) {
+    case WEBSOCKET_EVENT_CONNECTED:
+        ESP_LOGI(TAG, "Connected to %s", PRICE_WS_URI);
+        subscribe_all();
+        break;
+
+    case WEBSOCKET_EVENT_DISCONNECTED:
+    case WEBSOCKET_EVENT_CLOSED:
+        // REST polling takes over by itself: pushes stop postponing it
+        ESP_LOGW(TAG, "Disconnected, REST polling resumes");
+        break;
+
+    case WEBSOCKET_EVENT_DATA:
+        // Text frames only; large frames arrive in pieces (payload_offset)
+        if (d->op_code != 0x1 && d->op_code != 0x0) break;
+        if (d->payload_offset == 0) frame_begin();
+        json_stream_feed(&s_frame.js, d->data_ptr, d->data_len);
+        break;
+
+    case WEBSOCKET_EVENT_ERROR:
+        ESP_LOGW(TAG, "WebSocket error");
+        break;
+
+    default:
+        break;
+    }
+}
+
+void price_ws_start(void)
+{
+    if (s_ws) return;
+
+    esp_websocket_client_config_t cfg = {
+        .uri = PRICE_WS_URI,
+        .crt_bundle_attach = esp_crt_bundle_attach,
+        .reconnect_timeout_ms = WS_RECONNECT_MS,
+        .network_timeout_ms = WS_RECONNECT_MS,
+        .task_stack = 4096,
+        .buffer_size = 1024,
+    };
+    s_ws = esp_websocket_client_init(&cfg);
+    if (!s_ws) {
+        ESP_LOGE(TAG, "Failed to init WebSocket client");
+        return;
+    }
+    esp_websocket_register_events(s_ws, WEBSOCKET_EVENT_ANY, ws_event_handler, NULL);
+    esp_websocket_client_start(s_ws);
+}
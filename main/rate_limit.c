@@ -0,0 +1,268 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "rate_limit.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "freertos/FreeRTOS.h"
+
+#include <stdlib.h>
+#include <strings.h>
+#include <sys/time.h>
+
+static const char *TAG = "rate_limit";
+
+// ── Budget ─────────────────────────────────────────────────────────
+// Gate.io allows 200 public requests / 10 s per IP. One device needs a
+// few per minute, so the local bucket is deliberately far below that:
+// a whole office of tickers behind one NAT stays within the IP limit.
+#define RL_BURST              6        // bucket capacity
+#define RL_REFILL_MS          2000     // one token every 2 s
+#define RL_LOW_REMAIN_PCT     10       // server window below 10% → hold off
+#define RL_MAX_HOLD_MS        30000    // cap for header-driven holds
+#define RL_DEFAULT_RETRY_MS   5000     // 429 without Retry-After
+#define RL_REPORT_N           100      // log counters every N granted requests
+
+// ── Circuit breaker ────────────────────────────────────────────────
+#define RL_TRIP_FAILURES      3        // consecutive failures → open
+#define RL_BACKOFF_BASE_MS    2000
+#define RL_BACKOFF_MAX_MS     300000   // 5 min
+#define RL_JITTER_PCT         25       // ±25% on every backoff
+
+typedef enum { BR_CLOSED, BR_OPEN, BR_HALF_OPEN } breaker_state_t;
+
+typedef struct {
+    breaker_state_t state;
+    uint8_t  fails;          // consecutive failures while closed
+    uint8_t  trips;          // consecutive trips, drives the backoff
+    bool     probing;        // half-open: the single probe is in flight
+    int64_t  open_until_ms;
+} breaker_t;
+
+static const char *const s_ep_name[RL_EP_COUNT] = { "ticker", "batch", "candles" };
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static int32_t   s_tokens = RL_BURST;
+static int64_t   s_refill_ms;            // time the last token was added
+static int64_t   s_hold_until_ms;        // global: Retry-After / spent window
+static breaker_t s_breaker[RL_EP_COUNT];
+static rl_stats_t s_stats;
+
+static inline int64_t now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+static int64_t jitter(int64_t ms)
+{
+    int64_t span = ms * RL_JITTER_PCT / 100;
+    if (span <= 0) return ms;
+    return ms - span + (int64_t)(esp_random() % (uint32_t)(2 * span + 1));
+}
+
+/* Caller holds s_lock. */
+static void refill(int64_t now)
+{
+    if (s_refill_ms == 0) s_refill_ms = now;
+    int64_t add = (now - s_refill_ms) / RL_REFILL_MS;
+    if (add <= 0) return;
+    s_tokens = (s_tokens + add > RL_BURST) ? RL_BURST : (int32_t)(s_tokens + add);
+    s_refill_ms += add * RL_REFILL_MS;
+    if (s_tokens == RL_BURST) s_refill_ms = now;
+}
+
+/* Caller holds s_lock. 0 = may send now. */
+static int64_t delay_locked(rl_endpoint_t ep, int64_t now)
+{
+    int64_t d = 0;
+    breaker_t *b = &s_breaker[ep];
+    if (b->state == BR_OPEN && b->open_until_ms > now) d = b->open_until_ms - now;
+    if (b->state == BR_HALF_OPEN && b->probing) d = RL_REFILL_MS;
+    if (s_hold_until_ms > now && s_hold_until_ms - now > d) d = s_hold_until_ms - now;
+    if (d == 0 && s_tokens <= 0) d = s_refill_ms + RL_REFILL_MS - now;
+    return d > 0 ? d : 0;
+}
+
+bool rate_limit_acquire(rl_endpoint_t ep, int64_t *retry_ms)
+{
+    if (retry_ms) *retry_ms = 0;
+    if (ep >= RL_EP_COUNT) return false;
+
+    int64_t now = now_ms();
+    bool granted = false;
+
+    portENTER_CRITICAL(&s_lock);
+    refill(now);
+    breaker_t *b = &s_breaker[ep];
+    if (b->state == BR_OPEN && now >= b->open_until_ms) {
+        b->state = BR_HALF_OPEN;          // let one probe through
+        b->probing = false;
+    }
+    if (b->state == BR_OPEN || (b->state == BR_HALF_OPEN && b->probing)) {
+        s_stats.denied_breaker++;
+    } else if (s_hold_until_ms > now || s_tokens <= 0) {
+        s_stats.denied_budget++;
+    } else {
+        s_tokens--;
+        s_stats.granted++;
+        if (b->state == BR_HALF_OPEN) b->probing = true;
+        granted = true;
+    }
+    if (!granted && retry_ms) *retry_ms = delay_locked(ep, now);
+    portEXIT_CRITICAL(&s_lock);
+
+    if (granted && s_stats.granted % RL_REPORT_N == 0) {
+        rl_stats_t st;
+        rate_limit_get_stats(&st);
+        ESP_LOGI(TAG, "granted %lu, denied %lu budget / %lu breaker, "
+                 "429s %lu, failures %lu, trips %lu",
+                 (unsigned long)st.granted, (unsigned long)st.denied_budget,
+                 (unsigned long)st.denied_breaker, (unsigned long)st.http_429,
+                 (unsigned long)st.failures, (unsigned long)st.breaker_trips);
+    }
+    return granted;
+}
+
+void rate_limit_cancel(rl_endpoint_t ep)
+{
+    if (ep >= RL_EP_COUNT) return;
+    portENTER_CRITICAL(&s_lock);
+    s_breaker[ep].probing = false;
+    if (s_tokens < RL_BURST) s_tokens++;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void rate_limit_headers_clear(rl_headers_t *h)
+{
+    h->limit = -1;
+    h->remain = -1;
+    h->reset_s = 0;
+    h->retry_after_s = -1;
+}
+
+void rate_limit_note_header(rl_headers_t *h, const char *key, const char *value)
+{
+    if (!key || !value) return;
+    if (strcasecmp(key, "X-Gate-RateLimit-Requests-Remain") == 0) {
+        h->remain = atoi(value);
+    } else if (strcasecmp(key, "X-Gate-RateLimit-Limit") == 0) {
+        h->limit = atoi(value);
+    } else if (strcasecmp(key, "X-Gate-RateLimit-Reset-Timestamp") == 0) {
+        h->reset_s = strtoll(value, NULL, 10);
+    } else if (strcasecmp(key, "Retry-After") == 0) {
+        h->retry_after_s = atoi(value);   // HTTP-date form is not used by Gate.io
+    }
+}
+
+/* ms from now until the server window resets, or -1 if unknown. */
+static int64_t until_reset_ms(const rl_headers_t *h)
+{
+    if (h->reset_s <= 0) return -1;
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    if (tv.tv_sec < 1700000000) return -1;   // clock not synced yet
+    int64_t ms = h->reset_s * 1000 - ((int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000);
+    return ms > 0 ? ms : 0;
+}
+
+/* Caller holds s_lock. */
+static void hold_for(int64_t now, int64_t ms)
+{
+    if (ms > RL_MAX_HOLD_MS) ms = RL_MAX_HOLD_MS;
+    if (now + ms > s_hold_until_ms) s_hold_until_ms = now + ms;
+}
+
+/* Caller holds s_lock. Returns the backoff when the breaker opened. */
+static int64_t breaker_fail(breaker_t *b, int64_t now, bool trip_now)
+{
+    if (b->state == BR_CLOSED && !trip_now && ++b->fails < RL_TRIP_FAILURES) return 0;
+
+    int shift = b->trips < 16 ? b->trips : 16;
+    int64_t backoff = (int64_t)RL_BACKOFF_BASE_MS << shift;
+    if (backoff > RL_BACKOFF_MAX_MS) backoff = RL_BACKOFF_MAX_MS;
+    backoff = jitter(backoff);
+
+    b->state = BR_OPEN;
+    b->probing = false;
+    b->open_until_ms = now + backoff;
+    b->fails = 0;
+    if (b->trips < UINT8_MAX) b->trips++;
+    s_stats.breaker_trips++;
+    return backoff;
+}
+
+void rate_limit_on_response(rl_endpoint_t ep, int status, const rl_headers_t *h)
+{
+    if (ep >= RL_EP_COUNT) return;
+    int64_t now = now_ms();
+    int64_t opened = 0, held = 0;
+    int32_t remain = -1, limit = -1;
+    int64_t reset_ms = h ? until_reset_ms(h) : -1;
+
+    portENTER_CRITICAL(&s_lock);
+    breaker_t *b = &s_breaker[ep];
+
+    if (h) {
+        remain = h->remain;
+        limit = h->limit;
+        // Server window almost spent: stop until it resets
+        if (h->remain >= 0 && h->limit > 0 &&
+            h->remain * 100 <= h->limit * RL_LOW_REMAIN_PCT) {
+            held = jitter(reset_ms >= 0 ? reset_ms : RL_DEFAULT_RETRY_MS);
+            hold_for(now, held);
+            s_tokens = 0;
+        }
+    }
+
+    if (status == 429) {
+        s_stats.http_429++;
+        int64_t ms = (h && h->retry_after_s >= 0) ? (int64_t)h->retry_after_s * 1000
+                   : reset_ms >= 0 ? reset_ms
+                   : RL_DEFAULT_RETRY_MS;
+        held = jitter(ms);
+        hold_for(now, held);
+        s_tokens = 0;
+        opened = breaker_fail(b, now, true);
+    } else if (status == 0 || status >= 500) {
+        s_stats.failures++;
+        b->probing = false;
+        opened = breaker_fail(b, now, b->state == BR_HALF_OPEN);
+    } else {
+        // Any answer from the server (incl. 4xx) means the path is healthy
+        b->state = BR_CLOSED;
+        b->fails = 0;
+        b->trips = 0;
+        b->probing = false;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (status == 429 || held > 0) {
+        ESP_LOGW(TAG, "%s: status %d, remain %ld/%ld, holding %lld ms",
+                 s_ep_name[ep], status, (long)remain, (long)limit, held);
+    }
+    if (opened > 0) {
+        ESP_LOGW(TAG, "%s: breaker open for %lld ms", s_ep_name[ep], opened);
+    }
+}
+
+int64_t rate_limit_delay_ms(rl_endpoint_t ep)
+{
+    if (ep >= RL_EP_COUNT) return 0;
+    int64_t now = now_ms();
+    portENTER_CRITICAL(&s_lock);
+    refill(now);
+    int64_t d = delay_locked(ep, now);
+    portEXIT_CRITICAL(&s_lock);
+    return d;
+}
+
+void rate_limit_get_stats(rl_stats_t *out)
+{
+    portENTER_CRITICAL(&s_lock);
+    *out = s_stats;
+    portEXIT_CRITICAL(&s_lock);
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Client-side request budget for the Gate.io REST API.
+ * One token bucket is shared by every REST request (ticker, batch and
+ * candlestick); each endpoint also has its own circuit breaker. The bucket
+ * follows the server's X-Gate-RateLimit-* headers and Retry-After, so
+ * devices sharing one public IP back off before they are throttled.
+ */
+
+typedef enum {
+    RL_EP_TICKER,      // /spot/tickers?currency_pair=
+    RL_EP_BATCH,       // /spot/tickers (all pairs)
+    RL_EP_CANDLES,     // /spot/candlesticks
+    RL_EP_COUNT,
+} rl_endpoint_t;
+
+// Rate-limit headers of one response, filled from HTTP_EVENT_ON_HEADER
+typedef struct {
+    int32_t limit;         // X-Gate-RateLimit-Limit, -1 if absent
+    int32_t remain;        // X-Gate-RateLimit-Requests-Remain, -1 if absent
+    int64_t reset_s;       // X-Gate-RateLimit-Reset-Timestamp (epoch s), 0 if absent
+    int32_t retry_after_s; // Retry-After, -1 if absent
+} rl_headers_t;
+
+typedef struct {
+    uint32_t granted;          // requests let through
+    uint32_t denied_budget;    // refused: bucket empty / server window spent
+    uint32_t denied_breaker;   // refused: endpoint breaker open
+    uint32_t http_429;         // 429 responses received
+    uint32_t failures;         // transport errors and 5xx
+    uint32_t breaker_trips;    // closed → open transitions
+} rl_stats_t;
+
+/**
+ * Take one request token for an endpoint. Never blocks: when the bucket
+ * is empty, the endpoint breaker is open or the server asked to back off,
+ * returns false and sets *retry_ms (may be NULL) to how long until a
+ * request could be granted, for the caller to reschedule itself.
+ */
+bool rate_limit_acquire(rl_endpoint_t ep, int64_t *retry_ms);
+
+/**
+ * Hand back a token from rate_limit_acquire() for a request that was
+ * not sent (e.g. no HTTP client). Frees the endpoint's half-open probe
+ * slot, which otherwise only a response clears.
+ */
+void rate_limit_cancel(rl_endpoint_t ep);
+
+/**
+ * Reset a header record before a request.
+ */
+void rate_limit_headers_clear(rl_headers_t *h);
+
+/**
+ * Record one response header (call from HTTP_EVENT_ON_HEADER).
+ */
+void rate_limit_note_header(rl_headers_t *h, const char *key, const char *value);
+
+/**
+ * Report the outcome of a request.
+ * status is the HTTP status (0 on transport error); h may be NULL.
+ */
+void rate_limit_on_response(rl_endpoint_t ep, int status, const rl_headers_t *h);
+
+/**
+ * Milliseconds until a request to ep could be granted (0 = now).
+ */
+int64_t rate_limit_delay_ms(rl_endpoint_t ep);
+
+/**
+ * Copy the counters.
+ */
+void rate_limit_get_stats(rl_stats_t *out);
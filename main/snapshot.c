@@ -0,0 +1,266 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "snapshot.h"
+#include "ui.h"
+#include "ui_internal.h"
+#include "token_config.h"
+
+#include "esp_partition.h"
+#include "esp_crc.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include <string.h>
+#include <time.h>
+
+static const char *TAG = "snapshot";
+
+// ── Layout ─────────────────────────────────────────────────────────
+// The partition is a ring of 4 KB slots, one snapshot per slot. Each
+// save goes to the slot after the newest one, so erases are spread
+// evenly over the whole partition; the older slots stay valid until
+// they are reused. Token records are written first and the header
+// last: a slot with a valid header is complete.
+#define SNAP_PART_SUBTYPE  0x40
+#define SNAP_SLOT_SIZE     4096
+#define SNAP_MAGIC         0x50414E53   // "SNAP"
+#define SNAP_VERSION       3
+#define SNAP_PERIOD_MS     (10 * 60 * 1000)
+#define SNAP_MIN_EPOCH     1704067200   // 2024-01-01: wall clock is synced
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t  fixed_point;     // PRICE_FIXED_POINT of the writer
+    uint8_t  count;           // token records that follow
+    uint32_t seq;             // increases with every save
+    uint32_t crc;             // over the token records
+    int64_t  saved_s;         // wall clock at save
+} snap_hdr_t;
+
+typedef struct {
+    char     symbol[8];
+    price_t  price;
+    price_t  change_pct;
+    price_t  high_24h;
+    price_t  low_24h;
+    int64_t  candle_ts;       // start of the newest candle in hist
+    uint8_t  hist_count;
+    uint8_t  reserved[7];
+    price_t  hist[PRICE_HIST_LEN];   // chronological
+} snap_token_t;
+
+_Static_assert(sizeof(snap_hdr_t) + MAX_TOKENS * sizeof(snap_token_t) <= SNAP_SLOT_SIZE,
+               "snapshot does not fit one flash sector");
+
+static const esp_partition_t *s_part;
+static int      s_slots;
+static int      s_slot = -1;       // slot of the newest snapshot, -1 = none
+static uint32_t s_seq;
+static uint32_t s_last_crc;        // payload of the newest snapshot
+static price_hist_t s_hist;        // history being restored or saved
+
+static bool open_partition(void)
+{
+    if (s_part) return true;
+    s_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, SNAP_PART_SUBTYPE, "snapshot");
+    if (!s_part) {
+        ESP_LOGW(TAG, "No snapshot partition");
+        return false;
+    }
+    s_slots = s_part->size / SNAP_SLOT_SIZE;
+    return s_slots > 0;
+}
+
+static bool read_header(int slot, snap_hdr_t *h)
+{
+    if (esp_partition_read(s_part, (size_t)slot * SNAP_SLOT_SIZE, h, sizeof(*h)) != ESP_OK) {
+        return false;
+    }
+    return h->magic == SNAP_MAGIC && h->version == SNAP_VERSION &&
+           h->fixed_point == PRICE_FIXED_POINT && h->count <= MAX_TOKENS;
+}
+
+static size_t token_offset(int slot, int i)
+{
+    return (size_t)slot * SNAP_SLOT_SIZE + sizeof(snap_hdr_t) + i * sizeof(snap_token_t);
+}
+
+/* CRC of a slot's token records, or ~crc on a read error. */
+static uint32_t slot_crc(int slot, const snap_hdr_t *h)
+{
+    uint32_t crc = 0;
+    snap_token_t t;
+    for (int i = 0; i < h->count; i++) {
+        if (esp_partition_read(s_part, token_offset(slot, i), &t, sizeof(t)) != ESP_OK) {
+            return ~h->crc;
+        }
+        crc = esp_crc32_le(crc, (const uint8_t *)&t, sizeof(t));
+    }
+    return crc;
+}
+
+/* Find the newest slot whose records match its header CRC. */
+static int find_newest(snap_hdr_t *out)
+{
+    int best = -1;
+    for (int s = 0; s < s_slots; s++) {
+        snap_hdr_t h;
+        if (!read_header(s, &h)) continue;
+        if (best >= 0 && (int32_t)(h.seq - out->seq) <= 0) continue;
+        if (slot_crc(s, &h) != h.crc) {
+            ESP_LOGW(TAG, "Slot %d: bad CRC, skipped", s);
+            continue;
+        }
+        best = s;
+        *out = h;
+    }
+    return best;
+}
+
+static int find_active(const char *symbol)
+{
+    for (int i = 0; i < g_active_count; i++) {
+        if (strncmp(g_crypto[i].symbol, symbol, sizeof(((snap_token_t *)0)->symbol)) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool snapshot_restore(void)
+{
+    if (!open_partition()) return false;
+
+    snap_hdr_t h;
+    s_slot = find_newest(&h);
+    if (s_slot < 0) {
+        ESP_LOGI(TAG, "No snapshot to restore");
+        return false;
+    }
+    s_seq = h.seq;
+    s_last_crc = h.crc;
+
+    int restored = 0;
+    snap_token_t t;
+    for (int i = 0; i < h.count; i++) {
+        if (esp_partition_read(s_part, token_offset(s_slot, i), &t, sizeof(t)) != ESP_OK) break;
+        int idx = find_active(t.symbol);
+        if (idx < 0) continue;   // token no longer selected
+
+        price_hist_reset(&s_hist);
+        int n = t.hist_count <= PRICE_HIST_LEN ? t.hist_count : PRICE_HIST_LEN;
+        for (int k = 0; k < n; k++) price_hist_push(&s_hist, t.hist[k]);
+        crypto_set_hist(idx, &s_hist, t.candle_ts);
+
+        ui_restore_price(idx, t.price, t.change_pct, t.high_24h, t.low_24h, h.saved_s);
+        restored++;
+    }
+
+    // The clock is not synced yet: the UI shows the age once it is
+    ESP_LOGI(TAG, "Restored %d/%d tokens from slot %d (seq %lu, saved at %lld)",
+             restored, g_active_count, s_slot, (unsigned long)h.seq, h.saved_s);
+    return restored == g_active_count && restored > 0;
+}
+
+static void fill_token(snap_token_t *t, int idx)
+{
+    crypto_quote_t q = crypto_get_quote(idx);
+    memset(t, 0, sizeof(*t));
+    strlcpy(t->symbol, g_crypto[idx].symbol, sizeof(t->symbol));
+    t->price = q.price;
+    t->change_pct = q.change_pct;
+    t->high_24h = q.high_24h;
+    t->low_24h = q.low_24h;
+    t->candle_ts = crypto_get_hist(idx, &s_hist);
+    t->hist_count = s_hist.count;
+    for (int k = 0; k < s_hist.count; k++) t->hist[k] = price_hist_at(&s_hist, k);
+}
+
+void snapshot_save(void)
+{
+    if (!open_partition()) return;
+
+    time_t now;
+    time(&now);
+    if (now < SNAP_MIN_EPOCH) return;   // chart timestamps would be meaningless
+
+    // Unfetched tokens would restore as $0 — wait until every price is in
+    snap_token_t t;
+    uint32_t crc = 0;
+    for (int i = 0; i < g_active_count; i++) {
+        if (crypto_get_quote(i).price <= 0) return;
+        fill_token(&t, i);
+        crc = esp_crc32_le(crc, (const uint8_t *)&t, sizeof(t));
+    }
+    if (s_slot >= 0 && crc == s_last_crc) return;
+
+    int slot = (s_slot + 1) % s_slots;
+    size_t base = (size_t)slot * SNAP_SLOT_SIZE;
+    int64_t t0 = esp_timer_get_time();
+
+    // The only long flash operation: one sector erase (tens of ms with the
+    // cache off). The task runs at the lowest priority, so it starts only
+    // while the fetch and LVGL tasks are idle, at most once per period.
+    esp_err_t err = esp_partition_erase_range(s_part, base, SNAP_SLOT_SIZE);
+
+    // Records are rebuilt from g_crypto and the CRC is taken over exactly
+    // what is written, so a tick landing in between cannot break the slot
+    uint32_t wcrc = 0;
+    for (int i = 0; err == ESP_OK && i < g_active_count; i++) {
+        fill_token(&t, i);
+        wcrc = esp_crc32_le(wcrc, (const uint8_t *)&t, sizeof(t));
+        err = esp_partition_write(s_part, token_offset(slot, i), &t, sizeof(t));
+    }
+    if (err == ESP_OK) {
+        snap_hdr_t h = {
+            .magic = SNAP_MAGIC,
+            .version = SNAP_VERSION,
+            .fixed_point = PRICE_FIXED_POINT,
+            .count = (uint8_t)g_active_count,
+            .seq = s_seq + 1,
+            .crc = wcrc,
+            .saved_s = (int64_t)now,
+        };
+        err = esp_partition_write(s_part, base, &h, sizeof(h));
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Save to slot %d failed: %s", slot, esp_err_to_name(err));
+        return;
+    }
+
+    s_slot = slot;
+    s_seq++;
+    s_last_crc = wcrc;
+    ESP_LOGI(TAG, "Saved %d tokens to slot %d (seq %lu) in %lld ms", g_active_count, slot,
+             (unsigned long)s_seq, (esp_timer_get_time() - t0) / 1000);
+}
+
+static void snapshot_task(void *arg)
+{
+    (void)arg;
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(SNAP_PERIOD_MS));
+        snapshot_save();
+    }
+}
+
+void snapshot_start(void)
+{
+    if (!open_partition()) return;
+    if (s_slot < 0) {
+        snap_hdr_t h;
+        s_slot = find_newest(&h);   // restore was skipped or found nothing
+        if (s_slot >= 0) {
+            s_seq = h.seq;
+            s_last_crc = h.crc;
+        }
+    }
+    // Lowest priority: flash erases run only when fetch and UI tasks idle
+    xTaskCreate(snapshot_task, "snapshot", 3072, NULL, 1, NULL);
+}
@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+/*
+ * Warm-boot snapshot: prices, 24h fields and chart history of every
+ * active token, kept in the "snapshot" flash partition so the UI can
+ * show the last session's data right after boot.
+ */
+
+/**
+ * Load the newest valid snapshot into g_crypto[] and mark the restored
+ * tokens as stale until their first live update.
+ * Call after token_config_load(), before ui_init().
+ * Returns true if every active token was restored.
+ */
+bool snapshot_restore(void);
+
+/**
+ * Start the low-priority task that saves a snapshot periodically.
+ */
+void snapshot_start(void);
+
+/**
+ * Save a snapshot now (skipped if nothing changed since the last one).
+ * Blocks for one sector erase plus a few page writes.
+ */
+void snapshot_save(void);
@@ -5,7 +5,7 @@
 
 #include "token_config.h"
 #include "ui_internal.h"
-#include "crypto_logos.h"
+#include "assets.h"
 
 #include "nvs_flash.h"
 #include "nvs.h"
@@ -19,16 +19,16 @@ static const char *TAG = "token_cfg";
 #define NVS_KEY_TOKENS  "tokens"
 
 const token_registry_entry_t g_token_registry[TOTAL_AVAILABLE] = {
-    { "bitcoin",   "BTC",  "Bitcoin",    "BTC_USDT",  &img_bitcoin_logo   },
-    { "ethereum",  "ETH",  "Ethereum",   "ETH_USDT",  &img_ethereum_logo  },
-    { "paxg",      "PAXG", "PAX Gold",   "PAXG_USDT", &img_paxg_logo      },
-    { "chainbase", "C",    "Chainbase",  "C_USDT",    &img_chainbase_logo },
-    { "sui",       "SUI",  "Sui",        "SUI_USDT",  &img_sui_logo       },
-    { "doge",      "DOGE", "Dogecoin",   "DOGE_USDT", &img_doge_logo      },
-    { "solana",    "SOL",  "Solana",     "SOL_USDT",  &img_solana_logo    },
-    { "tron",      "TRX",  "Tron",       "TRX_USDT",  &img_tron_logo      },
-    { "usdc",      "USDC", "USD Coin",   "USDC_USDT", &img_usdc_logo      },
-    { "usdt",      "USDT", "Tether",     NULL,         &img_usdt_logo      },
+    { "bitcoin",   "BTC",  "Bitcoin",    "BTC_USDT"  },
+    { "ethereum",  "ETH",  "Ethereum",   "ETH_USDT"  },
+    { "paxg",      "PAXG", "PAX Gold",   "PAXG_USDT" },
+    { "chainbase", "C",    "Chainbase",  "C_USDT"    },
+    { "sui",       "SUI",  "Sui",        "SUI_USDT"  },
+    { "doge",      "DOGE", "Dogecoin",   "DOGE_USDT" },
+    { "solana",    "SOL",  "Solana",     "SOL_USDT"  },
+    { "tron",      "TRX",  "Tron",       "TRX_USDT"  },
+    { "usdc",      "USDC", "USD Coin",   "USDC_USDT" },
+    { "usdt",      "USDT", "Tether",     NULL        },
 };
 
 int g_active_count = 0;
@@ -69,7 +69,7 @@ void token_config_load(void)
         if (entry) {
             g_crypto[g_active_count].symbol = entry->symbol;
             g_crypto[g_active_count].name   = entry->name;
-            g_crypto[g_active_count].logo   = entry->logo;
+            g_crypto[g_active_count].logo   = assets_logo(entry->id);
             g_crypto[g_active_count].pair   = entry->pair;
             g_active_count++;
         } else {
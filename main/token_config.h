@@ -5,8 +5,6 @@
 
 #pragma once
 
-#include "lvgl.h"
-
 #define MAX_TOKENS       6    // user selects 4–6
 #define TOTAL_AVAILABLE  10
 #define DEFAULT_TOKENS   "bitcoin,ethereum,paxg,chainbase,sui"
@@ -16,7 +14,6 @@ typedef struct {
     const char *symbol;       // ticker symbol shown in UI
     const char *name;         // full name
     const char *pair;         // Gate.io trading pair (NULL = stablecoin, skip fetch)
-    const lv_image_dsc_t *logo;
 } token_registry_entry_t;
 
 extern const token_registry_entry_t g_token_registry[TOTAL_AVAILABLE];
@@ -8,6 +8,7 @@
 #include "esp_pm.h"
 #include "esp_system.h"
 #include "display.h"
+#include "assets.h"
 #include "wifi.h"
 #include "time_sync.h"
 #include "ui.h"
@@ -15,6 +16,9 @@
 #include "price_fetch.h"
 #include "token_config.h"
 #include "homekit.h"
+#include "snapshot.h"
+#include "hist_store.h"
+#include "price_series.h"
 
 static const char *TAG = "main";
 
@@ -48,42 +52,59 @@ void app_main(void)
 
     power_management_init();
 
+#ifdef PRICE_BENCH
+    price_bench_run();
+    price_series_bench_run();
+#endif
+
     esp_err_t ret = display_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Display init failed: %s", esp_err_to_name(ret));
         return;
     }
 
+    assets_init();        // fonts and logos, before token_config_load() and any UI
     token_config_load();
+    bool warm = snapshot_restore();   // last session's data, before ui_init()
     led_init();
     btn_init();  // early init so long-press provisioning works during WiFi connect
 
-    // Show boot screen while connecting
-    ui_boot_show("Initializing...", 10);
+    if (warm) {
+        // Show the restored data right away; fetches fill the gap later
+        ui_init();
+    } else {
+        // Show boot screen while connecting
+        ui_boot_show("Initializing...", 10);
+        ui_boot_show("Connecting WiFi...", 30);
+    }
 
-    ui_boot_show("Connecting WiFi...", 30);
     ret = wifi_init_sta();
     if (ret != ESP_OK) {
         ESP_LOGW(TAG, "WiFi not connected, continuing with mock data");
     } else {
-        ui_boot_show("Syncing time...", 40);
+        if (!warm) ui_boot_show("Syncing time...", 40);
         time_sync_init();
 
-        ui_boot_show("Fetching prices...", 50);
-        price_fetch_first();
-
-        ui_boot_show("Starting HomeKit...", 90);
+        if (!warm) {
+            ui_boot_show("Fetching prices...", 50);
+            price_fetch_first();
+            ui_boot_show("Starting HomeKit...", 90);
+        }
         homekit_init();
     }
 
-    ui_boot_show("Loading UI...", 95);
+    if (!warm) {
+        ui_boot_show("Loading UI...", 95);
 
-    // Remove boot screen, build main UI
-    ui_boot_hide();
-    ui_init();
+        // Remove boot screen, build main UI
+        ui_boot_hide();
+        ui_init();
+    }
 
     // Always start polling — if WiFi reconnects later, fetches will succeed
     price_fetch_start();
+    snapshot_start();
+    hist_store_start();
 
     ESP_LOGI(TAG, "TokenTicker UI ready");
 }
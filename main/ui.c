@@ -5,31 +5,115 @@
 
 #include "ui.h"
 #include "ui_internal.h"
+#include "ui_odometer.h"
+#include "ui_glyph_atlas.h"
+#include "ui_glow.h"
+#include "disp_stats.h"
 #include "price_fetch.h"
+#include "price_candle.h"
+#include "price_lttb.h"
+#include "price_series.h"
+#include "hist_store.h"
 #include "led.h"
-#include "boot_logo.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_lvgl_port.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
 #include "lvgl.h"
 
-#include <sys/time.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
-LV_FONT_DECLARE(font_mono_10)
-LV_FONT_DECLARE(font_mono_12)
-LV_FONT_DECLARE(font_mono_14)
-LV_FONT_DECLARE(font_mono_18)
-LV_FONT_DECLARE(font_mono_20)
-LV_FONT_DECLARE(font_mono_24)
-
 static const char *TAG = "ui";
 
 // ── Crypto data (populated at runtime by token_config_load) ────────
 crypto_item_t g_crypto[MAX_TOKENS] = {0};
 
+// Serializes writers of g_crypto's seqlocked fields (readers never wait)
+static portMUX_TYPE s_crypto_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Copy of the history being charted (used under the LVGL lock)
+static price_hist_t s_hist_copy;
+
+static void crypto_write_begin(crypto_item_t *item)
+{
+    taskENTER_CRITICAL(&s_crypto_lock);
+    atomic_fetch_add_explicit(&item->seq, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+static void crypto_write_end(crypto_item_t *item)
+{
+    atomic_fetch_add_explicit(&item->seq, 1, memory_order_release);
+    taskEXIT_CRITICAL(&s_crypto_lock);
+}
+
+crypto_quote_t crypto_get_quote(int idx)
+{
+    const crypto_item_t *item = &g_crypto[idx];
+    crypto_quote_t q;
+    uint32_t seq;
+    do {
+        seq = crypto_read_begin(item);
+        q = item->quote;
+    } while (crypto_read_retry(item, seq));
+    return q;
+}
+
+void crypto_set_quote(int idx, const crypto_quote_t *q)
+{
+    crypto_item_t *item = &g_crypto[idx];
+    crypto_write_begin(item);
+    item->quote = *q;
+    crypto_write_end(item);
+}
+
+int64_t crypto_get_candle_ts(int idx)
+{
+    const crypto_item_t *item = &g_crypto[idx];
+    int64_t ts;
+    uint32_t seq;
+    do {
+        seq = crypto_read_begin(item);
+        ts = item->candle_ts;
+    } while (crypto_read_retry(item, seq));
+    return ts;
+}
+
+int64_t crypto_get_hist(int idx, price_hist_t *out)
+{
+    const crypto_item_t *item = &g_crypto[idx];
+    int64_t ts;
+    uint32_t seq;
+    do {
+        seq = crypto_read_begin(item);
+        *out = item->hist;
+        ts = item->candle_ts;
+    } while (crypto_read_retry(item, seq));
+    return ts;
+}
+
+void crypto_set_hist(int idx, const price_hist_t *h, int64_t candle_ts)
+{
+    crypto_item_t *item = &g_crypto[idx];
+    crypto_write_begin(item);
+    item->hist = *h;
+    item->candle_ts = candle_ts;
+    crypto_write_end(item);
+}
+
+void crypto_push_candle(int idx, price_t close, int64_t candle_ts)
+{
+    crypto_item_t *item = &g_crypto[idx];
+    crypto_write_begin(item);
+    price_hist_push(&item->hist, close);
+    item->candle_ts = candle_ts;
+    crypto_write_end(item);
+}
+
 // ── Shared state ───────────────────────────────────────────────────
 int  s_focus_idx = 0;
 bool s_animating = false;
@@ -38,16 +122,41 @@ bool s_show_info = false;
 // Loading overlay — shown until first prices arrive
 lv_obj_t *s_loading_overlay;
 static bool s_price_loaded[MAX_TOKENS];
-static int  s_history_count[MAX_TOKENS];
+static bool s_restored[MAX_TOKENS];     // snapshot data, no live update yet
+static int64_t s_restored_s[MAX_TOKENS]; // when that snapshot was saved (epoch s), 0 = unknown
 
 // Price flash animation
 static lv_timer_t *s_flash_timer;
 
-// Price scroll animation
-static int32_t s_price_scale = 100;
-
-// Chart throttle: record one point per CHART_INTERVAL_MS
-static int64_t s_last_chart_time[MAX_TOKENS];
+// Chart candles: every tick goes into its token's open candle; a closed
+// candle appends its close to the chart. Fed on the LVGL task only,
+// from the ticks queued with each token's event.
+#define CANDLE_MIN_EPOCH  1704067200   // 2024-01-01: wall clock is synced
+static candle_agg_t s_candle[MAX_TOKENS];
+static lv_timer_t *s_candle_timer;
+
+// Minute closes of every token, compressed to ~2 bytes each; the 1H
+// view is drawn from here once the last hour is covered. Minutes
+// without ticks repeat the last close for up to MINUTE_FILL minutes,
+// longer gaps start a new chunk. Like the chart candles, all of it is
+// touched only by the LVGL task.
+#define MINUTE_S       60
+#define MINUTE_CHUNKS  12               // 3 KB per token, about a day
+#define MINUTE_FILL    5
+static candle_agg_t   s_minute[MAX_TOKENS];
+static price_series_t s_minutes[MAX_TOKENS];
+static series_chunk_t s_minute_chunks[MAX_TOKENS][MINUTE_CHUNKS];
+static price_t        s_minute_close[MAX_TOKENS];
+
+// Pending redraw of one token, applied by the LVGL task. Updates that
+// arrive before it runs merge into the same event.
+typedef struct {
+    price_t  old_price;         // shown before the first merged update
+    bool     chart_reload;      // the 1D history was replaced
+    uint8_t  spans;             // ticks since the last frame, as 1-minute
+    candle_t span[2];           // partial candles, oldest first
+} ui_event_t;
+static lv_timer_t *s_evt_timer;
 
 // Stale data detection
 #define STALE_THRESHOLD_S  60
@@ -63,8 +172,40 @@ static lv_obj_t *s_main_price;
 static lv_obj_t *s_chg_pill;
 static lv_obj_t *s_chg_label;
 static lv_obj_t *s_stale_dot;    // small red dot when data is stale
+static lv_obj_t *s_stale_age;    // "5m ago": age of restored data, top-right of chart
 static lv_obj_t *s_chart;
 static lv_chart_series_t *s_chart_ser;
+static lv_obj_t *s_tf_label;     // timeframe shown, top-left of chart
+
+// What the chart currently shows: appends reuse this scale until the
+// history's min/max move
+static int     s_chart_idx = -1;
+static int     s_chart_count;         // history points shown
+static price_t s_chart_min, s_chart_max;
+static price_t s_chart_lo, s_chart_range;
+
+// ── Chart timeframes ───────────────────────────────────────────────
+const chart_tf_info_t g_chart_tf[TF_COUNT] = {
+    [TF_1D] = { "1D", "30m", 1800, CHART_POINTS   },
+    [TF_7D] = { "7D", "30m", 1800, TF_MAX_CANDLES },
+    [TF_1H] = { "1H", "1m",  60,   60             },
+};
+
+#define TF_RETRY_S  30                  // re-request a download after this
+
+// Decimated series of the focused token, one per downloaded timeframe
+typedef struct {
+    int      idx;                       // token, -1 = empty
+    int      count;
+    int64_t  fetched_s;                 // wall clock of the download
+    int64_t  requested_s;               // wall clock of the last request
+    price_t  v[CHART_W];
+} tf_cache_t;
+
+static chart_tf_t s_tf = TF_1D;
+static tf_cache_t s_tf_cache[TF_COUNT - 1] = {   // TF_1D is the live history
+    [0 ... TF_COUNT - 2] = { .idx = -1 },
+};
 
 // ── Side card widgets (marquee) ─────────────────────────────────────
 lv_obj_t *s_side_viewport;
@@ -77,6 +218,36 @@ static lv_obj_t *s_side_chg[SIDE_SLOTS];
 static int  s_side_coin[SIDE_SLOTS]; // crypto index shown on each slot
 static int  s_side_count;            // how many non-focused coins
 
+// Marquee cache: each card rendered once into an RGB565 tile, blitted
+// at the scroll offset by s_side_cache, so a marquee step copies rows
+// instead of re-rendering cards, logos and text. A step invalidates
+// only the viewport rows whose pixels change (rows are compared by
+// hash; card padding and gaps repeat). With PSRAM every card has a
+// tile; without it (the C6) the SIDE_TILES_MIN cards the viewport can
+// show share tiles in internal RAM, and a card is rendered as it
+// scrolls in. The live strip is parked below the viewport; a changed
+// card is re-rendered at most every SIDE_CACHE_MS.
+#define SIDE_CARD_H        (SIDE_ROW_H - 12)
+#define SIDE_TILES_MIN     3                 // cards a SIDE_H window can touch
+#define SIDE_CACHE_MS      1000
+#define SIDE_CACHE_RESERVE (96 * 1024)       // internal RAM left after the tiles
+
+typedef struct {
+    int           pos;                       // card in the cycle, -1 = none
+    bool          rendered;                  // buf holds card pos
+    bool          stale;                     // card pos changed since
+    lv_draw_buf_t buf;
+    uint32_t      row_hash[SIDE_CARD_H];     // never 0, the gap rows' hash
+} side_tile_t;
+
+static lv_obj_t   *s_side_cache;             // NULL: the live strip scrolls
+static side_tile_t s_side_tile[MAX_TOKENS - 1];
+static int         s_side_tiles;
+static int32_t     s_side_off;               // scroll offset into the cycle
+static uint32_t    s_side_shown[SIDE_H];     // row hashes on screen
+static bool        s_side_dirty;
+static bool        s_side_failed;            // a render failed mid-scroll
+static uint32_t    s_side_snap_tick;
 
 // ── Boot screen ────────────────────────────────────────────────────
 volatile bool s_ui_teardown = false;
@@ -99,6 +270,7 @@ void ui_boot_show(const char *msg, int progress_pct)
             return;
         }
 
+        disp_stats_set_screen(DISP_SCREEN_BOOT);
         lv_obj_t *scr = lv_screen_active();
         lv_obj_set_style_bg_color(scr, lv_color_hex(0x000000), 0);
         lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
@@ -111,9 +283,15 @@ void ui_boot_show(const char *msg, int progress_pct)
         lv_obj_set_style_pad_all(s_boot_scr, 0, 0);
         lv_obj_clear_flag(s_boot_scr, LV_OBJ_FLAG_SCROLLABLE);
 
+        const lv_image_dsc_t *boot_logo = assets_image("boot_logo");
+        if (!boot_logo) {
+            lvgl_port_unlock();   // no asset bundle: plain black boot screen
+            return;
+        }
+
         // Wrapper clips the shine effect to logo bounds
-        int logo_w = (int)boot_logo_dsc.header.w;
-        int logo_h = (int)boot_logo_dsc.header.h;
+        int logo_w = (int)boot_logo->header.w;
+        int logo_h = (int)boot_logo->header.h;
 
         lv_obj_t *wrap = lv_obj_create(s_boot_scr);
         lv_obj_set_size(wrap, logo_w, logo_h);
@@ -124,7 +302,7 @@ void ui_boot_show(const char *msg, int progress_pct)
         lv_obj_clear_flag(wrap, LV_OBJ_FLAG_SCROLLABLE);
 
         lv_obj_t *logo = lv_image_create(wrap);
-        lv_image_set_src(logo, &boot_logo_dsc);
+        lv_image_set_src(logo, boot_logo);
         lv_obj_set_pos(logo, 0, 0);
 
         // ── Glass shine: composite gradient beam ────────────────
@@ -198,15 +376,18 @@ void ui_boot_hide(void)
 }
 
 // ── Helpers ────────────────────────────────────────────────────────
-void format_price(char *buf, size_t len, double price)
+void format_price(char *buf, size_t len, price_t price)
 {
-    if (price < 1.0) {
-        snprintf(buf, len, "$%.5f", price);
+    int64_t whole;
+    int32_t frac;
+
+    if (price < PRICE_ONE) {
+        price_split(price, 5, &whole, &frac);
+        snprintf(buf, len, "$%d.%05ld", (int)whole, (long)frac);
         return;
     }
 
-    int whole = (int)price;
-    int frac  = (int)((price - whole) * 100 + 0.5) % 100;
+    price_split(price, 2, &whole, &frac);
 
     char ibuf[20];
     int pos = 0;
@@ -214,7 +395,7 @@ void format_price(char *buf, size_t len, double price)
     if (whole == 0) {
         ibuf[pos++] = '0';
     } else {
-        int tmp = whole;
+        int64_t tmp = whole;
         char raw[16];
         int rlen = 0;
         while (tmp > 0) {
@@ -231,53 +412,54 @@ void format_price(char *buf, size_t len, double price)
     }
     ibuf[pos] = '\0';
 
-    snprintf(buf, len, "$%s.%02d", ibuf, frac);
+    snprintf(buf, len, "$%s.%02ld", ibuf, (long)frac);
 }
 
-void format_compact_price(char *buf, size_t len, double price)
+void format_compact_price(char *buf, size_t len, price_t price)
 {
-    if (price >= 100000) {
-        snprintf(buf, len, "$%dk", (int)(price / 1000));
-    } else if (price >= 1000) {
-        snprintf(buf, len, "$%.2fk", price / 1000.0);
-    } else if (price >= 1.0) {
-        snprintf(buf, len, "$%.2f", price);
+    int64_t w;
+    int32_t f;
+
+    if (price >= PRICE_LIT(100000)) {
+        snprintf(buf, len, "$%dk", (int)price_to_units(price / 1000, 1));
+    } else if (price >= PRICE_LIT(1000)) {
+        price_split(price / 1000, 2, &w, &f);
+        snprintf(buf, len, "$%d.%02ldk", (int)w, (long)f);
+    } else if (price >= PRICE_ONE) {
+        price_split(price, 2, &w, &f);
+        snprintf(buf, len, "$%d.%02ld", (int)w, (long)f);
     } else {
-        snprintf(buf, len, "$%.4f", price);
+        price_split(price, 4, &w, &f);
+        snprintf(buf, len, "$%d.%04ld", (int)w, (long)f);
     }
 }
 
-void format_change(char *buf, size_t len, double pct)
+void format_change(char *buf, size_t len, price_t pct)
 {
     char sign = pct >= 0 ? '+' : '-';
-    double a = pct < 0 ? -pct : pct;
-    int w = (int)a;
-    int f = (int)(a * 100) % 100;
-    snprintf(buf, len, "%c%d.%02d%%", sign, w, f);
+    int64_t w;
+    int32_t f;
+    price_split(pct < 0 ? -pct : pct, 2, &w, &f);
+    snprintf(buf, len, "%c%d.%02ld%%", sign, (int)w, (long)f);
 }
 
-lv_color_t chg_color(double pct)
+lv_color_t chg_color(price_t pct)
 {
     return pct >= 0 ? lv_color_hex(0x00FF88) : lv_color_hex(0xFF3366);
 }
 
 // ── Logo image ─────────────────────────────────────────────────────
-#define LOGO_SRC_PX 36   // source image resolution from convert_to_lvgl.py
-
+// Logos are pre-scaled to each size (assets.h): drawn as plain blits
 static lv_obj_t *create_logo_img(lv_obj_t *parent, int size)
 {
     lv_obj_t *img = lv_image_create(parent);
-    lv_image_set_inner_align(img, LV_IMAGE_ALIGN_CENTER);
     lv_obj_set_size(img, size, size);
-    if (size != LOGO_SRC_PX) {
-        lv_image_set_scale(img, 256 * size / LOGO_SRC_PX);
-    }
     return img;
 }
 
-static void set_logo(lv_obj_t *img, const crypto_item_t *item)
+static void set_logo(lv_obj_t *img, const lv_image_dsc_t *logo)
 {
-    lv_image_set_src(img, item->logo);
+    lv_image_set_src(img, logo);
 }
 
 // ── Price flash animation ──────────────────────────────────────────
@@ -288,7 +470,7 @@ static void flash_reset_cb(lv_timer_t *timer)
     s_flash_timer = NULL;
 }
 
-static void flash_price(double old_price, double new_price)
+static void flash_price(price_t old_price, price_t new_price)
 {
     if (old_price <= 0 || old_price == new_price) return;
 
@@ -306,6 +488,35 @@ static void flash_price(double old_price, double new_price)
 }
 
 // ── Stale data check (runs every 5s via LVGL timer) ─────────────────
+/* Show how old the focused token's snapshot data is, until its first
+ * live update. Hidden while the clock is not synced yet. */
+static void stale_age_update(void)
+{
+    if (!s_stale_age) return;
+
+    time_t now;
+    time(&now);
+    int64_t saved = s_restored[s_focus_idx] ? s_restored_s[s_focus_idx] : 0;
+    // Both clocks synced: a snapshot saved before the first sync has no age
+    bool show = saved >= 1700000000 && (int64_t)now >= saved;
+
+    if (show) {
+        int64_t age = (int64_t)now - saved;
+        char buf[16];
+        if (age < 3600)           snprintf(buf, sizeof(buf), "%dm ago", (int)(age / 60));
+        else if (age < 2 * 86400) snprintf(buf, sizeof(buf), "%dh ago", (int)(age / 3600));
+        else                      snprintf(buf, sizeof(buf), "%dd ago", (int)(age / 86400));
+        // Called on every focused update: redraw only when the text moves on
+        if (strcmp(lv_label_get_text(s_stale_age), buf) != 0) {
+            lv_label_set_text(s_stale_age, buf);
+        }
+    }
+    if (show == lv_obj_has_flag(s_stale_age, LV_OBJ_FLAG_HIDDEN)) {
+        if (show) lv_obj_clear_flag(s_stale_age, LV_OBJ_FLAG_HIDDEN);
+        else      lv_obj_add_flag(s_stale_age, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
 static void stale_check_cb(lv_timer_t *timer)
 {
     (void)timer;
@@ -313,7 +524,8 @@ static void stale_check_cb(lv_timer_t *timer)
 
     time_t now;
     time(&now);
-    bool stale = (s_last_price_update_s > 0 &&
+    bool stale = s_restored[s_focus_idx] ||
+                 (s_last_price_update_s > 0 &&
                   (int64_t)now - s_last_price_update_s > STALE_THRESHOLD_S);
 
     if (stale && !s_stale_shown) {
@@ -325,113 +537,334 @@ static void stale_check_cb(lv_timer_t *timer)
         if (s_stale_dot) lv_obj_add_flag(s_stale_dot, LV_OBJ_FLAG_HIDDEN);
         lv_obj_set_style_text_opa(s_main_price, LV_OPA_COVER, 0);
     }
+    stale_age_update();
 }
 
 // ── Pill breathing animation ───────────────────────────────────────
 static void pill_breathe_cb(void *var, int32_t v)
 {
-    lv_obj_set_style_bg_opa((lv_obj_t *)var, (lv_opa_t)v, 0);
-    lv_obj_set_style_shadow_opa((lv_obj_t *)var, (lv_opa_t)(v / 2), 0);
+    glow_set_opa((lv_obj_t *)var, (lv_opa_t)v);
 }
 
-// ── Price scroll animation ─────────────────────────────────────────
-static void price_anim_cb(void *var, int32_t v)
+// ── Chart helpers ──────────────────────────────────────────────────
+#define CHART_INT_RANGE 10000
+#define CHART_SLOTS     (CHART_POINTS + 1)      // 1D: the history and the sweep gap
+
+static int32_t price_to_chart(price_t price, price_t lo, price_t range)
 {
-    (void)var;
-    char buf[24];
-    format_price(buf, sizeof(buf), (double)v / (double)s_price_scale);
-    lv_label_set_text(s_main_price, buf);
+    return price_map(price, lo, range, CHART_INT_RANGE);
 }
 
-// ── Chart helpers ──────────────────────────────────────────────────
-#define CHART_INT_RANGE 10000
+/* Fit the y scale to [min, max] plus 25% padding. */
+static void chart_scale(price_t min, price_t max)
+{
+    s_chart_min = min;
+    s_chart_max = max;
+    price_t range = s_chart_max - s_chart_min;
+    price_t pad = range / 4;
+    if (pad <= 0) pad = s_chart_min / 1000;
+    s_chart_lo = s_chart_min - pad;
+    s_chart_range = (s_chart_max + pad) - s_chart_lo;
+}
 
-static void chart_get_bounds(const crypto_item_t *item, int count,
-                             double *out_lo, double *out_hi)
+static void chart_set_points(int n)
 {
-    int start = CHART_POINTS - count;
-    if (start < 0) start = 0;
+    if (lv_chart_get_point_count(s_chart) != (uint32_t)n) lv_chart_set_point_count(s_chart, n);
+}
 
-    double lo = item->hist_raw[start], hi = lo;
-    for (int i = start + 1; i < CHART_POINTS; i++) {
-        if (item->hist_raw[i] < lo) lo = item->hist_raw[i];
-        if (item->hist_raw[i] > hi) hi = item->hist_raw[i];
+/* Live 1D history: one point per candle, drawn as a sweep. The slot at
+ * the series' write position is a gap with the newest point left of it
+ * and the oldest right of it (wrapping), so an append only rewrites the
+ * gap and the slot after it. */
+static void chart_fill_hist(int idx)
+{
+    const price_hist_t *h = &s_hist_copy;
+    crypto_get_hist(idx, &s_hist_copy);
+    chart_set_points(CHART_SLOTS);
+    int32_t *y = lv_chart_get_y_array(s_chart, s_chart_ser);
+    uint32_t gap = lv_chart_get_x_start_point(s_chart, s_chart_ser);
+    int count = h->count;
+    int empty = CHART_POINTS - count;
+
+    if (count >= 2) chart_scale(price_hist_min(h), price_hist_max(h));
+
+    y[gap] = LV_CHART_POINT_NONE;
+    for (int i = 0; i < CHART_POINTS; i++) {
+        int32_t v = LV_CHART_POINT_NONE;
+        if (count >= 2 && i >= empty) {
+            v = price_to_chart(price_hist_at(h, i - empty), s_chart_lo, s_chart_range);
+        }
+        y[(gap + 1 + i) % CHART_SLOTS] = v;
     }
-    *out_lo = lo;
-    *out_hi = hi;
+    s_chart_count = count;
 }
 
-static int32_t price_to_chart(double price, double lo, double range)
+/* Downloaded timeframe: the cached decimated series, empty until loaded. */
+static void chart_fill_tf(int idx)
 {
-    if (range <= 0) return CHART_INT_RANGE / 2;
-    return (int32_t)((price - lo) / range * CHART_INT_RANGE);
+    const tf_cache_t *c = &s_tf_cache[s_tf - 1];
+    int count = (c->idx == idx) ? c->count : 0;
+    int n = count >= 2 ? count : CHART_POINTS;
+    chart_set_points(n);
+    int32_t *y = lv_chart_get_y_array(s_chart, s_chart_ser);
+
+    if (count >= 2) {
+        price_t min = c->v[0], max = c->v[0];
+        for (int i = 1; i < count; i++) {
+            if (c->v[i] < min) min = c->v[i];
+            if (c->v[i] > max) max = c->v[i];
+        }
+        chart_scale(min, max);
+    }
+
+    // Circular mode draws from slot 0: oldest on the left
+    for (int i = 0; i < n; i++) {
+        y[i] = count >= 2
+            ? price_to_chart(c->v[i], s_chart_lo, s_chart_range)
+            : LV_CHART_POINT_NONE;
+    }
+    s_chart_count = 0;              // appends do not apply
 }
 
-static void chart_rebuild(int idx)
+/* Rewrite every point of the series in place. The series is only
+ * reallocated when the timeframe changes its point count. */
+static void chart_fill(int idx)
 {
-    const crypto_item_t *item = &g_crypto[idx];
-    int count = s_history_count[idx];
+    if (s_tf == TF_1D) chart_fill_hist(idx);
+    else               chart_fill_tf(idx);
+    s_chart_idx = idx;
+    lv_chart_refresh(s_chart);
+}
 
-    if (s_chart_ser) {
-        lv_chart_remove_series(s_chart, s_chart_ser);
-        s_chart_ser = NULL;
-    }
+static void chart_rebuild(int idx)
+{
+    price_t pct = crypto_get_quote(idx).change_pct;
 
     // Tint chart background with very faint green/red gradient
     lv_obj_set_style_bg_color(s_chart,
-        item->change_pct >= 0 ? lv_color_hex(0x0D1F10) : lv_color_hex(0x1F0D12), 0);
+        pct >= 0 ? lv_color_hex(0x0D1F10) : lv_color_hex(0x1F0D12), 0);
+
+    if (!s_chart_ser) {
+        lv_chart_set_range(s_chart, LV_CHART_AXIS_PRIMARY_Y, 0, CHART_INT_RANGE);
+        s_chart_ser = lv_chart_add_series(s_chart, chg_color(pct), LV_CHART_AXIS_PRIMARY_Y);
+    } else {
+        lv_chart_set_series_color(s_chart, s_chart_ser, chg_color(pct));
+    }
 
-    lv_chart_set_point_count(s_chart, CHART_POINTS);
-    s_chart_ser = lv_chart_add_series(s_chart, chg_color(item->change_pct),
-                                      LV_CHART_AXIS_PRIMARY_Y);
+    chart_fill(idx);
+}
 
-    if (count < 2) {
-        lv_chart_refresh(s_chart);
+/* A point was appended to idx's history: write it into the sweep gap
+ * when the scale still fits, otherwise rescale in place. */
+static void chart_add_point(int idx)
+{
+    if (s_tf != TF_1D) return;
+    const price_hist_t *h = &s_hist_copy;
+    crypto_get_hist(idx, &s_hist_copy);
+    if (h->count <= 1) return;
+
+    if (idx != s_chart_idx || !s_chart_ser || s_chart_count < 2 ||
+        price_hist_min(h) != s_chart_min || price_hist_max(h) != s_chart_max) {
+        chart_fill(idx);
         return;
     }
 
-    int start = CHART_POINTS - count;
-    if (start < 0) start = 0;
+    // In circular mode LVGL invalidates only the columns around each
+    // written slot: the new segment, and the oldest point becoming the gap
+    price_t newest = price_hist_at(h, h->count - 1);
+    lv_chart_set_next_value(s_chart, s_chart_ser,
+                            price_to_chart(newest, s_chart_lo, s_chart_range));
+    lv_chart_set_value_by_id(s_chart, s_chart_ser,
+                             lv_chart_get_x_start_point(s_chart, s_chart_ser),
+                             LV_CHART_POINT_NONE);
+    s_chart_count = h->count;
+}
 
-    double lo, hi;
-    chart_get_bounds(item, count, &lo, &hi);
-    double range = hi - lo;
-    double pad = range * 0.25;
-    if (pad <= 0) pad = lo * 0.001;
-    lo -= pad;
-    range = (hi + pad) - lo;
+/* Cache a timeframe series (at most CHART_W points) and redraw it if
+ * shown. Caller holds the LVGL lock. */
+static void tf_store(int idx, int tf, const price_t *v, int n, int64_t now)
+{
+    tf_cache_t *c = &s_tf_cache[tf - 1];
+    c->idx = idx;
+    c->count = n;
+    c->fetched_s = now;
+    memcpy(c->v, v, n * sizeof(v[0]));
+    if (idx == s_focus_idx && tf == s_tf && s_chart && !s_loading_overlay) {
+        chart_rebuild(idx);
+    }
+}
+
+/* 1H from the minute series when it holds nearly all of the last hour. */
+static bool tf_from_minutes(int idx, int64_t now)
+{
+    if (s_tf != TF_1H || !s_minute[idx].interval_s) return false;
+
+    int want = g_chart_tf[TF_1H].candles;
+    if (want > CHART_W) want = CHART_W;
+    price_t v[CHART_W];
+    int n = 0;
+    int64_t ts;
+    series_reader_t r;
+    price_series_seek(&r, &s_minutes[idx], candle_start(now, MINUTE_S) - (int64_t)want * MINUTE_S);
+    while (n < want && price_series_next(&r, &ts, &v[n])) n++;
+    if (n < want - MINUTE_FILL) return false;
+
+    tf_store(idx, TF_1H, v, n, now);
+    return true;
+}
 
-    lv_chart_set_range(s_chart, LV_CHART_AXIS_PRIMARY_Y, 0, CHART_INT_RANGE);
+/* Ask for the shown timeframe of idx unless its cached series is
+ * current or a request is already on its way. */
+static void tf_request(int idx)
+{
+    if (s_tf == TF_1D) return;
+    tf_cache_t *c = &s_tf_cache[s_tf - 1];
+    time_t now;
+    time(&now);
+    if (c->idx == idx && c->count >= 2 && now - c->fetched_s < g_chart_tf[s_tf].interval_s) return;
+    if (c->idx == idx && now - c->requested_s < TF_RETRY_S) return;
+    if (tf_from_minutes(idx, now)) return;
 
-    for (int i = start; i < CHART_POINTS; i++) {
-        lv_chart_set_next_value(s_chart, s_chart_ser,
-                                price_to_chart(item->hist_raw[i], lo, range));
+    if (c->idx != idx) {
+        c->idx = idx;
+        c->count = 0;               // another token's series is useless
     }
-    lv_chart_refresh(s_chart);
+    c->requested_s = now;
+    price_fetch_timeframe(idx, s_tf);
 }
 
-static void chart_add_point(int idx)
+static void update_tf_label(void)
+{
+    if (s_tf_label) lv_label_set_text(s_tf_label, g_chart_tf[s_tf].label);
+}
+
+void cycle_timeframe(void)
+{
+    if (s_animating || !s_chart) return;
+    s_tf = (s_tf + 1) % TF_COUNT;
+    tf_request(s_focus_idx);
+    update_tf_label();
+    chart_rebuild(s_focus_idx);
+}
+
+/* A candle closed: append it if it continues idx's history. Returns
+ * true if a point was added. */
+static bool chart_append_candle(int idx, const candle_t *c)
+{
+    int64_t candle_ts = crypto_get_candle_ts(idx);
+
+    // Pairs without loaded candles wait for the full history instead
+    if (candle_ts == 0 && g_crypto[idx].pair) return false;
+    if (candle_ts && c->start_s <= candle_ts) return false;   // already have it
+    if (candle_ts && c->start_s != candle_ts + CANDLE_INTERVAL_S) {
+        // Whole intervals without ticks: backfill them from Gate
+        price_fetch_reload_chart(idx);
+        return false;
+    }
+    crypto_push_candle(idx, c->close, c->start_s);
+    return true;
+}
+
+static void minute_push(int idx, int64_t ts_s, price_t p)
+{
+    if (price_series_append(&s_minutes[idx], ts_s, p)) {
+        hist_store_append(g_crypto[idx].symbol, ts_s, p);
+    }
+}
+
+/* Append a closed minute to idx's series and the flash history,
+ * bridging short tickless gaps with the previous close. Caller holds
+ * the LVGL lock. */
+static void minute_append(int idx, const candle_t *c)
+{
+    const price_series_t *s = &s_minutes[idx];
+    int64_t gap = c->start_s - s->next_s;
+    if (s->len && gap > 0 && gap <= MINUTE_FILL * MINUTE_S) {
+        for (int64_t t = s->next_s; t < c->start_s; t += MINUTE_S) {
+            minute_push(idx, t, s_minute_close[idx]);
+        }
+    }
+    minute_push(idx, c->start_s, c->close);
+    s_minute_close[idx] = c->close;
+}
+
+/* Note a tick in ev for the candles, as a one-tick partial candle. */
+static void chart_tick(price_t price, ui_event_t *ev)
+{
+    time_t now;
+    time(&now);
+    if (now < CANDLE_MIN_EPOCH) return;         // boundaries unknown
+
+    ev->span[0] = (candle_t) {
+        .start_s = candle_start(now, MINUTE_S),
+        .open = price, .high = price, .low = price, .close = price,
+        .ticks = 1,
+    };
+    ev->spans = 1;
+}
+
+/* Feed idx's queued ticks to its minute and chart candles (LVGL
+ * task); true if a closed chart candle added a point. */
+static bool chart_candles(int idx, const ui_event_t *ev)
+{
+    candle_agg_t *m = &s_minute[idx];
+    candle_agg_t *a = &s_candle[idx];
+    if (!m->interval_s) {
+        candle_agg_init(m, MINUTE_S);
+        price_series_init(&s_minutes[idx], s_minute_chunks[idx], MINUTE_CHUNKS, MINUTE_S);
+    }
+    if (!a->interval_s) candle_agg_init(a, CANDLE_INTERVAL_S);
+
+    bool point = false;
+    for (int k = 0; k < ev->spans; k++) {
+        candle_t done;
+        if (candle_agg_merge(m, &ev->span[k], &done)) minute_append(idx, &done);
+        if (candle_agg_merge(a, &ev->span[k], &done)) {
+            point |= chart_append_candle(idx, &done);
+        }
+    }
+    return point;
+}
+
+/* Close candles on their boundary even when no tick follows soon
+ * (background tokens without the push feed tick every 10 min). */
+static void candle_close_cb(lv_timer_t *timer)
 {
-    int count = s_history_count[idx];
-    if (count <= 1) return;
-    chart_rebuild(idx);
+    (void)timer;
+    time_t now;
+    time(&now);
+    if (now < CANDLE_MIN_EPOCH) return;
+
+    for (int i = 0; i < g_active_count; i++) {
+        candle_t done;
+        if (candle_agg_flush(&s_candle[i], now, &done) &&
+            chart_append_candle(i, &done) && i == s_focus_idx &&
+            s_chart && !s_loading_overlay) {
+            chart_add_point(i);
+        }
+        if (candle_agg_flush(&s_minute[i], now, &done)) minute_append(i, &done);
+    }
+
+    // Keep a downloaded timeframe as fresh as its candle interval
+    if (s_chart && !s_loading_overlay) tf_request(s_focus_idx);
 }
 
 // ── Side card marquee ───────────────────────────────────────────────
 static void update_one_side(int slot, int coin_idx)
 {
     const crypto_item_t *item = &g_crypto[coin_idx];
+    crypto_quote_t q = crypto_get_quote(coin_idx);
     char buf[24];
 
-    set_logo(s_side_logo[slot], item);
+    set_logo(s_side_logo[slot], item->logo->side);
     lv_label_set_text(s_side_sym[slot], item->symbol);
 
-    format_compact_price(buf, sizeof(buf), item->price);
-    lv_label_set_text(s_side_price[slot], buf);
+    format_compact_price(buf, sizeof(buf), q.price);
+    odometer_set_text(s_side_price[slot], buf);
 
-    format_change(buf, sizeof(buf), item->change_pct);
-    lv_label_set_text(s_side_chg[slot], buf);
-    lv_obj_set_style_text_color(s_side_chg[slot], chg_color(item->change_pct), 0);
+    format_change(buf, sizeof(buf), q.change_pct);
+    odometer_set_text(s_side_chg[slot], buf);
+    lv_obj_set_style_text_color(s_side_chg[slot], chg_color(q.change_pct), 0);
 
     s_side_coin[slot] = coin_idx;
 }
@@ -439,18 +872,28 @@ static void update_one_side(int slot, int coin_idx)
 // Container that holds all slot cards — we animate its Y to scroll
 static lv_obj_t *s_side_strip;
 
+static bool side_tiles_fill(int32_t off);
+static void side_cache_show(int32_t off, bool all);
+
 static void marquee_anim_cb(void *var, int32_t v)
 {
-    lv_obj_set_y((lv_obj_t *)var, v);
+    if (var == s_side_cache) {
+        // A failed render is handled by side_cache_sync(), outside the animation
+        if (!side_tiles_fill(-v)) s_side_failed = true;
+        side_cache_show(-v, false);
+    } else {
+        lv_obj_set_y((lv_obj_t *)var, v);
+    }
 }
 
 static void start_marquee(void);
+static void rebuild_side_coins(void);
 
 static void marquee_ready_cb(lv_anim_t *a)
 {
-    (void)a;
-    // Snap back and restart — seamless because duplicate card was at bottom
-    lv_obj_set_y(s_side_strip, 0);
+    // Snap back and restart — seamless because duplicate card was at
+    // bottom (the cached image tiles instead)
+    marquee_anim_cb(a->var, 0);
     start_marquee();
 }
 
@@ -463,11 +906,11 @@ static void start_marquee(void)
     // Duration: 3 seconds per card
     int duration = s_side_count * 3000;
 
-    lv_anim_delete(s_side_strip, marquee_anim_cb);
+    lv_anim_delete(NULL, marquee_anim_cb);
 
     lv_anim_t a;
     lv_anim_init(&a);
-    lv_anim_set_var(&a, s_side_strip);
+    lv_anim_set_var(&a, s_side_cache ? s_side_cache : s_side_strip);
     lv_anim_set_values(&a, 0, -scroll_dist);
     lv_anim_set_duration(&a, duration);
     lv_anim_set_exec_cb(&a, marquee_anim_cb);
@@ -476,6 +919,218 @@ static void start_marquee(void)
     lv_anim_start(&a);
 }
 
+/* Free the cache; the caller puts the live strip back. */
+static void side_cache_drop(void)
+{
+    lv_anim_delete(NULL, marquee_anim_cb);
+    if (s_side_cache) lv_obj_delete(s_side_cache);
+    s_side_cache = NULL;
+    for (int i = 0; i < s_side_tiles; i++) {
+        lv_image_cache_drop(&s_side_tile[i].buf);
+        heap_caps_free(s_side_tile[i].buf.data);
+        s_side_tile[i].buf.data = NULL;
+    }
+    s_side_tiles = 0;
+    s_side_failed = false;
+}
+
+static side_tile_t *side_tile_find(int pos)
+{
+    for (int i = 0; i < s_side_tiles; i++) {
+        if (s_side_tile[i].pos == pos) return &s_side_tile[i];
+    }
+    return NULL;
+}
+
+/* Render card pos (the parked strip's slot pos) into t. */
+static bool side_tile_render(side_tile_t *t)
+{
+    if (lv_snapshot_take_to_draw_buf(s_side_card[t->pos], LV_COLOR_FORMAT_RGB565,
+                                     &t->buf) != LV_RESULT_OK) {
+        ESP_LOGW(TAG, "Marquee snapshot failed, scrolling the cards live");
+        return false;
+    }
+    lv_image_cache_drop(&t->buf);
+    t->rendered = true;
+    t->stale = false;
+    for (int y = 0; y < SIDE_CARD_H; y++) {
+        const uint8_t *row = t->buf.data + y * t->buf.header.stride;
+        uint32_t h = 2166136261u;                               // FNV-1a
+        for (int x = 0; x < SIDE_W * 2; x++) h = (h ^ row[x]) * 16777619u;
+        t->row_hash[y] = h | 1;
+    }
+    return true;
+}
+
+/* Give every card in the window at off a rendered tile, reusing tiles
+ * of cards outside it. */
+static bool side_tiles_fill(int32_t off)
+{
+    int32_t first = off / SIDE_ROW_H;
+    int32_t last = (off + SIDE_H - 1) / SIDE_ROW_H;
+    uint32_t want = 0;
+    for (int32_t k = first; k <= last; k++) want |= 1u << (k % s_side_count);
+
+    for (int pos = 0; pos < s_side_count; pos++) {
+        if (!(want & (1u << pos))) continue;
+        side_tile_t *t = side_tile_find(pos);
+        for (int i = 0; !t && i < s_side_tiles; i++) {
+            side_tile_t *c = &s_side_tile[i];
+            if (c->pos < 0 || !(want & (1u << c->pos))) {
+                t = c;
+                t->pos = pos;
+                t->rendered = false;
+            }
+        }
+        if (t && (!t->rendered || t->stale) && !side_tile_render(t)) return false;
+    }
+    return true;
+}
+
+static uint32_t side_row_hash(int32_t r)
+{
+    int32_t y = r % SIDE_ROW_H;
+    if (y >= SIDE_CARD_H) return 0;
+    const side_tile_t *t = side_tile_find(r / SIDE_ROW_H % s_side_count);
+    return t && t->rendered ? t->row_hash[y] : 0;
+}
+
+/* Scroll to off, invalidating the rows whose pixels change (all of
+ * them when all is set). */
+static void side_cache_show(int32_t off, bool all)
+{
+    off %= s_side_count * SIDE_ROW_H;
+    s_side_off = off;
+
+    lv_area_t c;
+    lv_obj_get_coords(s_side_cache, &c);
+    int32_t run = -1;
+    for (int32_t y = 0; y <= SIDE_H; y++) {
+        bool changed = false;
+        if (y < SIDE_H) {
+            uint32_t h = side_row_hash(off + y);
+            changed = all || h != s_side_shown[y];
+            s_side_shown[y] = h;
+        }
+        if (changed && run < 0) {
+            run = y;
+        } else if (!changed && run >= 0) {
+            lv_area_t a = { c.x1, c.y1 + run, c.x2, c.y1 + y - 1 };
+            lv_obj_invalidate_area(s_side_cache, &a);
+            run = -1;
+        }
+    }
+}
+
+static void side_cache_draw_cb(lv_event_t *e)
+{
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_area_t c;
+    lv_obj_get_coords(s_side_cache, &c);
+
+    lv_draw_image_dsc_t img;
+    lv_draw_image_dsc_init(&img);
+    int32_t first = s_side_off / SIDE_ROW_H;
+    int32_t last = (s_side_off + SIDE_H - 1) / SIDE_ROW_H;
+    for (int32_t k = first; k <= last; k++) {
+        side_tile_t *t = side_tile_find(k % s_side_count);
+        if (!t || !t->rendered) continue;
+        lv_area_t a;
+        a.x1 = c.x1;
+        a.y1 = c.y1 + k * SIDE_ROW_H - s_side_off;
+        a.x2 = a.x1 + SIDE_W - 1;
+        a.y2 = a.y1 + SIDE_CARD_H - 1;
+        img.src = &t->buf;
+        lv_draw_image(layer, &img, &a);
+    }
+}
+
+/* Render every tile again from the parked strip, e.g. after the side
+ * coins changed. On failure the cache is dropped and false returned. */
+static bool side_cache_refresh(void)
+{
+    lv_obj_update_layout(s_side_strip);
+    for (int i = 0; i < s_side_tiles; i++) s_side_tile[i].stale = true;
+    if (!side_tiles_fill(s_side_off)) {
+        side_cache_drop();
+        return false;
+    }
+    side_cache_show(s_side_off, true);
+    s_side_dirty = false;
+    s_side_snap_tick = lv_tick_get();
+    return true;
+}
+
+/* Re-render changed cards in view (once per frame at most); the others
+ * are rendered when they scroll in. */
+static void side_cache_sync(void)
+{
+    if (!s_side_cache) return;
+    bool ok = !s_side_failed;
+    if (ok && s_side_dirty && lv_tick_elaps(s_side_snap_tick) >= SIDE_CACHE_MS) {
+        ok = side_tiles_fill(s_side_off);
+        if (ok) side_cache_show(s_side_off, false);
+        s_side_dirty = false;
+        s_side_snap_tick = lv_tick_get();
+    }
+    if (!ok) {
+        side_cache_drop();
+        rebuild_side_coins();       // the live strip, unparked
+    }
+}
+
+/* Card pos changed; its tile is drawn as it was until re-rendered. */
+static void side_cache_touch(int pos)
+{
+    side_tile_t *t = side_tile_find(pos);
+    if (!t) return;
+    t->stale = true;
+    s_side_dirty = true;
+}
+
+/* Allocate tiles for the g_active_count - 1 side cards: all of them in
+ * PSRAM, or the few the viewport can show in internal RAM while enough
+ * is left for TLS and the draw buffers. Without either the live strip
+ * scrolls as before. */
+static void side_cache_create(lv_obj_t *viewport)
+{
+    int count = g_active_count - 1;
+    if (count <= 0) return;
+
+    uint32_t stride = lv_draw_buf_width_to_stride(SIDE_W, LV_COLOR_FORMAT_RGB565);
+    uint32_t size = stride * SIDE_CARD_H;                       // 12 KB
+    uint32_t caps = MALLOC_CAP_SPIRAM;
+    int n = count;
+    if (heap_caps_get_free_size(MALLOC_CAP_SPIRAM) < size * n) {
+        caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+        n = count < SIDE_TILES_MIN ? count : SIDE_TILES_MIN;
+        if (heap_caps_get_free_size(caps) < size * n + SIDE_CACHE_RESERVE) {
+            ESP_LOGI(TAG, "No room for the marquee cache (%lu B), scrolling live",
+                     (unsigned long)(size * n));
+            return;
+        }
+    }
+
+    for (s_side_tiles = 0; s_side_tiles < n; s_side_tiles++) {
+        side_tile_t *t = &s_side_tile[s_side_tiles];
+        void *data = heap_caps_malloc(size, caps);
+        if (!data) {
+            side_cache_drop();
+            return;
+        }
+        lv_draw_buf_init(&t->buf, SIDE_W, SIDE_CARD_H, LV_COLOR_FORMAT_RGB565, stride, data, size);
+        t->pos = -1;
+        t->rendered = false;
+    }
+
+    s_side_cache = lv_obj_create(viewport);
+    lv_obj_remove_style_all(s_side_cache);
+    lv_obj_set_size(s_side_cache, SIDE_W, SIDE_H);
+    lv_obj_set_pos(s_side_cache, 0, 0);
+    lv_obj_clear_flag(s_side_cache, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(s_side_cache, side_cache_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+}
+
 static void rebuild_side_coins(void)
 {
     // Collect non-focused coin indices
@@ -502,6 +1157,17 @@ static void rebuild_side_coins(void)
         lv_obj_add_flag(s_side_card[i], LV_OBJ_FLAG_HIDDEN);
     }
 
+    if (s_side_cache) {
+        // One cycle, parked out of sight and rendered into the cache
+        lv_obj_set_height(s_side_strip, s_side_count * SIDE_ROW_H);
+        lv_obj_set_y(s_side_strip, SIDE_H);
+        s_side_off = 0;
+        if (side_cache_refresh()) {
+            start_marquee();
+            return;
+        }
+    }
+
     // Resize strip to fit all visible cards
     lv_obj_set_height(s_side_strip, total_slots * SIDE_ROW_H);
 
@@ -514,18 +1180,20 @@ static void rebuild_side_coins(void)
 static void update_main_labels(void)
 {
     const crypto_item_t *item = &g_crypto[s_focus_idx];
+    crypto_quote_t q = crypto_get_quote(s_focus_idx);
     char buf[24];
 
-    set_logo(s_main_logo, item);
+    set_logo(s_main_logo, item->logo->main);
     lv_label_set_text(s_main_sym, item->symbol);
 
-    format_price(buf, sizeof(buf), item->price);
-    lv_label_set_text(s_main_price, buf);
+    format_price(buf, sizeof(buf), q.price);
+    odometer_set_text(s_main_price, buf);
 
-    format_change(buf, sizeof(buf), item->change_pct);
+    format_change(buf, sizeof(buf), q.change_pct);
     lv_label_set_text(s_chg_label, buf);
-    lv_obj_set_style_bg_color(s_chg_pill, chg_color(item->change_pct), 0);
-    lv_obj_set_style_shadow_color(s_chg_pill, chg_color(item->change_pct), 0);
+    lv_obj_set_style_bg_color(s_chg_pill, chg_color(q.change_pct), 0);
+    lv_obj_set_style_shadow_color(s_chg_pill, chg_color(q.change_pct), 0);
+    stale_age_update();
 }
 
 // ── Coin switch ────────────────────────────────────────────────────
@@ -537,12 +1205,13 @@ static void switch_focus_by(int step)
 
     price_fetch_prioritize_chart(s_focus_idx);
     price_fetch_on_focus_change(s_focus_idx);
+    tf_request(s_focus_idx);
 
     update_main_labels();
     rebuild_side_coins();
     chart_rebuild(s_focus_idx);
 
-    led_set_market_mood(g_crypto[s_focus_idx].change_pct >= 0);
+    led_set_market_mood(crypto_get_quote(s_focus_idx).change_pct >= 0);
 
     s_animating = false;
 }
@@ -591,7 +1260,7 @@ static void create_main_panel(lv_obj_t *parent)
     lv_obj_clear_flag(s_main_panel, LV_OBJ_FLAG_SCROLLABLE);
 
     // ── Header (y=4): [Logo 32px] SYM (20pt) ─────────────────────
-    s_main_logo = create_logo_img(s_main_panel, 32);
+    s_main_logo = create_logo_img(s_main_panel, LOGO_MAIN_PX);
     lv_obj_set_pos(s_main_logo, MARGIN_H + 6, MARGIN_TOP);
 
     s_main_sym = lv_label_create(s_main_panel);
@@ -600,16 +1269,16 @@ static void create_main_panel(lv_obj_t *parent)
     lv_obj_set_pos(s_main_sym, MARGIN_H + 44, MARGIN_TOP + 5);
 
     // ── Price (y=42) ──────────────────────────────────────────────
-    s_main_price = lv_label_create(s_main_panel);
+    s_main_price = odometer_create(s_main_panel, &font_mono_24);
     lv_obj_set_style_text_color(s_main_price, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_text_font(s_main_price, &font_mono_24, 0);
+    lv_obj_set_style_bg_color(s_main_price, lv_color_hex(0x000000), 0);   // screen color
+    lv_obj_set_style_bg_opa(s_main_price, LV_OPA_COVER, 0);
     lv_obj_set_pos(s_main_price, MARGIN_H, 42);
 
     // ── Pill badge (header row, right of side cards) ────────────
     s_chg_pill = lv_obj_create(s_main_panel);
     lv_obj_set_size(s_chg_pill, LV_SIZE_CONTENT, PILL_H);
     lv_obj_set_style_radius(s_chg_pill, PILL_RADIUS, 0);
-    lv_obj_set_style_bg_opa(s_chg_pill, LV_OPA_COVER, 0);
     lv_obj_set_style_border_width(s_chg_pill, 0, 0);
     lv_obj_set_style_pad_left(s_chg_pill, 10, 0);
     lv_obj_set_style_pad_right(s_chg_pill, 10, 0);
@@ -617,6 +1286,7 @@ static void create_main_panel(lv_obj_t *parent)
     lv_obj_set_style_pad_bottom(s_chg_pill, 4, 0);
     lv_obj_set_style_shadow_width(s_chg_pill, 16, 0);
     lv_obj_set_style_shadow_spread(s_chg_pill, 2, 0);
+    glow_attach(s_chg_pill, LV_OPA_50);     // background and shadow breathe together
     lv_obj_clear_flag(s_chg_pill, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_align(s_chg_pill, LV_ALIGN_TOP_RIGHT,
                  -(MARGIN_H + SIDE_W + GAP),
@@ -645,7 +1315,8 @@ static void create_main_panel(lv_obj_t *parent)
     lv_obj_set_size(s_chart, chart_w, CHART_H);
     lv_obj_set_pos(s_chart, MARGIN_H, CHART_Y);
     lv_chart_set_type(s_chart, LV_CHART_TYPE_LINE);
-    lv_chart_set_point_count(s_chart, CHART_POINTS);
+    lv_chart_set_update_mode(s_chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_set_point_count(s_chart, CHART_SLOTS);
     lv_obj_set_style_bg_color(s_chart, lv_color_hex(0x0D0D1E), 0);
     lv_obj_set_style_bg_opa(s_chart, LV_OPA_COVER, 0);
     lv_obj_set_style_bg_grad_dir(s_chart, LV_GRAD_DIR_VER, 0);
@@ -658,6 +1329,13 @@ static void create_main_panel(lv_obj_t *parent)
     lv_obj_set_style_line_opa(s_chart, LV_OPA_COVER, LV_PART_ITEMS);
     lv_chart_set_div_line_count(s_chart, 0, 0);
     s_chart_ser = NULL;
+    s_chart_idx = -1;
+
+    s_tf_label = lv_label_create(s_main_panel);
+    lv_obj_set_style_text_color(s_tf_label, lv_color_hex(0x8A8A8A), 0);
+    lv_obj_set_style_text_font(s_tf_label, &font_mono_10, 0);
+    lv_obj_set_pos(s_tf_label, MARGIN_H + 6, CHART_Y + 4);
+    update_tf_label();
 
     // ── Stale indicator (small red dot, top-right of price) ─────
     s_stale_dot = lv_obj_create(s_main_panel);
@@ -669,6 +1347,15 @@ static void create_main_panel(lv_obj_t *parent)
     lv_obj_set_pos(s_stale_dot, MARGIN_H + 42 + 30, MARGIN_TOP + 2);
     lv_obj_add_flag(s_stale_dot, LV_OBJ_FLAG_HIDDEN);
     lv_obj_clear_flag(s_stale_dot, LV_OBJ_FLAG_SCROLLABLE);
+
+    s_stale_age = lv_label_create(s_main_panel);
+    lv_label_set_text(s_stale_age, "");
+    lv_obj_set_style_text_color(s_stale_age, lv_color_hex(0xFF3366), 0);
+    lv_obj_set_style_text_font(s_stale_age, &font_mono_10, 0);
+    lv_obj_set_style_text_align(s_stale_age, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_obj_set_width(s_stale_age, 60);
+    lv_obj_set_pos(s_stale_age, MARGIN_H + CHART_W - 6 - 60, CHART_Y + 4);
+    lv_obj_add_flag(s_stale_age, LV_OBJ_FLAG_HIDDEN);
 }
 
 static void create_side_cards(lv_obj_t *parent)
@@ -693,7 +1380,7 @@ static void create_side_cards(lv_obj_t *parent)
 
     for (int i = 0; i < SIDE_SLOTS; i++) {
         s_side_card[i] = lv_obj_create(s_side_strip);
-        lv_obj_set_size(s_side_card[i], SIDE_W, SIDE_ROW_H - 12);
+        lv_obj_set_size(s_side_card[i], SIDE_W, SIDE_CARD_H);
         lv_obj_set_pos(s_side_card[i], 0, i * SIDE_ROW_H);
         lv_obj_set_style_bg_color(s_side_card[i], lv_color_hex(0x0A0A14), 0);
         lv_obj_set_style_bg_opa(s_side_card[i], LV_OPA_COVER, 0);
@@ -706,7 +1393,7 @@ static void create_side_cards(lv_obj_t *parent)
         lv_obj_clear_flag(s_side_card[i], LV_OBJ_FLAG_SCROLLABLE);
 
         // Row 1: Logo + Symbol (top)
-        s_side_logo[i] = create_logo_img(s_side_card[i], 18);
+        s_side_logo[i] = create_logo_img(s_side_card[i], LOGO_SIDE_PX);
         lv_obj_align(s_side_logo[i], LV_ALIGN_TOP_LEFT, 0, 0);
 
         s_side_sym[i] = lv_label_create(s_side_card[i]);
@@ -715,157 +1402,246 @@ static void create_side_cards(lv_obj_t *parent)
         lv_obj_align(s_side_sym[i], LV_ALIGN_TOP_LEFT, 22, 1);
 
         // Row 2: Price (middle)
-        s_side_price[i] = lv_label_create(s_side_card[i]);
-        lv_label_set_long_mode(s_side_price[i], LV_LABEL_LONG_CLIP);
-        lv_obj_set_width(s_side_price[i], SIDE_W - 10);
+        s_side_price[i] = odometer_create(s_side_card[i], &font_mono_14);
         lv_obj_set_style_text_color(s_side_price[i], lv_color_hex(0xCCCCCC), 0);
-        lv_obj_set_style_text_font(s_side_price[i], &font_mono_14, 0);
+        lv_obj_set_style_bg_color(s_side_price[i], lv_color_hex(0x0A0A14), 0);   // card color
+        lv_obj_set_style_bg_opa(s_side_price[i], LV_OPA_COVER, 0);
         lv_obj_align(s_side_price[i], LV_ALIGN_LEFT_MID, 0, 0);
 
         // Row 3: Change % (bottom)
-        s_side_chg[i] = lv_label_create(s_side_card[i]);
-        lv_label_set_long_mode(s_side_chg[i], LV_LABEL_LONG_CLIP);
-        lv_obj_set_width(s_side_chg[i], SIDE_W - 10);
-        lv_obj_set_style_text_font(s_side_chg[i], &font_mono_14, 0);
+        s_side_chg[i] = odometer_create(s_side_card[i], &font_mono_14);
+        lv_obj_set_style_text_color(s_side_chg[i], chg_color(0), 0);
+        lv_obj_set_style_bg_color(s_side_chg[i], lv_color_hex(0x0A0A14), 0);
+        lv_obj_set_style_bg_opa(s_side_chg[i], LV_OPA_COVER, 0);
         lv_obj_align(s_side_chg[i], LV_ALIGN_BOTTOM_LEFT, 0, 0);
 
         s_side_coin[i] = -1;
     }
 
+    side_cache_create(s_side_viewport);
     rebuild_side_coins();
 }
 
-// ── Pre-fill chart history from candlestick data ────────────────────
-void ui_set_chart_history(int idx, const double *prices, int count)
+// ── Update queue ───────────────────────────────────────────────────
+// The fetch and push tasks never take the LVGL lock for a price: they
+// publish the quote and queue an event, and s_evt_timer applies the
+// queue once per frame. A token has at most one event queued, so a
+// burst of ticks costs one redraw per token and a frame never does
+// more than MAX_TOKENS of them.
+static portMUX_TYPE s_evt_lock = portMUX_INITIALIZER_UNLOCKED;
+static ui_event_t s_evt[MAX_TOKENS];
+static uint8_t    s_evt_order[MAX_TOKENS];  // queued tokens, oldest first
+static int        s_evt_len;
+static uint32_t   s_evt_queued;             // bit per queued token
+
+// Downloaded timeframe series go the same way: one slot per timeframe,
+// and a download not applied yet is replaced by a newer one
+typedef struct {
+    bool     pending;
+    int      idx;
+    int      count;
+    int64_t  fetched_s;
+    price_t  v[CHART_W];
+} tf_post_t;
+static tf_post_t s_tf_post[TF_COUNT - 1];
+
+/* Add a partial candle to e's ticks. Three minutes in one frame means
+ * the LVGL task stalled; the oldest minute's ticks are then dropped. */
+static void span_add(ui_event_t *e, const candle_t *c)
 {
-    if (idx < 0 || idx >= g_active_count) return;
-    if (count <= 0) return;
-    if (count > CHART_POINTS) count = CHART_POINTS;
-
-    int start = CHART_POINTS - count;
-    for (int i = 0; i < count; i++) {
-        g_crypto[idx].hist_raw[start + i] = prices[i];
+    candle_t *last = e->spans ? &e->span[e->spans - 1] : NULL;
+    if (last && c->start_s < last->start_s) return;     // late tick
+    if (last && c->start_s == last->start_s) {
+        candle_merge(last, c);
+        return;
     }
-    s_history_count[idx] = count;
-
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    s_last_chart_time[idx] = (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
-
-    ESP_LOGI(TAG, "Chart history loaded for idx=%d: %d points", idx, count);
+    if (e->spans == 2) {
+        e->span[0] = e->span[1];
+        e->spans = 1;
+    }
+    e->span[e->spans++] = *c;
+}
 
-    // Refresh chart if this is the focused coin and UI is ready
-    if (idx == s_focus_idx && s_main_panel && !s_loading_overlay) {
-        if (lvgl_port_lock(100)) {
-            chart_rebuild(idx);
-            lvgl_port_unlock();
-        }
+static void ui_post(int idx, const ui_event_t *ev)
+{
+    taskENTER_CRITICAL(&s_evt_lock);
+    ui_event_t *e = &s_evt[idx];
+    if (!(s_evt_queued & (1u << idx))) {
+        *e = *ev;
+        s_evt_order[s_evt_len++] = (uint8_t)idx;
+        s_evt_queued |= 1u << idx;
+    } else {
+        // old_price stays from the first event: the flash and the roll
+        // go from what is on screen to the newest price
+        e->chart_reload |= ev->chart_reload;
+        for (int k = 0; k < ev->spans; k++) span_add(e, &ev->span[k]);
     }
+    taskEXIT_CRITICAL(&s_evt_lock);
 }
 
-// ── Live price update (called from price_fetch task) ───────────────
-void ui_update_price(int idx, double price, double change_pct,
-                     double high_24h, double low_24h)
+static void ui_apply(int idx, const ui_event_t *ev)
 {
-    if (s_ui_teardown) return;
-    if (idx < 0 || idx >= g_active_count) return;
+    bool chart_point = chart_candles(idx, ev);
+    if (!s_main_panel) return;
 
-    double old_price = g_crypto[idx].price;
-
-    g_crypto[idx].price = price;
-    g_crypto[idx].change_pct = change_pct;
-    g_crypto[idx].high_24h = high_24h;
-    g_crypto[idx].low_24h = low_24h;
-
-    // Chart: throttle to one point per CHART_INTERVAL_MS (30 min)
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    int64_t now_ms = (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
-    bool add_chart = (now_ms - s_last_chart_time[idx] >= CHART_INTERVAL_MS);
-    if (add_chart) {
-        for (int i = 0; i < CHART_POINTS - 1; i++) {
-            g_crypto[idx].hist_raw[i] = g_crypto[idx].hist_raw[i + 1];
+    if (s_loading_overlay) {
+        for (int i = 0; i < g_active_count; i++) {
+            if (!s_price_loaded[i]) return;
         }
-        g_crypto[idx].hist_raw[CHART_POINTS - 1] = price;
-        if (s_history_count[idx] < CHART_POINTS) {
-            s_history_count[idx]++;
+        lv_obj_delete(s_loading_overlay);
+        s_loading_overlay = NULL;
+        lv_obj_clear_flag(s_main_panel, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(s_side_viewport, LV_OBJ_FLAG_HIDDEN);
+        update_main_labels();
+        rebuild_side_coins();
+        chart_rebuild(s_focus_idx);
+    }
+
+    for (int i = 0; i < SIDE_SLOTS; i++) {
+        if (s_side_coin[i] == idx) {
+            update_one_side(i, idx);
+            side_cache_touch(i);
         }
-        s_last_chart_time[idx] = now_ms;
     }
-    s_price_loaded[idx] = true;
 
-    // Update stale-data timestamp
-    time_t now_epoch;
-    time(&now_epoch);
-    s_last_price_update_s = (int64_t)now_epoch;
+    if (idx != s_focus_idx) return;
 
-    if (!s_main_panel) return;
+    crypto_quote_t q = crypto_get_quote(idx);
+    if (ev->old_price > 0) {
+        // The changed digits roll; update_main_labels() leaves the roll be
+        char buf[24];
+        format_price(buf, sizeof(buf), q.price);
+        odometer_roll_to(s_main_price, buf, 500);
+    }
+    update_main_labels();
+    if (ev->chart_reload) {
+        if (s_tf == TF_1D) chart_rebuild(idx);
+    } else if (chart_point) {
+        chart_add_point(idx);
+    }
+    flash_price(ev->old_price, q.price);
 
-    // Pre-compute outside lock to minimize lock hold time
-    bool is_focus = (idx == s_focus_idx);
-    bool need_anim = false;
-    int32_t old_val = 0, new_val = 0;
-    if (is_focus) {
-        int scale = (price < 1.0) ? 100000 : 100;
-        old_val = (int32_t)(old_price * scale);
-        new_val = (int32_t)(price * scale);
-        need_anim = (old_price > 0 && old_val != new_val);
-        s_price_scale = scale;
+    led_set_market_mood(q.change_pct >= 0);
+    if (ev->old_price > 0 && q.price != ev->old_price) {
+        led_flash_price(q.price > ev->old_price);
     }
+}
 
-    bool all_loaded = true;
-    if (s_loading_overlay) {
-        for (int i = 0; i < g_active_count; i++) {
-            if (!s_price_loaded[i]) { all_loaded = false; break; }
+/* Apply every queued event (LVGL timer, once per frame). */
+static void ui_drain_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    ui_event_t ev[MAX_TOKENS];
+    uint8_t order[MAX_TOKENS];
+
+    taskENTER_CRITICAL(&s_evt_lock);
+    int n = s_evt_len;
+    for (int i = 0; i < n; i++) {
+        order[i] = s_evt_order[i];
+        ev[i] = s_evt[order[i]];
+    }
+    s_evt_len = 0;
+    s_evt_queued = 0;
+    taskEXIT_CRITICAL(&s_evt_lock);
+
+    for (int i = 0; i < n; i++) ui_apply(order[i], &ev[i]);
+
+    static tf_post_t tf;                        // LVGL task only
+    for (int t = 0; t < TF_COUNT - 1; t++) {
+        taskENTER_CRITICAL(&s_evt_lock);
+        bool pending = s_tf_post[t].pending;
+        if (pending) {
+            tf = s_tf_post[t];
+            s_tf_post[t].pending = false;
         }
+        taskEXIT_CRITICAL(&s_evt_lock);
+        if (pending) tf_store(tf.idx, t + 1, tf.v, tf.count, tf.fetched_s);
     }
+    side_cache_sync();
+}
 
-    if (lvgl_port_lock(100)) {
-        if (s_loading_overlay && all_loaded) {
-            lv_obj_delete(s_loading_overlay);
-            s_loading_overlay = NULL;
-            lv_obj_clear_flag(s_main_panel, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_clear_flag(s_side_viewport, LV_OBJ_FLAG_HIDDEN);
-            update_main_labels();
-            rebuild_side_coins();
-            chart_rebuild(s_focus_idx);
-        }
+// ── Pre-fill chart history from candlestick data ────────────────────
+void ui_set_chart_history(int idx, const price_t *prices, int count, int64_t candle_ts)
+{
+    if (idx < 0 || idx >= g_active_count) return;
+    if (count <= 0) return;
 
-        if (is_focus && !s_loading_overlay) {
-            update_main_labels();
-        }
+    // Built aside and published in one write
+    static price_hist_t h;
+    price_hist_reset(&h);
+    for (int i = 0; i < count; i++) {
+        price_hist_push(&h, prices[i]);   // keeps the newest CHART_POINTS
+    }
+    crypto_set_hist(idx, &h, candle_ts);
 
-        for (int i = 0; i < SIDE_SLOTS; i++) {
-            if (s_side_coin[i] == idx) {
-                update_one_side(i, idx);
-            }
-        }
+    ESP_LOGI(TAG, "Chart history loaded for idx=%d: %d points", idx, h.count);
 
-        if (is_focus) {
-            if (add_chart) chart_add_point(idx);
-            flash_price(old_price, price);
-            if (need_anim) {
-                lv_anim_t a;
-                lv_anim_init(&a);
-                lv_anim_set_var(&a, s_main_price);
-                lv_anim_set_values(&a, old_val, new_val);
-                lv_anim_set_duration(&a, 500);
-                lv_anim_set_exec_cb(&a, price_anim_cb);
-                lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
-                lv_anim_start(&a);
-                price_anim_cb(NULL, old_val);
-            }
-        }
+    // Redrawn by the next frame if this is the charted coin
+    ui_event_t ev = { .old_price = crypto_get_quote(idx).price, .chart_reload = true };
+    ui_post(idx, &ev);
+}
 
-        lvgl_port_unlock();
-    }
+// ── Timeframe series (called from price_fetch background worker) ───
+void ui_set_tf_history(int idx, int tf, const price_t *prices, int count)
+{
+    if (s_ui_teardown) return;
+    if (idx < 0 || idx >= g_active_count) return;
+    if (tf <= TF_1D || tf >= TF_COUNT || count <= 0) return;
 
-    if (is_focus) {
-        led_set_market_mood(change_pct >= 0);
-        if (old_price > 0 && price != old_price) {
-            led_flash_price(price > old_price);
-        }
-    }
+    price_t v[CHART_W];
+    int n = price_lttb(prices, count, v, CHART_W);
+    time_t now;
+    time(&now);
+
+    // Stored and redrawn by the next frame
+    taskENTER_CRITICAL(&s_evt_lock);
+    tf_post_t *p = &s_tf_post[tf - 1];
+    p->idx = idx;
+    p->count = n;
+    p->fetched_s = now;
+    memcpy(p->v, v, n * sizeof(v[0]));
+    p->pending = true;
+    taskEXIT_CRITICAL(&s_evt_lock);
+
+    ESP_LOGI(TAG, "%s chart for idx=%d: %d candles -> %d points",
+             g_chart_tf[tf].label, idx, count, n);
+}
+
+// ── Warm-boot restore (called from snapshot_restore) ───────────────
+void ui_restore_price(int idx, price_t price, price_t change_pct,
+                      price_t high_24h, price_t low_24h, int64_t saved_s)
+{
+    if (idx < 0 || idx >= g_active_count) return;
+
+    crypto_quote_t q = { price, change_pct, high_24h, low_24h };
+    crypto_set_quote(idx, &q);
+    s_price_loaded[idx] = true;
+    s_restored[idx] = true;
+    s_restored_s[idx] = saved_s;
+}
+
+// ── Live price update (called from price_fetch task) ───────────────
+void ui_update_price(int idx, price_t price, price_t change_pct,
+                     price_t high_24h, price_t low_24h)
+{
+    if (s_ui_teardown) return;
+    if (idx < 0 || idx >= g_active_count) return;
+
+    ui_event_t ev = { .old_price = crypto_get_quote(idx).price };
+
+    crypto_quote_t q = { price, change_pct, high_24h, low_24h };
+    crypto_set_quote(idx, &q);
+
+    chart_tick(price, &ev);
+    s_price_loaded[idx] = true;
+    s_restored[idx] = false;
+
+    // Update stale-data timestamp
+    time_t now_epoch;
+    time(&now_epoch);
+    s_last_price_update_s = (int64_t)now_epoch;
+
+    ui_post(idx, &ev);
 }
 
 // ── Public API ─────────────────────────────────────────────────────
@@ -875,6 +1651,7 @@ void ui_init(void)
 
     lvgl_port_lock(0);
 
+    disp_stats_set_screen(DISP_SCREEN_MAIN);
     lv_obj_t *scr = lv_screen_active();
     lv_obj_set_style_bg_color(scr, lv_color_hex(0x000000), 0);
     lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
@@ -932,8 +1709,22 @@ void ui_init(void)
         lv_obj_align(loading_lbl, LV_ALIGN_CENTER, 0, 20);
     }
 
-    // Stale data check timer (every 5s)
+    // Stale data check timer (every 5s); run once now so restored
+    // snapshot data is marked from the first frame
     s_stale_timer = lv_timer_create(stale_check_cb, 5000, NULL);
+    stale_check_cb(NULL);
+
+    // Candle boundary check (every 5s)
+    s_candle_timer = lv_timer_create(candle_close_cb, 5000, NULL);
+
+    // Queued price updates, applied once per frame
+    s_evt_timer = lv_timer_create(ui_drain_cb, LV_DEF_REFR_PERIOD, NULL);
+
+#ifdef PRICE_BENCH
+    odometer_bench_run(&font_mono_24);
+    glyph_atlas_bench_run(s_main_price);
+    glow_bench_run(s_chg_pill);
+#endif
 
     lvgl_port_unlock();
 
@@ -963,10 +1754,18 @@ void ui_cleanup(void)
             lv_timer_delete(s_stale_timer);
             s_stale_timer = NULL;
         }
+        if (s_candle_timer) {
+            lv_timer_delete(s_candle_timer);
+            s_candle_timer = NULL;
+        }
+        if (s_evt_timer) {
+            lv_timer_delete(s_evt_timer);
+            s_evt_timer = NULL;
+        }
         lv_anim_delete(s_main_price, NULL);
         lv_anim_delete(s_chg_pill, NULL);
         lv_anim_delete(s_main_panel, NULL);
-        if (s_side_strip) lv_anim_delete(s_side_strip, marquee_anim_cb);
+        lv_anim_delete(NULL, marquee_anim_cb);
 
         lv_obj_t *scr = lv_screen_active();
         lv_obj_clean(scr);
@@ -979,10 +1778,15 @@ void ui_cleanup(void)
         s_chg_pill = NULL;
         s_chg_label = NULL;
         s_stale_dot = NULL;
+        s_stale_age = NULL;
         s_chart = NULL;
         s_chart_ser = NULL;
+        s_chart_idx = -1;
+        s_tf_label = NULL;
         s_side_viewport = NULL;
         s_side_strip = NULL;
+        s_side_cache = NULL;
+        side_cache_drop();          // the tiles
         for (int i = 0; i < SIDE_SLOTS; i++) {
             s_side_card[i] = NULL;
             s_side_logo[i] = NULL;
@@ -1005,6 +1809,7 @@ void ui_cleanup(void)
 void ui_show_wifi_config(void)
 {
     if (lvgl_port_lock(0)) {
+        disp_stats_set_screen(DISP_SCREEN_SETUP);
         lv_obj_t *scr = lv_screen_active();
         lv_obj_set_style_bg_color(scr, lv_color_hex(0x000000), 0);
         lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "price.h"
+
 /**
  * Show boot/loading screen with logo and progress bar.
  * Call after display_init(). Updates text/progress if already showing.
@@ -20,17 +22,35 @@ void ui_boot_hide(void);
 /**
  * Update price data for a crypto item.
  * idx: 0=BTC, 1=ETH, 2=PAXG
- * Thread-safe (acquires LVGL lock internally).
+ * Thread-safe and never takes the LVGL lock: the data is published and
+ * the widgets are redrawn by the next frame. Several updates of a token
+ * within one frame are drawn once.
  */
-void ui_update_price(int idx, double price, double change_pct,
-                     double high_24h, double low_24h);
+void ui_update_price(int idx, price_t price, price_t change_pct,
+                     price_t high_24h, price_t low_24h);
 
 /**
  * Pre-fill chart history with candlestick close prices.
- * prices[] should be in chronological order (oldest first).
+ * prices[] should be in chronological order (oldest first), one per
+ * closed candle; candle_ts is the start of the newest one.
+ */
+void ui_set_chart_history(int idx, const price_t *prices, int count, int64_t candle_ts);
+
+/**
+ * Candle close prices of chart timeframe tf (chart_tf_t), oldest first.
+ * Decimated to the chart width and cached for the focused token.
+ */
+void ui_set_tf_history(int idx, int tf, const price_t *prices, int count);
+
+/**
+ * Seed a token with data restored from the warm-boot snapshot.
+ * Counts as loaded (no loading overlay) but is marked stale until the
+ * token's first live update; saved_s (epoch s, 0 if unknown) is when the
+ * snapshot was written, shown as the data's age once the clock is synced.
  * Called during boot before ui_init().
  */
-void ui_set_chart_history(int idx, const double *prices, int count);
+void ui_restore_price(int idx, price_t price, price_t change_pct,
+                      price_t high_24h, price_t low_24h, int64_t saved_s);
 
 /**
  * Create the TokenTicker UI using LVGL.
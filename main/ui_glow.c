@@ -0,0 +1,240 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "ui_glow.h"
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include <string.h>
+
+static const char *TAG = "glow";
+
+// What the bitmap was rendered from; memset first, compared with memcmp
+typedef struct {
+    int32_t    w;
+    int32_t    h;
+    int32_t    radius;
+    int32_t    shadow_w;
+    int32_t    shadow_spread;
+    lv_color_t bg;
+    lv_color_t shadow;
+} glow_key_t;
+
+typedef struct {
+    lv_opa_t   opa;
+    lv_opa_t   shadow_opa;    // relative to the background
+    glow_key_t key;           // of the bitmap, or of the failed attempt
+    void      *data;          // NULL = no bitmap
+    lv_draw_buf_t buf;
+} glow_t;
+
+static bool s_enabled = true;
+
+static glow_t *glow_get(lv_obj_t *obj)
+{
+    return (glow_t *)lv_obj_get_user_data(obj);
+}
+
+static void read_key(lv_obj_t *obj, glow_key_t *k)
+{
+    memset(k, 0, sizeof(*k));
+    k->w = lv_obj_get_width(obj);
+    k->h = lv_obj_get_height(obj);
+    k->radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    k->shadow_w = lv_obj_get_style_shadow_width(obj, LV_PART_MAIN);
+    k->shadow_spread = lv_obj_get_style_shadow_spread(obj, LV_PART_MAIN);
+    k->bg = lv_obj_get_style_bg_color(obj, LV_PART_MAIN);
+    k->shadow = lv_obj_get_style_shadow_color(obj, LV_PART_MAIN);
+}
+
+/* How far the shadow reaches past the object, as LVGL reckons it. */
+static int32_t glow_ext(const glow_key_t *k)
+{
+    return k->shadow_w ? k->shadow_w / 2 + 1 + k->shadow_spread : 0;
+}
+
+static void init_rect_dsc(lv_draw_rect_dsc_t *dsc, const glow_key_t *k,
+                          lv_opa_t opa, lv_opa_t shadow_opa)
+{
+    lv_draw_rect_dsc_init(dsc);
+    dsc->radius = k->radius;
+    dsc->bg_color = k->bg;
+    dsc->bg_opa = opa;
+    dsc->shadow_color = k->shadow;
+    dsc->shadow_width = k->shadow_w;
+    dsc->shadow_spread = k->shadow_spread;
+    dsc->shadow_opa = shadow_opa;
+}
+
+static void glow_free(glow_t *g)
+{
+    if (!g->data) return;
+    lv_image_cache_drop(&g->buf);
+    heap_caps_free(g->data);
+    g->data = NULL;
+}
+
+/* Render the background and shadow at full glow into an ARGB8888
+ * bitmap through a throwaway canvas. */
+static void glow_render(glow_t *g)
+{
+    glow_free(g);
+    const glow_key_t *k = &g->key;
+    if (k->w <= 0 || k->h <= 0) return;
+
+    int32_t ext = glow_ext(k);
+    int32_t w = k->w + 2 * ext;
+    int32_t h = k->h + 2 * ext;
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_ARGB8888);
+    uint32_t size = stride * h;
+    // Internal RAM when there is room: it is read on every breathing frame
+    g->data = heap_caps_malloc_prefer(size, 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+                                      MALLOC_CAP_DEFAULT);
+    if (!g->data) {
+        ESP_LOGW(TAG, "No memory for a %lu B glow, drawing it live", (unsigned long)size);
+        return;
+    }
+    lv_draw_buf_init(&g->buf, w, h, LV_COLOR_FORMAT_ARGB8888, stride, g->data, size);
+
+    lv_obj_t *canvas = lv_canvas_create(lv_layer_top());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_draw_buf(canvas, &g->buf);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_TRANSP);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_rect_dsc_t dsc;
+    init_rect_dsc(&dsc, k, LV_OPA_COVER, g->shadow_opa);
+    lv_area_t area = { ext, ext, ext + k->w - 1, ext + k->h - 1 };
+    lv_draw_rect(&layer, &dsc, &area);
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_obj_delete(canvas);
+}
+
+// ── Events ─────────────────────────────────────────────────────────
+static void draw_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    glow_t *g = glow_get(obj);
+    if (g->opa <= LV_OPA_MIN) return;
+
+    lv_layer_t *layer = lv_event_get_layer(e);
+    glow_key_t k;
+    read_key(obj, &k);
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+
+    if (s_enabled && g->data && memcmp(&k, &g->key, sizeof(k)) == 0) {
+        int32_t ext = glow_ext(&k);
+        lv_area_increase(&coords, ext, ext);
+        lv_draw_image_dsc_t img;
+        lv_draw_image_dsc_init(&img);
+        img.src = &g->buf;
+        img.opa = g->opa;
+        lv_draw_image(layer, &img, &coords);
+        return;
+    }
+
+    // Styles changed since the last render (or no bitmap): draw it live
+    lv_draw_rect_dsc_t dsc;
+    init_rect_dsc(&dsc, &k, g->opa, LV_OPA_MIX2(g->opa, g->shadow_opa));
+    lv_draw_rect(layer, &dsc, &coords);
+}
+
+static void ext_draw_size_cb(lv_event_t *e)
+{
+    glow_key_t k;
+    read_key(lv_event_get_current_target(e), &k);
+    lv_event_set_ext_draw_size(e, glow_ext(&k));
+}
+
+static void delete_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    glow_free(glow_get(obj));
+    lv_free(glow_get(obj));
+    lv_obj_set_user_data(obj, NULL);
+}
+
+// ── API ────────────────────────────────────────────────────────────
+void glow_attach(lv_obj_t *obj, lv_opa_t shadow_opa)
+{
+    glow_t *g = lv_malloc_zeroed(sizeof(*g));
+    LV_ASSERT_MALLOC(g);
+    g->opa = LV_OPA_COVER;
+    g->shadow_opa = shadow_opa;
+
+    lv_obj_set_user_data(obj, g);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_shadow_opa(obj, LV_OPA_TRANSP, 0);
+    // Before the object's own drawing, so it and its children go on top
+    lv_obj_add_event_cb(obj, draw_cb, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    lv_obj_add_event_cb(obj, ext_draw_size_cb, LV_EVENT_REFR_EXT_DRAW_SIZE, NULL);
+    lv_obj_add_event_cb(obj, delete_cb, LV_EVENT_DELETE, NULL);
+    lv_obj_refresh_ext_draw_size(obj);
+}
+
+void glow_set_opa(lv_obj_t *obj, lv_opa_t opa)
+{
+    glow_t *g = glow_get(obj);
+    if (s_enabled) {
+        glow_key_t k;
+        read_key(obj, &k);
+        if (memcmp(&k, &g->key, sizeof(k)) != 0) {
+            g->key = k;             // a failed render is not retried every frame
+            glow_render(g);
+        }
+    }
+
+    if (opa == g->opa) return;
+    g->opa = opa;
+    lv_obj_invalidate(obj);
+}
+
+// ── Benchmark (-DPRICE_BENCH) ──────────────────────────────────────
+#ifdef PRICE_BENCH
+
+#include "esp_timer.h"
+
+#include <stdio.h>
+
+#define BENCH_FRAMES  (1500 / LV_DEF_REFR_PERIOD)    // one breath in
+
+static int64_t bench_breath(lv_obj_t *obj)
+{
+    int64_t us = 0;
+    for (int f = 1; f <= BENCH_FRAMES; f++) {
+        glow_set_opa(obj, (lv_opa_t)(LV_OPA_COVER * f / BENCH_FRAMES));
+        int64_t t0 = esp_timer_get_time();
+        lv_refr_now(NULL);
+        us += esp_timer_get_time() - t0;
+    }
+    return us / BENCH_FRAMES;
+}
+
+void glow_bench_run(lv_obj_t *obj)
+{
+    glow_t *g = glow_get(obj);
+    lv_opa_t opa = g->opa;
+    lv_obj_t *parent = lv_obj_get_parent(obj);
+    bool hidden = lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(parent, LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(NULL);
+
+    s_enabled = false;
+    int64_t live = bench_breath(obj);
+    s_enabled = true;
+    int64_t cached = bench_breath(obj);
+
+    printf("%s: Breathing frame %lld -> %lld us (live shadow -> cached %ldx%ld glow)\n",
+           TAG, live, cached, (long)g->buf.header.w, (long)g->buf.header.h);
+
+    if (hidden) lv_obj_add_flag(parent, LV_OBJ_FLAG_HIDDEN);
+    glow_set_opa(obj, opa);
+    lv_refr_now(NULL);
+}
+
+#endif
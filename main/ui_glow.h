@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "lvgl.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * A breathing glow: an object's background and blurred shadow drawn
+ * from a bitmap rendered once, blitted at the glow's opacity. Animating
+ * bg_opa and shadow_opa instead makes LVGL blur the shadow again on
+ * every frame.
+ *
+ * The glow takes its shape and colors from the object's bg_color,
+ * radius, shadow_color, shadow_width and shadow_spread styles; the
+ * bitmap is re-rendered when one of them or the object's size changes.
+ * Until it is (or without the memory for it) the glow is drawn live.
+ */
+
+/**
+ * Draw obj's background and shadow as a glow from now on. shadow_opa
+ * is the shadow's opacity relative to the background. Sets obj's
+ * bg_opa and shadow_opa styles to transparent; leave them so.
+ */
+void glow_attach(lv_obj_t *obj, lv_opa_t shadow_opa);
+
+/**
+ * Set the glow's opacity (the background's; the shadow follows) and
+ * re-render the bitmap if the styles changed. Call outside rendering,
+ * e.g. from an animation, with the LVGL lock.
+ */
+void glow_set_opa(lv_obj_t *obj, lv_opa_t opa);
+
+#ifdef PRICE_BENCH
+/**
+ * Step obj's glow through one breath drawn live and from the bitmap,
+ * and log the average refresh time per frame of each. Call with the
+ * LVGL lock held.
+ */
+void glow_bench_run(lv_obj_t *obj);
+#endif
@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "ui_glyph_atlas.h"
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "glyph_atlas";
+
+// In use: main price (one color at a time), side prices, side changes
+// (green and red); idle ones keep the price's flash colors warm
+#define ATLAS_SLOTS  6
+#define ATLAS_CELLS  ((int32_t)sizeof(GLYPH_ATLAS_ALPHABET) - 1)
+
+// Internal RAM for all atlases, in use or idle. The atlases in use take
+// about 28 KB; what is left keeps one idle 24 px atlas (~14 KB). Past
+// it, idle atlases are freed oldest first, and a new one that still
+// does not fit is not made: its text is drawn as labels.
+#define ATLAS_BUDGET  (48 * 1024)
+
+struct glyph_atlas {
+    const lv_font_t *font;
+    int32_t      cell_w;
+    int32_t      cell_h;
+    lv_color_t   fg;
+    lv_color_t   bg;
+    lv_opa_t     opa;
+    uint16_t     refs;
+    uint32_t     used;        // lv_tick of the last get, for eviction
+    void        *data;        // NULL = free slot
+    lv_draw_buf_t buf;
+};
+
+static glyph_atlas_t s_atlas[ATLAS_SLOTS];
+static uint32_t s_bytes;            // allocated by all atlases
+static bool s_enabled = true;
+
+static uint32_t atlas_bytes(int32_t cell_w, int32_t cell_h)
+{
+    return lv_draw_buf_width_to_stride(ATLAS_CELLS * cell_w, LV_COLOR_FORMAT_RGB565) * cell_h;
+}
+
+static void atlas_free(glyph_atlas_t *a)
+{
+    if (!a->data) return;
+    lv_image_cache_drop(&a->buf);
+    heap_caps_free(a->data);
+    a->data = NULL;
+    s_bytes -= a->buf.data_size;
+}
+
+/* Free idle atlases, least recently used first, until need more bytes
+ * fit in the budget. */
+static void atlas_trim(uint32_t need)
+{
+    while (s_bytes + need > ATLAS_BUDGET) {
+        glyph_atlas_t *lru = NULL;
+        for (int i = 0; i < ATLAS_SLOTS; i++) {
+            glyph_atlas_t *a = &s_atlas[i];
+            if (a->data && !a->refs && (!lru || a->used < lru->used)) lru = a;
+        }
+        if (!lru) return;
+        atlas_free(lru);
+    }
+}
+
+/* Rasterize the alphabet into a->buf through a throwaway canvas. */
+static bool atlas_render(glyph_atlas_t *a)
+{
+    int32_t w = ATLAS_CELLS * a->cell_w;
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    uint32_t size = atlas_bytes(a->cell_w, a->cell_h);
+    // Internal RAM when there is room: the blits read it every frame
+    a->data = heap_caps_malloc_prefer(size, 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+                                      MALLOC_CAP_DEFAULT);
+    if (!a->data) {
+        ESP_LOGW(TAG, "No memory for a %lu B atlas", (unsigned long)size);
+        return false;
+    }
+    lv_draw_buf_init(&a->buf, w, a->cell_h, LV_COLOR_FORMAT_RGB565, stride, a->data, size);
+    s_bytes += size;
+
+    lv_obj_t *canvas = lv_canvas_create(lv_layer_top());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_draw_buf(canvas, &a->buf);
+    lv_canvas_fill_bg(canvas, a->bg, LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font = a->font;
+    dsc.color = a->fg;
+    dsc.opa = a->opa;
+    dsc.text_local = 1;
+    for (int32_t i = 0; i < ATLAS_CELLS; i++) {
+        char s[2] = { GLYPH_ATLAS_ALPHABET[i], '\0' };
+        lv_area_t cell = { i * a->cell_w, 0, (i + 1) * a->cell_w - 1, a->cell_h - 1 };
+        layer._clip_area = cell;        // keep overhanging glyphs in their cell
+        dsc.text = s;
+        lv_draw_label(&layer, &dsc, &cell);
+    }
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_obj_delete(canvas);
+    return true;
+}
+
+glyph_atlas_t *glyph_atlas_get(const lv_font_t *font, int32_t cell_w, int32_t cell_h,
+                               lv_color_t fg, lv_opa_t opa, lv_color_t bg)
+{
+    glyph_atlas_t *victim = NULL;
+    for (int i = 0; i < ATLAS_SLOTS; i++) {
+        glyph_atlas_t *a = &s_atlas[i];
+        if (a->data && a->font == font && a->cell_w == cell_w && a->cell_h == cell_h &&
+            lv_color_eq(a->fg, fg) && a->opa == opa && lv_color_eq(a->bg, bg)) {
+            a->refs++;
+            a->used = lv_tick_get();
+            return a;
+        }
+        // Prefer an empty slot, then the least recently used idle one
+        if (a->refs) continue;
+        if (!victim || (victim->data && (!a->data || a->used < victim->used))) victim = a;
+    }
+    if (!victim) return NULL;
+
+    atlas_free(victim);
+    *victim = (glyph_atlas_t) {
+        .font = font, .cell_w = cell_w, .cell_h = cell_h,
+        .fg = fg, .bg = bg, .opa = opa,
+    };
+    uint32_t size = atlas_bytes(cell_w, cell_h);
+    atlas_trim(size);
+    if (s_bytes + size > ATLAS_BUDGET) return NULL;
+    if (!atlas_render(victim)) return NULL;
+    victim->refs = 1;
+    victim->used = lv_tick_get();
+    return victim;
+}
+
+void glyph_atlas_release(glyph_atlas_t *atlas)
+{
+    if (atlas && atlas->refs) atlas->refs--;
+}
+
+bool glyph_atlas_draw(lv_layer_t *layer, const glyph_atlas_t *a,
+                      const lv_draw_label_dsc_t *dsc, const lv_area_t *cell,
+                      char c, int32_t dy)
+{
+    const char *p = c ? strchr(GLYPH_ATLAS_ALPHABET, c) : NULL;
+    if (!s_enabled || !p || dsc->font != a->font ||
+        !lv_color_eq(dsc->color, a->fg) || dsc->opa != a->opa) {
+        return false;
+    }
+
+    lv_area_t clip = layer->_clip_area;
+    lv_area_t vis;
+    if (!lv_area_intersect(&vis, &clip, cell)) return true;
+
+    // The whole strip, shifted so that c's cell lands on cell
+    int32_t x = cell->x1 - (int32_t)(p - GLYPH_ATLAS_ALPHABET) * a->cell_w;
+    lv_area_t coords = { x, cell->y1 + dy, x + ATLAS_CELLS * a->cell_w - 1,
+                         cell->y1 + dy + a->cell_h - 1 };
+
+    lv_draw_image_dsc_t img;
+    lv_draw_image_dsc_init(&img);
+    img.src = &a->buf;
+    layer->_clip_area = vis;
+    lv_draw_image(layer, &img, &coords);
+    layer->_clip_area = clip;
+    return true;
+}
+
+// ── Benchmark (-DPRICE_BENCH) ──────────────────────────────────────
+#ifdef PRICE_BENCH
+
+#include "esp_timer.h"
+
+#include <stdio.h>
+
+#define BENCH_FRAMES  20
+
+static int64_t bench_render(lv_obj_t *obj)
+{
+    int64_t us = 0;
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        lv_obj_invalidate(obj);
+        int64_t t0 = esp_timer_get_time();
+        lv_refr_now(NULL);
+        us += esp_timer_get_time() - t0;
+    }
+    return us / BENCH_FRAMES;
+}
+
+void glyph_atlas_bench_run(lv_obj_t *text_obj)
+{
+    lv_obj_t *scr = lv_screen_active();
+    lv_refr_now(NULL);
+
+    s_enabled = false;
+    int64_t scr_label = bench_render(scr);
+    int64_t text_label = bench_render(text_obj);
+    s_enabled = true;
+    int64_t scr_atlas = bench_render(scr);
+    int64_t text_atlas = bench_render(text_obj);
+
+    printf("%s: Main screen %lld -> %lld us/frame, price text %lld -> %lld us/frame "
+           "(label glyphs -> atlas blits)\n", TAG, scr_label, scr_atlas, text_label, text_atlas);
+}
+
+#endif
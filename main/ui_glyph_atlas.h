@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "lvgl.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Pre-rendered price glyphs. An atlas is one RGB565 strip holding every
+ * character of GLYPH_ATLAS_ALPHABET in fixed-width cells, rasterized
+ * once for a font, text color, text opacity and background color.
+ * Drawing a character from it is an opaque image blit (a row copy per
+ * line) instead of decoding and blending a 4 bpp glyph bitmap.
+ *
+ * Atlases are shared and reference counted. Unused ones stay cached,
+ * within a fixed RAM budget, so a price flashing between colors does
+ * not re-render them; past the budget, text is drawn as labels.
+ */
+
+#define GLYPH_ATLAS_ALPHABET  "0123456789$.,%+-k "
+
+typedef struct glyph_atlas glyph_atlas_t;
+
+/**
+ * Get (render if needed) the atlas for these colors, or NULL if out of
+ * memory, budget or cache slots. Call outside rendering, with the LVGL
+ * lock.
+ */
+glyph_atlas_t *glyph_atlas_get(const lv_font_t *font, int32_t cell_w, int32_t cell_h,
+                               lv_color_t fg, lv_opa_t opa, lv_color_t bg);
+
+/** Drop a reference from glyph_atlas_get(); NULL is ignored. */
+void glyph_atlas_release(glyph_atlas_t *atlas);
+
+/**
+ * Blit c into cell, moved down by dy and clipped to cell. Returns false
+ * (drawing nothing) if c is not in the alphabet or dsc's color or
+ * opacity differs from the atlas; the caller then draws a label.
+ */
+bool glyph_atlas_draw(lv_layer_t *layer, const glyph_atlas_t *atlas,
+                      const lv_draw_label_dsc_t *dsc, const lv_area_t *cell,
+                      char c, int32_t dy);
+
+#ifdef PRICE_BENCH
+/**
+ * Render the active screen, then only text_obj, with atlases disabled
+ * and enabled, and log the average render time of each. Call with the
+ * LVGL lock held.
+ */
+void glyph_atlas_bench_run(lv_obj_t *text_obj);
+#endif
@@ -4,14 +4,10 @@
  */
 
 #include "ui_internal.h"
+#include "disp_stats.h"
 #include "wifi.h"
 #include "homekit.h"
 
-LV_FONT_DECLARE(font_mono_10)
-LV_FONT_DECLARE(font_mono_12)
-LV_FONT_DECLARE(font_mono_14)
-LV_FONT_DECLARE(font_mono_18)
-
 #include "driver/temperature_sensor.h"
 #include "esp_system.h"
 #include "esp_wifi.h"
@@ -33,6 +29,8 @@ static temperature_sensor_handle_t s_temp_sensor;
 uint32_t s_heap_total;
 static lv_obj_t *s_info_panel;
 static lv_obj_t *s_info_time;
+static lv_obj_t *s_info_fps;
+static lv_obj_t *s_info_spi;
 static lv_obj_t *s_info_temp_arc;
 static lv_obj_t *s_info_temp_lbl;
 static lv_obj_t *s_info_heap_arc;
@@ -86,6 +84,19 @@ void create_info_panel(lv_obj_t *parent)
     lv_obj_set_style_text_font(s_info_time, &font_mono_18, 0);
     lv_obj_align(s_info_time, LV_ALIGN_CENTER, 0, 0);
 
+    // Main screen's frame rate + p95 render time, and SPI throughput
+    s_info_fps = lv_label_create(time_card);
+    lv_label_set_text(s_info_fps, "");
+    lv_obj_set_style_text_color(s_info_fps, lv_color_hex(0x8A8A8A), 0);
+    lv_obj_set_style_text_font(s_info_fps, &font_mono_10, 0);
+    lv_obj_align(s_info_fps, LV_ALIGN_LEFT_MID, 0, 0);
+
+    s_info_spi = lv_label_create(time_card);
+    lv_label_set_text(s_info_spi, "");
+    lv_obj_set_style_text_color(s_info_spi, lv_color_hex(0x8A8A8A), 0);
+    lv_obj_set_style_text_font(s_info_spi, &font_mono_10, 0);
+    lv_obj_align(s_info_spi, LV_ALIGN_RIGHT_MID, 0, 0);
+
     // ── System card (bottom-left): temp arc + heap arc ──────────────
     int bot_y = MARGIN_TOP + TIME_CARD_H + GAP;
     int bot_h = CONTENT_H - TIME_CARD_H - GAP;
@@ -260,6 +271,7 @@ void toggle_info_panel(void)
     if (s_animating || s_loading_overlay) return;
     s_animating = true;
     s_show_info = !s_show_info;
+    disp_stats_set_screen(s_show_info ? DISP_SCREEN_INFO : DISP_SCREEN_MAIN);
 
     // Wake the info update task when panel becomes visible
     if (s_show_info && s_info_task) {
@@ -385,6 +397,7 @@ void info_update_task(void *arg)
         if (!s_show_info) {
             // Sleep until notified by toggle_info_panel()
             ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            if (s_show_info) disp_stats_dump();
             continue;
         }
         vTaskDelay(pdMS_TO_TICKS(1000));
@@ -459,6 +472,16 @@ void info_update_task(void *arg)
             lv_obj_set_style_arc_color(s_info_heap_arc, heap_color, LV_PART_INDICATOR);
             lv_label_set_text(s_info_heap_lbl, heap_txt);
             update_rssi_bars(rssi);
+            // Display pipeline (main screen)
+            disp_stats_summary_t ds;
+            if (disp_stats_get(DISP_SCREEN_MAIN, &ds)) {
+                lv_label_set_text_fmt(s_info_fps, "%lufps %lu.%lums",
+                                      (unsigned long)((ds.fps_x10 + 5) / 10),
+                                      (unsigned long)(ds.render_p95_us / 1000),
+                                      (unsigned long)(ds.render_p95_us % 1000 / 100));
+                lv_label_set_text_fmt(s_info_spi, "%luKB/s",
+                                      (unsigned long)(ds.spi_bytes_per_s / 1024));
+            }
             // HomeKit status
             if (homekit_get_paired_count() > 0) {
                 lv_label_set_text(s_info_setup, "HomeKit Paired");
@@ -488,6 +511,8 @@ void ui_info_cleanup(void)
 {
     s_info_panel = NULL;
     s_info_time = NULL;
+    s_info_fps = NULL;
+    s_info_spi = NULL;
     s_info_temp_arc = NULL;
     s_info_temp_lbl = NULL;
     s_info_heap_arc = NULL;
@@ -6,9 +6,13 @@
 #pragma once
 
 #include "board_config.h"
+#include "assets.h"
 #include "token_config.h"
+#include "price.h"
+#include "price_hist.h"
 #include "lvgl.h"
 
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -30,20 +34,47 @@
 #define PILL_H      26
 #define PILL_RADIUS 13
 
-#define CHART_POINTS      48
-#define CHART_INTERVAL_MS (30 * 60 * 1000)   // 30 min between chart samples
+#define CHART_POINTS      PRICE_HIST_LEN   // 48
+#define CHART_INTERVAL_MS (30 * 60 * 1000)   // 30 min per chart candle
+#define CANDLE_INTERVAL_S (CHART_INTERVAL_MS / 1000)   // Gate.io "30m" candles
+#define CHART_W           (SIDE_X - GAP - MARGIN_H)    // 208: most points a chart draws
+
+// ── Chart timeframes ───────────────────────────────────────────────
+// TF_1D is the live history in crypto_item_t.hist. The others are
+// downloaded for the focused token, LTTB-decimated to CHART_W points and
+// cached, so cycling back to them does not download again.
+typedef enum { TF_1D, TF_7D, TF_1H, TF_COUNT } chart_tf_t;
+
+typedef struct {
+    const char *label;
+    const char *interval;                 // Gate.io candle interval
+    int32_t     interval_s;
+    int         candles;                  // requested per download
+} chart_tf_info_t;
+
+#define TF_MAX_CANDLES    336             // 7D of 30m candles
+
+extern const chart_tf_info_t g_chart_tf[TF_COUNT];
 
 // ── Crypto data ────────────────────────────────────────────────────
+typedef struct {
+    price_t     price;
+    price_t     change_pct;
+    price_t     high_24h;
+    price_t     low_24h;
+} crypto_quote_t;
+
 typedef struct {
     const char *symbol;
     const char *name;
     const char *pair;                     // Gate.io trading pair (NULL = skip)
-    const lv_image_dsc_t *logo;
-    double      price;
-    double      change_pct;
-    double      high_24h;
-    double      low_24h;
-    double      hist_raw[CHART_POINTS];   // raw price history (full precision)
+    const crypto_logo_t *logo;
+    // Written by the fetch, push and LVGL tasks; access through the
+    // crypto_get_* / crypto_set_* functions below
+    _Atomic uint32_t seq;                 // seqlock: odd while a write is in progress
+    crypto_quote_t quote;
+    price_hist_t hist;                    // chart history ring + running min/max
+    int64_t     candle_ts;                // start (epoch s) of newest candle in hist, 0 = none
 } crypto_item_t;
 
 // ── Shared state (defined in ui.c) ─────────────────────────────────
@@ -57,11 +88,38 @@ extern lv_obj_t *s_loading_overlay;
 extern lv_obj_t *s_main_panel;
 extern lv_obj_t *s_side_viewport;
 
+// ── Token data (defined in ui.c) ───────────────────────────────────
+// Readers copy what they need and retry if a write overlapped, so they
+// never block a writer and never see half of an update. Writers are
+// serialized by a short critical section.
+static inline uint32_t crypto_read_begin(const crypto_item_t *item)
+{
+    uint32_t seq;
+    while ((seq = atomic_load_explicit(&item->seq, memory_order_acquire)) & 1) {
+    }
+    return seq;
+}
+
+static inline bool crypto_read_retry(const crypto_item_t *item, uint32_t seq)
+{
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&item->seq, memory_order_relaxed) != seq;
+}
+
+crypto_quote_t crypto_get_quote(int idx);
+void crypto_set_quote(int idx, const crypto_quote_t *q);
+int64_t crypto_get_candle_ts(int idx);
+/* Copy the history; returns candle_ts. */
+int64_t crypto_get_hist(int idx, price_hist_t *out);
+void crypto_set_hist(int idx, const price_hist_t *h, int64_t candle_ts);
+/* Append the close of the candle starting at candle_ts. */
+void crypto_push_candle(int idx, price_t close, int64_t candle_ts);
+
 // ── Helpers (defined in ui.c) ──────────────────────────────────────
-lv_color_t chg_color(double pct);
-void format_price(char *buf, size_t len, double price);
-void format_compact_price(char *buf, size_t len, double price);
-void format_change(char *buf, size_t len, double pct);
+lv_color_t chg_color(price_t pct);
+void format_price(char *buf, size_t len, price_t price);
+void format_compact_price(char *buf, size_t len, price_t price);
+void format_change(char *buf, size_t len, price_t pct);
 
 // ── Teardown flag (set by ui_cleanup, checked by background tasks) ──
 extern volatile bool s_ui_teardown;
@@ -69,6 +127,7 @@ extern volatile bool s_ui_teardown;
 // ── Cross-module functions ─────────────────────────────────────────
 // ui.c
 void switch_focus(void);
+void cycle_timeframe(void);
 
 // ui_info.c
 void create_info_panel(lv_obj_t *parent);
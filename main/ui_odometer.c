@@ -0,0 +1,320 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#include "ui_odometer.h"
+#include "ui_glyph_atlas.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+typedef struct {
+    const lv_font_t *font;
+    int32_t  cell_w;
+    int32_t  cell_h;
+    uint8_t  len;
+    char     text[ODOMETER_MAX_CELLS + 1];     // shown, or being rolled to
+    char     from[ODOMETER_MAX_CELLS + 1];     // characters rolling out
+    uint32_t rolling;                          // bit per rolling cell
+    bool     up;
+    int32_t  offset;                           // roll progress, 0 … cell_h
+    glyph_atlas_t *atlas;                      // opaque background only
+} odometer_t;
+
+static odometer_t *odo_get(lv_obj_t *obj)
+{
+    return (odometer_t *)lv_obj_get_user_data(obj);
+}
+
+static void invalidate_cell(lv_obj_t *obj, const odometer_t *o, int i)
+{
+    lv_area_t a;
+    lv_obj_get_coords(obj, &a);
+    a.x1 += i * o->cell_w;
+    a.x2 = a.x1 + o->cell_w - 1;
+    lv_obj_invalidate_area(obj, &a);
+}
+
+static void invalidate_rolling(lv_obj_t *obj, const odometer_t *o)
+{
+    for (int i = 0; i < o->len; i++) {
+        if (o->rolling & (1u << i)) invalidate_cell(obj, o, i);
+    }
+}
+
+// ── Drawing ────────────────────────────────────────────────────────
+static void draw_glyph(lv_layer_t *layer, const odometer_t *o, lv_draw_label_dsc_t *dsc,
+                       const lv_area_t *cell, char c, int32_t dy)
+{
+    if (o->atlas && glyph_atlas_draw(layer, o->atlas, dsc, cell, c, dy)) return;
+    if (c == ' ') return;
+    char s[2] = { c, '\0' };
+    lv_area_t a = *cell;
+    lv_area_move(&a, 0, dy);
+    dsc->text = s;
+    lv_draw_label(layer, dsc, &a);
+}
+
+static void draw_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    odometer_t *o = odo_get(obj);
+    lv_layer_t *layer = lv_event_get_layer(e);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &dsc);
+    dsc.font = o->font;
+    dsc.text_local = 1;                 // glyph strings live on the stack
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_area_t clip = layer->_clip_area;
+
+    for (int i = 0; i < o->len; i++) {
+        lv_area_t cell = {
+            coords.x1 + i * o->cell_w, coords.y1,
+            coords.x1 + (i + 1) * o->cell_w - 1, coords.y1 + o->cell_h - 1,
+        };
+        lv_area_t vis;
+        if (!lv_area_intersect(&vis, &clip, &cell)) continue;
+
+        if (!(o->rolling & (1u << i))) {
+            draw_glyph(layer, o, &dsc, &cell, o->text[i], 0);
+            continue;
+        }
+        // Rolling up: the old character leaves at the top and the new
+        // one enters from below
+        int32_t dy = o->up ? -o->offset : o->offset;
+        layer->_clip_area = vis;
+        draw_glyph(layer, o, &dsc, &cell, o->from[i], dy);
+        draw_glyph(layer, o, &dsc, &cell, o->text[i], dy + (o->up ? o->cell_h : -o->cell_h));
+        layer->_clip_area = clip;
+    }
+}
+
+/* Pick the atlas for the current colors; glyphs are drawn from it only
+ * over an opaque background, which the atlas cells can stand in for. */
+static void style_changed_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    odometer_t *o = odo_get(obj);
+    glyph_atlas_t *atlas = NULL;
+    if (lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) == LV_OPA_COVER) {
+        atlas = glyph_atlas_get(o->font, o->cell_w, o->cell_h,
+                                lv_obj_get_style_text_color(obj, LV_PART_MAIN),
+                                lv_obj_get_style_text_opa(obj, LV_PART_MAIN),
+                                lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+    }
+    glyph_atlas_release(o->atlas);      // after the get: an unchanged atlas stays cached
+    o->atlas = atlas;
+}
+
+static void delete_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    glyph_atlas_release(odo_get(obj)->atlas);
+    lv_free(odo_get(obj));
+    lv_obj_set_user_data(obj, NULL);
+}
+
+// ── Rolling ────────────────────────────────────────────────────────
+static void roll_anim_cb(void *var, int32_t v)
+{
+    lv_obj_t *obj = var;
+    odometer_t *o = odo_get(obj);
+    if (v == o->offset) return;
+    o->offset = v;
+    invalidate_rolling(obj, o);
+}
+
+static void roll_done_cb(lv_anim_t *a)
+{
+    // The last frame already shows the new characters in place
+    odometer_t *o = odo_get(a->var);
+    o->rolling = 0;
+    o->offset = 0;
+}
+
+static void finish_roll(lv_obj_t *obj, odometer_t *o)
+{
+    if (!o->rolling) return;
+    lv_anim_delete(obj, roll_anim_cb);
+    invalidate_rolling(obj, o);
+    o->rolling = 0;
+    o->offset = 0;
+}
+
+// ── API ────────────────────────────────────────────────────────────
+lv_obj_t *odometer_create(lv_obj_t *parent, const lv_font_t *font)
+{
+    odometer_t *o = lv_malloc_zeroed(sizeof(*o));
+    LV_ASSERT_MALLOC(o);
+    o->font = font;
+    o->cell_w = lv_font_get_glyph_width(font, '0', 0);
+    o->cell_h = lv_font_get_line_height(font);
+
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(obj, 0, o->cell_h);
+    lv_obj_set_user_data(obj, o);
+    lv_obj_add_event_cb(obj, draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(obj, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_add_event_cb(obj, delete_cb, LV_EVENT_DELETE, NULL);
+    return obj;
+}
+
+void odometer_set_text(lv_obj_t *obj, const char *text)
+{
+    odometer_t *o = odo_get(obj);
+    size_t len = strnlen(text, ODOMETER_MAX_CELLS);
+    if (len == o->len && memcmp(o->text, text, len) == 0) return;
+
+    finish_roll(obj, o);
+    if (len != o->len) {
+        memcpy(o->text, text, len);
+        o->text[len] = '\0';
+        o->len = (uint8_t)len;
+        lv_obj_set_width(obj, (int32_t)len * o->cell_w);
+        lv_obj_invalidate(obj);
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (o->text[i] != text[i]) {
+            o->text[i] = text[i];
+            invalidate_cell(obj, o, (int)i);
+        }
+    }
+}
+
+void odometer_roll_to(lv_obj_t *obj, const char *text, uint32_t duration_ms)
+{
+    odometer_t *o = odo_get(obj);
+    size_t len = strnlen(text, ODOMETER_MAX_CELLS);
+    if (len != o->len || duration_ms == 0) {
+        odometer_set_text(obj, text);
+        return;
+    }
+
+    finish_roll(obj, o);
+    uint32_t mask = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (o->text[i] != text[i]) mask |= 1u << i;
+    }
+    if (!mask) return;
+
+    o->up = memcmp(text, o->text, len) > 0;
+    memcpy(o->from, o->text, len);
+    memcpy(o->text, text, len);
+    o->rolling = mask;
+    o->offset = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_values(&a, 0, o->cell_h);
+    lv_anim_set_duration(&a, duration_ms);
+    lv_anim_set_exec_cb(&a, roll_anim_cb);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_set_completed_cb(&a, roll_done_cb);
+    lv_anim_start(&a);
+}
+
+// ── Benchmark (-DPRICE_BENCH) ──────────────────────────────────────
+#ifdef PRICE_BENCH
+
+#include "ui_internal.h"
+
+#include "esp_timer.h"
+
+#include <stdio.h>
+
+#define BENCH_FRAMES  (500 / LV_DEF_REFR_PERIOD)     // one 500 ms price animation
+
+static const char *TAG = "odometer_bench";
+
+static uint32_t s_bench_px;
+
+static void bench_inv_cb(lv_event_t *e)
+{
+    const lv_area_t *a = lv_event_get_param(e);
+    s_bench_px += lv_area_get_size(a);
+}
+
+/* Render what has been invalidated; adds its pixels and time. */
+static void bench_frame(uint32_t *px, int64_t *us)
+{
+    int64_t t0 = esp_timer_get_time();
+    lv_refr_now(NULL);
+    *us += esp_timer_get_time() - t0;
+    *px += s_bench_px;
+    s_bench_px = 0;
+}
+
+void odometer_bench_run(const lv_font_t *font)
+{
+    static const struct { price_t from, to; } ticks[] = {
+        { PRICE_LIT(67012.35), PRICE_LIT(67018.90) },
+        { PRICE_LIT(3421.07), PRICE_LIT(3420.98) },
+        { PRICE_LIT(0.58230), PRICE_LIT(0.58241) },
+    };
+
+    lv_display_t *disp = lv_display_get_default();
+    lv_obj_t *label = lv_label_create(lv_layer_top());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), 0);
+    lv_obj_set_pos(label, MARGIN_H, 42);
+    lv_obj_t *odo = odometer_create(lv_layer_top(), font);
+    lv_obj_set_style_text_color(odo, lv_color_hex(0xFFFFFF), 0);
+    lv_obj_set_pos(odo, MARGIN_H, 42);
+    lv_display_add_event_cb(disp, bench_inv_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+
+    char buf[24];
+    for (size_t k = 0; k < sizeof(ticks) / sizeof(ticks[0]); k++) {
+        price_t from = ticks[k].from, to = ticks[k].to;
+        uint32_t label_px = 0, odo_px = 0, px = 0;
+        int64_t label_us = 0, odo_us = 0, us = 0;
+
+        // Label: a new string per frame, as the price animation used to
+        lv_obj_add_flag(odo, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(label, LV_OBJ_FLAG_HIDDEN);
+        format_price(buf, sizeof(buf), from);
+        lv_label_set_text(label, buf);
+        bench_frame(&px, &us);
+        for (int f = 1; f <= BENCH_FRAMES; f++) {
+            format_price(buf, sizeof(buf), from + (to - from) * f / BENCH_FRAMES);
+            lv_label_set_text(label, buf);
+            bench_frame(&label_px, &label_us);
+        }
+
+        // Odometer: the changed cells roll, stepped by hand
+        lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(odo, LV_OBJ_FLAG_HIDDEN);
+        format_price(buf, sizeof(buf), from);
+        odometer_set_text(odo, buf);
+        bench_frame(&px, &us);
+        format_price(buf, sizeof(buf), to);
+        odometer_roll_to(odo, buf, 500);
+        lv_anim_delete(odo, roll_anim_cb);
+        odometer_t *o = odo_get(odo);
+        for (int f = 1; f <= BENCH_FRAMES; f++) {
+            roll_anim_cb(odo, o->cell_h * f / BENCH_FRAMES);
+            bench_frame(&odo_px, &odo_us);
+        }
+        o->rolling = 0;
+        o->offset = 0;
+
+        printf("%s: %s, %d frames per tick: label %lu px %lld us, odometer %lu px %lld us\n",
+               TAG, buf, BENCH_FRAMES, (unsigned long)label_px, label_us,
+               (unsigned long)odo_px, odo_us);
+    }
+
+    lv_display_remove_event_cb_with_user_data(disp, bench_inv_cb, NULL);
+    lv_obj_delete(label);
+    lv_obj_delete(odo);
+    lv_refr_now(NULL);
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+#pragma once
+
+#include "lvgl.h"
+
+#include <stdint.h>
+
+/*
+ * One line of text in a monospaced font, drawn as a row of fixed-width
+ * cells instead of a label. Changing the text invalidates only the
+ * cells whose character changed, so a tick that moves the last two
+ * digits of a price redraws two glyphs rather than the whole line.
+ * Color and opacity come from the object's text styles.
+ *
+ * With an opaque background (bg_opa LV_OPA_COVER, set after the text
+ * color so only the final colors are rendered) the digits, signs and
+ * separators of a price are blitted from a pre-rendered glyph atlas
+ * (ui_glyph_atlas.h) instead of being rasterized on every draw.
+ */
+
+#define ODOMETER_MAX_CELLS  20
+
+/**
+ * Create an empty odometer using font (monospaced; cells are as wide
+ * as its '0').
+ */
+lv_obj_t *odometer_create(lv_obj_t *parent, const lv_font_t *font);
+
+/**
+ * Show text (at most ODOMETER_MAX_CELLS characters) at once. A roll in
+ * progress is finished first, unless it is already rolling to text.
+ */
+void odometer_set_text(lv_obj_t *obj, const char *text);
+
+/**
+ * Roll the changed cells to text over duration_ms: upwards when text
+ * sorts after the shown text, downwards otherwise. Text of another
+ * length is shown at once.
+ */
+void odometer_roll_to(lv_obj_t *obj, const char *text, uint32_t duration_ms);
+
+#ifdef PRICE_BENCH
+/**
+ * Draw a few price ticks through a label (a new string per animation
+ * frame) and through an odometer roll, and log invalidated pixels and
+ * refresh time per tick. Call with the LVGL lock held.
+ */
+void odometer_bench_run(const lv_font_t *font);
+#endif
@@ -0,0 +1,234 @@
+/*
+ * SPDX-FileCopyrightText: 2025-2026 Bruce
+ * SPDX-License-Identifier: CC-BY-NC-4.0
+ */
+
+/*
+ * Host test for main/price_candle.c, driven by tools/candle_test.py.
+ *
+ * Reads ticks and the exchange's candles on stdin, one per line:
+ *
+ *     T <ts_s> <price>
+ *     C <interval_s> <start_s> <open> <high> <low> <close>
+ *
+ * and checks, for every expected candle, that the aggregator builds the
+ * same OHLC from the ticks three ways: tick by tick with
+ * candle_agg_tick() and candle_agg_flush(), from 1-minute parts with
+ * candle_agg_merge(), and from two halves joined with candle_merge().
+ */
+
+#include "price_candle.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_TICKS    8192
+#define MAX_CANDLES  1024
+#define PART_S       60
+
+typedef struct {
+    int64_t ts_s;
+    price_t price;
+} tick_t;
+
+typedef struct {
+    int32_t  interval_s;
+    candle_t c;
+    char     text[256];         // as read, for messages
+} expect_t;
+
+static tick_t   s_ticks[MAX_TICKS];
+static int      s_nticks;
+static expect_t s_want[MAX_CANDLES];
+static int      s_nwant;
+static int      s_failed;
+
+static void load(FILE *f)
+{
+    char line[256];
+    int n = 0;
+    while (fgets(line, sizeof(line), f)) {
+        n++;
+        line[strcspn(line, "\r\n")] = '\0';
+        char a[40], b[40], c[40], d[40];
+        long long ts, start;
+        int interval;
+
+        if (line[0] == 'T' && s_nticks < MAX_TICKS &&
+            sscanf(line, "T %lld %39s", &ts, a) == 2) {
+            s_ticks[s_nticks++] = (tick_t){ ts, price_parse(a) };
+        } else if (line[0] == 'C' && s_nwant < MAX_CANDLES &&
+                   sscanf(line, "C %d %lld %39s %39s %39s %39s",
+                          &interval, &start, a, b, c, d) == 6) {
+            expect_t *w = &s_want[s_nwant++];
+            w->interval_s = interval;
+            w->c = (candle_t){
+                .start_s = start,
+                .open = price_parse(a), .high = price_parse(b),
+                .low = price_parse(c), .close = price_parse(d),
+            };
+            snprintf(w->text, sizeof(w->text), "%s", line + 2);
+        } else if (line[0] != '\0' && line[0] != '#') {
+            fprintf(stderr, "stdin:%d: bad line: %s\n", n, line);
+            exit(2);
+        }
+    }
+}
+
+static void check(const char *how, const expect_t *w, const candle_t *got, bool found)
+{
+    const candle_t *c = &w->c;
+    if (found && got->start_s == c->start_s && got->open == c->open &&
+        got->high == c->high && got->low == c->low && got->close == c->close) {
+        return;
+    }
+    s_failed++;
+    printf("FAIL %-6s %s\n", how, w->text);
+    if (!found) {
+        printf("     no candle built\n");
+        return;
+    }
+#if PRICE_FIXED_POINT
+    printf("     got %lld %lld %lld %lld %lld (units of 1e-8)\n",
+           (long long)got->start_s, (long long)got->open, (long long)got->high,
+           (long long)got->low, (long long)got->close);
+#else
+    printf("     got %lld %.10g %.10g %.10g %.10g\n", (long long)got->start_s,
+           got->open, got->high, got->low, got->close);
+#endif
+}
+
+/* Ticks of [start, start + interval), as indices into s_ticks. */
+static void tick_range(int64_t start, int32_t interval_s, int *first, int *end)
+{
+    *first = 0;
+    while (*first < s_nticks && s_ticks[*first].ts_s < start) (*first)++;
+    *end = *first;
+    while (*end < s_nticks && s_ticks[*end].ts_s < start + interval_s) (*end)++;
+}
+
+/*
+ * Every candle of an interval built tick by tick. Even-numbered
+ * candles are closed by a flush at the next tick, as the UI's timer
+ * would, the others by the tick itself; the last by a flush at its end.
+ */
+static int build_ticks(int32_t interval_s, candle_t *out, int max)
+{
+    candle_agg_t agg;
+    candle_agg_init(&agg, interval_s);
+    candle_t closed;
+    int n = 0;
+
+    for (int i = 0; i < s_nticks && n < max; i++) {
+        int64_t ts = s_ticks[i].ts_s;
+        if (n % 2 == 0 && candle_agg_flush(&agg, ts, &closed)) out[n++] = closed;
+        if (n < max && candle_agg_tick(&agg, ts, s_ticks[i].price, &closed)) {
+            out[n++] = closed;
+        }
+        if (candle_agg_flush(&agg, ts, &closed)) {
+            printf("FAIL flush   closed %lld at %lld, inside its interval\n",
+                   (long long)closed.start_s, (long long)ts);
+            s_failed++;
+        }
+    }
+    if (n < max && agg.open) {
+        if (candle_agg_flush(&agg, agg.cur.start_s + interval_s - 1, &closed)) {
+            printf("FAIL flush   closed %lld before its end\n", (long long)closed.start_s);
+            s_failed++;
+        }
+        if (candle_agg_flush(&agg, agg.cur.start_s + interval_s, &closed)) out[n++] = closed;
+    }
+    return n;
+}
+
+/* Every candle of an interval merged from 1-minute parts. */
+static int build_parts(int32_t interval_s, candle_t *out, int max)
+{
+    candle_agg_t part, agg;
+    candle_agg_init(&part, PART_S);
+    candle_agg_init(&agg, interval_s);
+    candle_t p, closed;
+    int n = 0;
+
+    for (int i = 0; i < s_nticks && n < max; i++) {
+        if (candle_agg_tick(&part, s_ticks[i].ts_s, s_ticks[i].price, &p) &&
+            candle_agg_merge(&agg, &p, &closed)) {
+            out[n++] = closed;
+        }
+    }
+    if (candle_agg_flush(&part, INT64_MAX, &p) && candle_agg_merge(&agg, &p, &closed) &&
+        n < max) {
+        out[n++] = closed;
+    }
+    if (n < max && candle_agg_flush(&agg, INT64_MAX, &closed)) out[n++] = closed;
+    return n;
+}
+
+/* One candle from two halves of its ticks, folded with candle_merge(). */
+static bool build_halves(const expect_t *w, candle_t *out)
+{
+    int first, end;
+    tick_range(w->c.start_s, w->interval_s, &first, &end);
+    if (end - first < 2) return false;
+    int mid = first + (end - first) / 2;
+
+    candle_t half[2];
+    int bounds[3] = { first, mid, end };
+    for (int h = 0; h < 2; h++) {
+        candle_agg_t agg;
+        candle_agg_init(&agg, w->interval_s);
+        for (int i = bounds[h]; i < bounds[h + 1]; i++) {
+            candle_agg_tick(&agg, s_ticks[i].ts_s, s_ticks[i].price, &half[h]);
+        }
+        if (!candle_agg_flush(&agg, INT64_MAX, &half[h])) return false;
+    }
+    candle_merge(&half[0], &half[1]);
+    *out = half[0];
+    return true;
+}
+
+static bool find(const candle_t *c, int n, int64_t start_s, candle_t *out)
+{
+    for (int i = 0; i < n; i++) {
+        if (c[i].start_s == start_s) {
+            *out = c[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(void)
+{
+    load(stdin);
+    if (s_nticks == 0 || s_nwant == 0) {
+        fprintf(stderr, "no ticks or no candles on stdin\n");
+        return 2;
+    }
+
+    static candle_t ticks[MAX_CANDLES], parts[MAX_CANDLES];
+    int32_t built = 0;
+    int nticks = 0, nparts = 0;
+    int checked = 0;
+
+    for (int i = 0; i < s_nwant; i++) {
+        const expect_t *w = &s_want[i];
+        if (w->interval_s != built) {
+            built = w->interval_s;
+            nticks = build_ticks(built, ticks, MAX_CANDLES);
+            nparts = built % PART_S == 0 ? build_parts(built, parts, MAX_CANDLES) : -1;
+        }
+
+        candle_t got;
+        check("tick", w, &got, find(ticks, nticks, w->c.start_s, &got));
+        if (nparts >= 0) check("merge", w, &got, find(parts, nparts, w->c.start_s, &got));
+        check("halves", w, &got, build_halves(w, &got));
+        checked++;
+    }
+
+    printf("%s: %d ticks, %d candles, %d failed (%s prices)\n",
+           s_failed ? "FAIL" : "ok", s_nticks, checked, s_failed,
+           PRICE_FIXED_POINT ? "fixed-point" : "double");
+    return s_failed ? 1 : 0;
+}
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Host test for the candle aggregator (main/price_candle.c).
+
+Builds tools/candle_test.c against main/price_candle.c and main/price.c
+with the host C compiler, once with double and once with fixed-point
+prices, and feeds it a fixture of Gate.io candlestick responses. The
+1-minute candles are replayed as ticks (open, the two extremes in the
+order the candle's direction implies, close); every 1m, 5m and 30m
+candle in the fixture must then come out of candle_agg_tick() /
+candle_agg_flush(), candle_agg_merge() and candle_merge() with the
+exchange's OHLC.
+
+    tools/candle_test.py [fixture]
+
+The fixture is what GET /spot/candlesticks returns for each interval,
+keyed by interval. Record a new one with
+
+    tools/candle_test.py record fixture.json BTC_USDT --buckets 6
+
+which fetches that many closed 30m buckets and the 1m and 5m candles
+inside them.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+import urllib.request
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+DEFAULT_FIXTURE = os.path.join(HERE, "gate_candles_btc_usdt.json")
+GATE_API = "https://api.gateio.ws/api/v4/spot/candlesticks"
+INTERVALS = {"1m": 60, "5m": 300, "30m": 1800}
+SOURCES = ["tools/candle_test.c", "main/price_candle.c", "main/price.c"]
+
+# Gate row: [t, quote_volume, close, high, low, open, base_volume, closed]
+T, CLOSE, HIGH, LOW, OPEN = 0, 2, 3, 4, 5
+
+
+def to_stdin(fixture):
+    lines = []
+    for row in fixture["1m"]:
+        t = int(row[T])
+        up = float(row[CLOSE]) >= float(row[OPEN])
+        first, second = (row[LOW], row[HIGH]) if up else (row[HIGH], row[LOW])
+        lines += [f"T {t} {row[OPEN]}", f"T {t + 20} {first}",
+                  f"T {t + 40} {second}", f"T {t + 59} {row[CLOSE]}"]
+    for name, secs in INTERVALS.items():
+        for row in fixture[name]:
+            lines.append(f"C {secs} {row[T]} {row[OPEN]} {row[HIGH]} {row[LOW]} {row[CLOSE]}")
+    return "\n".join(lines) + "\n"
+
+
+def run(args):
+    with open(args.fixture) as f:
+        fixture = json.load(f)
+    cc = os.environ.get("CC") or shutil.which("cc") or shutil.which("gcc")
+    if not cc:
+        sys.exit("no host C compiler (set CC)")
+    stdin = to_stdin(fixture)
+
+    failed = False
+    with tempfile.TemporaryDirectory() as tmp:
+        # price.h includes the IDF's sdkconfig.h; the host build needs none of it
+        open(os.path.join(tmp, "sdkconfig.h"), "w").close()
+        for fixed in (0, 1):
+            exe = os.path.join(tmp, f"candle_test_{fixed}")
+            build = subprocess.run([cc, "-std=gnu11", "-O2", "-Wall", "-Wextra", "-Werror",
+                                    f"-DPRICE_FIXED_POINT={fixed}", "-I", tmp,
+                                    "-I", os.path.join(ROOT, "main"), "-o", exe]
+                                   + [os.path.join(ROOT, s) for s in SOURCES])
+            if build.returncode != 0:
+                sys.exit("build failed")
+            r = subprocess.run([exe], input=stdin, text=True)
+            failed |= r.returncode != 0
+    sys.exit(1 if failed else 0)
+
+
+def fetch(pair, interval, start, end):
+    url = (f"{GATE_API}?currency_pair={pair}&interval={interval}"
+           f"&from={start}&to={end - 1}")
+    with urllib.request.urlopen(url, timeout=10) as r:
+        rows = json.load(r)
+    return [row for row in rows if row[-1] == "true" and start <= int(row[T]) < end]
+
+
+def write_fixture(path, fixture):
+    # One candle per line, so a fixture diffs readably
+    with open(path, "w") as out:
+        out.write("{\n")
+        for key, value in fixture.items():
+            if isinstance(value, list):
+                rows = ",\n".join("  " + json.dumps(row) for row in value)
+                out.write(f'"{key}": [\n{rows}\n]')
+            else:
+                out.write(f'"{key}": {json.dumps(value)}')
+            out.write(",\n" if key != list(fixture)[-1] else "\n")
+        out.write("}\n")
+
+
+def record(args):
+    bucket = INTERVALS["30m"]
+    end = int(time.time()) // bucket * bucket
+    start = end - args.buckets * bucket
+    fixture = {"pair": args.pair, "source": GATE_API, "from": start, "to": end}
+    for name in INTERVALS:
+        fixture[name] = fetch(args.pair, name, start, end)
+        print(f"{name}: {len(fixture[name])} candles")
+    if len(fixture["1m"]) != args.buckets * bucket // 60:
+        sys.exit("gap in the 1m candles, record again")
+    write_fixture(args.fixture, fixture)
+    print(f"written to {args.fixture}")
+
+
+def main():
+    if sys.argv[1:2] == ["record"]:
+        p = argparse.ArgumentParser(prog="candle_test.py record",
+                                    description="record a fixture from Gate's REST API")
+        p.add_argument("fixture")
+        p.add_argument("pair")
+        p.add_argument("--buckets", type=int, default=6, help="closed 30m buckets")
+        record(p.parse_args(sys.argv[2:]))
+    else:
+        p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+        p.add_argument("fixture", nargs="?", default=DEFAULT_FIXTURE)
+        run(p.parse_args())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Stand-in for the Gate.io spot.tickers push feed.
+
+Replays a capture of spot.tickers frames to the firmware with their
+original timing, so the push path (main/price_ws.c) can be exercised
+without the exchange. Needs the `websockets` package (pip install
+websockets).
+
+A capture is JSON lines, one push frame per line, exactly as the
+server sent it. Frames are paced by their "time_ms" and restamped with
+the current time, so the firmware's latency log stays meaningful.
+Record one from the live feed with
+
+    tools/ws_replay.py record capture.jsonl BTC_USDT ETH_USDT --seconds 300
+
+and serve it with
+
+    tools/ws_replay.py serve tools/spot_tickers_sample.jsonl --port 8765
+
+then build the firmware with -DPRICE_WS_URI=\\"ws://<host>:8765/\\".
+Only frames for the pairs the firmware subscribes to are sent; the
+capture restarts from the top when it runs out (--once to stop).
+"""
+
+import argparse
+import asyncio
+import json
+import sys
+import time
+
+import websockets
+
+GATE_WS_URI = "wss://api.gateio.ws/ws/v4/"
+
+
+def load_frames(path):
+    frames = []
+    with open(path) as f:
+        for n, line in enumerate(f, 1):
+            line = line.strip()
+            if not line:
+                continue
+            frame = json.loads(line)
+            if frame.get("channel") != "spot.tickers" or frame.get("event") != "update":
+                continue
+            if "time_ms" not in frame:
+                sys.exit(f"{path}:{n}: frame has no time_ms")
+            frames.append(frame)
+    if not frames:
+        sys.exit(f"{path}: no spot.tickers update frames")
+    return frames
+
+
+def now_stamp(frame):
+    ms = int(time.time() * 1000)
+    frame = dict(frame, time=ms // 1000, time_ms=ms)
+    return json.dumps(frame, separators=(",", ":"))
+
+
+async def replay(ws, frames, args):
+    peer = ws.remote_address
+    pairs = set()
+    async for msg in ws:
+        req = json.loads(msg)
+        if req.get("channel") == "spot.tickers" and req.get("event") == "subscribe":
+            pairs = set(req.get("payload") or [])
+            await ws.send(json.dumps({
+                "time": int(time.time()), "channel": "spot.tickers",
+                "event": "subscribe", "result": {"status": "success"},
+            }))
+            break
+    print(f"{peer}: subscribed {sorted(pairs)}")
+
+    sent = 0
+    while True:
+        t0 = time.monotonic()
+        first_ms = frames[0]["time_ms"]
+        for frame in frames:
+            if frame["result"].get("currency_pair") not in pairs:
+                continue
+            due = t0 + (frame["time_ms"] - first_ms) / 1000 / args.speed
+            delay = due - time.monotonic()
+            if delay > 0:
+                await asyncio.sleep(delay)
+            await ws.send(now_stamp(frame))
+            sent += 1
+        print(f"{peer}: {sent} frames sent")
+        if args.once:
+            return
+        await asyncio.sleep(1 / args.speed)
+
+
+async def serve(args):
+    frames = load_frames(args.capture)
+    span = (frames[-1]["time_ms"] - frames[0]["time_ms"]) / 1000
+    print(f"{len(frames)} frames over {span:.0f} s from {args.capture}")
+
+    async def handler(ws, *_):
+        try:
+            await replay(ws, frames, args)
+        except websockets.ConnectionClosed:
+            print(f"{ws.remote_address}: disconnected")
+
+    async with websockets.serve(handler, args.host, args.port):
+        print(f"Serving on ws://{args.host}:{args.port}/")
+        await asyncio.Future()
+
+
+async def record(args):
+    n = 0
+    deadline = time.monotonic() + args.seconds
+    async with websockets.connect(GATE_WS_URI) as ws:
+        await ws.send(json.dumps({
+            "time": int(time.time()), "channel": "spot.tickers",
+            "event": "subscribe", "payload": args.pairs,
+        }))
+        with open(args.capture, "w") as out:
+            while time.monotonic() < deadline:
+                try:
+                    msg = await asyncio.wait_for(ws.recv(), deadline - time.monotonic())
+                except asyncio.TimeoutError:
+                    break
+                if json.loads(msg).get("event") != "update":
+                    continue
+                out.write(msg.strip() + "\n")
+                n += 1
+    print(f"{n} frames written to {args.capture}")
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = p.add_subparsers(dest="cmd", required=True)
+
+    s = sub.add_parser("serve", help="replay a capture to connecting clients")
+    s.add_argument("capture")
+    s.add_argument("--host", default="0.0.0.0")
+    s.add_argument("--port", type=int, default=8765)
+    s.add_argument("--speed", type=float, default=1.0, help="playback speed factor")
+    s.add_argument("--once", action="store_true", help="do not loop the capture")
+
+    r = sub.add_parser("record", help="record the live feed to a capture")
+    r.add_argument("capture")
+    r.add_argument("pairs", nargs="+")
+    r.add_argument("--seconds", type=float, default=300)
+
+    args = p.parse_args()
+    asyncio.run(serve(args) if args.cmd == "serve" else record(args))
+
+
+if __name__ == "__main__":
+    main()